@@ -6,6 +6,17 @@ dnl Function to detect if libolecf dependencies are available
 AC_DEFUN([AX_LIBOLECF_CHECK_LOCAL],
   [dnl Check for internationalization functions in libolecf/libolecf_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Check for memory mapping headers and functions in libolecf/libolecf_memory_map.c
+  AC_CHECK_HEADERS([fcntl.h sys/mman.h sys/stat.h sys/types.h unistd.h])
+  AC_CHECK_FUNCS([mmap munmap])
+
+  dnl Check for read-ahead functions in libolecf/libolecf_read_ahead.c
+  AC_CHECK_FUNCS([madvise posix_fadvise])
+
+  dnl Check for io_uring headers and functions in libolecf/libolecf_io_uring.c
+  AC_CHECK_HEADERS([linux/io_uring.h sys/syscall.h])
+  AC_CHECK_FUNCS([syscall])
 ])
 
 dnl Function to check if DLL support is needed
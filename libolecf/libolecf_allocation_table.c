@@ -20,12 +20,27 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
 #include "libolecf_allocation_table.h"
+#include "libolecf_definitions.h"
+#include "libolecf_libbfio.h"
 #include "libolecf_libcerror.h"
 
+/* The instruction set is chosen at compile time, there is no runtime dispatch,
+ * AVX2 is only used when the library is built with AVX2 enabled, e.g. -mavx2
+ */
+#if defined( __AVX2__ )
+#include <immintrin.h>
+
+#elif defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#define LIBOLECF_ALLOCATION_TABLE_HAVE_SSE2
+
+#include <emmintrin.h>
+#endif
+
 /* Creates an allocation table
  * Make sure the value allocation_table is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -179,11 +194,26 @@ int libolecf_allocation_table_free(
 	}
 	if( *allocation_table != NULL )
 	{
+		if( ( *allocation_table )->table_sector_read_flags != NULL )
+		{
+			memory_free(
+			 ( *allocation_table )->table_sector_read_flags );
+		}
+		if( ( *allocation_table )->table_sector_identifiers != NULL )
+		{
+			memory_free(
+			 ( *allocation_table )->table_sector_identifiers );
+		}
 		if( ( *allocation_table )->sector_identifiers != NULL )
 		{
 			memory_free(
 			 ( *allocation_table )->sector_identifiers );
 		}
+		if( ( *allocation_table )->runs != NULL )
+		{
+			memory_free(
+			 ( *allocation_table )->runs );
+		}
 		memory_free(
 		 *allocation_table );
 
@@ -227,6 +257,17 @@ int libolecf_allocation_table_resize(
 
 		return( -1 );
 	}
+	if( allocation_table->runs != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid allocation table - unsupported run-length encoded sector identifiers.",
+		 function );
+
+		return( -1 );
+	}
 	if( allocation_table->number_of_sector_identifiers < number_of_sector_identifiers )
 	{
 		sector_identifiers_size = sizeof( uint32_t ) * number_of_sector_identifiers;
@@ -267,7 +308,897 @@ int libolecf_allocation_table_resize(
 	return( 1 );
 }
 
+/* Sets the table sectors that are read on demand
+ * The allocation table is resized to contain the entries of all table sectors
+ * The file IO handle is referenced and must remain open while the allocation table is used
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_allocation_table_set_table_sectors(
+     libolecf_allocation_table_t *allocation_table,
+     libbfio_handle_t *file_io_handle,
+     const uint32_t *table_sector_identifiers,
+     int number_of_table_sectors,
+     size_t sector_size,
+     uint8_t byte_order,
+     libcerror_error_t **error )
+{
+	static char *function                = "libolecf_allocation_table_set_table_sectors";
+	size_t number_of_sector_entries      = 0;
+	size_t number_of_sector_identifiers  = 0;
+	size_t table_sector_identifiers_size = 0;
+
+	if( allocation_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation table.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_table->table_sector_identifiers != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid allocation table - table sector identifiers value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_sector_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table sector identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_table_sectors <= 0 )
+	 || ( (size_t) number_of_table_sectors > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint32_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of table sectors value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sector_size < 4 )
+	 || ( sector_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_order != LIBOLECF_ENDIAN_BIG )
+	 && ( byte_order != LIBOLECF_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_sector_entries = sector_size / 4;
+
+	if( (size_t) number_of_table_sectors > ( (size_t) INT_MAX / number_of_sector_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of table sectors value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_sector_identifiers = (size_t) number_of_table_sectors * number_of_sector_entries;
+
+	if( libolecf_allocation_table_resize(
+	     allocation_table,
+	     (int) number_of_sector_identifiers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize allocation table.",
+		 function );
+
+		goto on_error;
+	}
+	table_sector_identifiers_size = sizeof( uint32_t ) * number_of_table_sectors;
+
+	allocation_table->table_sector_identifiers = (uint32_t *) memory_allocate(
+	                                                          table_sector_identifiers_size );
+
+	if( allocation_table->table_sector_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create table sector identifiers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     allocation_table->table_sector_identifiers,
+	     table_sector_identifiers,
+	     table_sector_identifiers_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy table sector identifiers.",
+		 function );
+
+		goto on_error;
+	}
+	allocation_table->table_sector_read_flags = (uint8_t *) memory_allocate(
+	                                                         sizeof( uint8_t ) * number_of_table_sectors );
+
+	if( allocation_table->table_sector_read_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create table sector read flags.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     allocation_table->table_sector_read_flags,
+	     0,
+	     sizeof( uint8_t ) * number_of_table_sectors ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear table sector read flags.",
+		 function );
+
+		goto on_error;
+	}
+	allocation_table->file_io_handle          = file_io_handle;
+	allocation_table->number_of_table_sectors = number_of_table_sectors;
+	allocation_table->sector_size             = sector_size;
+	allocation_table->byte_order              = byte_order;
+
+	return( 1 );
+
+on_error:
+	if( allocation_table->table_sector_read_flags != NULL )
+	{
+		memory_free(
+		 allocation_table->table_sector_read_flags );
+
+		allocation_table->table_sector_read_flags = NULL;
+	}
+	if( allocation_table->table_sector_identifiers != NULL )
+	{
+		memory_free(
+		 allocation_table->table_sector_identifiers );
+
+		allocation_table->table_sector_identifiers = NULL;
+	}
+	return( -1 );
+}
+
+/* Reads a specific table sector into the allocation table
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_allocation_table_read_table_sector(
+     libolecf_allocation_table_t *allocation_table,
+     int table_sector_index,
+     libcerror_error_t **error )
+{
+	uint8_t *sector_data            = NULL;
+	uint8_t *sector_entry           = NULL;
+	static char *function           = "libolecf_allocation_table_read_table_sector";
+	off64_t sector_offset           = 0;
+	size_t number_of_sector_entries = 0;
+	size_t sector_entry_index       = 0;
+	ssize_t read_count              = 0;
+	int entry_index                 = 0;
+
+	if( allocation_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( allocation_table->table_sector_identifiers == NULL )
+	 || ( allocation_table->table_sector_read_flags == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid allocation table - missing table sectors.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( table_sector_index < 0 )
+	 || ( table_sector_index >= allocation_table->number_of_table_sectors ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid table sector index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_table->table_sector_read_flags[ table_sector_index ] != 0 )
+	{
+		return( 1 );
+	}
+	number_of_sector_entries = allocation_table->sector_size / 4;
+
+	sector_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * allocation_table->sector_size );
+
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sector data.",
+		 function );
+
+		goto on_error;
+	}
+	sector_offset = ( (off64_t) allocation_table->table_sector_identifiers[ table_sector_index ] + 1 ) * allocation_table->sector_size;
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+		      allocation_table->file_io_handle,
+		      sector_data,
+		      allocation_table->sector_size,
+		      sector_offset,
+		      error );
+
+	if( read_count != (ssize_t) allocation_table->sector_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read table sector: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 table_sector_index,
+		 sector_offset,
+		 sector_offset );
+
+		goto on_error;
+	}
+	sector_entry = sector_data;
+	entry_index  = table_sector_index * (int) number_of_sector_entries;
+
+	for( sector_entry_index = 0;
+	     sector_entry_index < number_of_sector_entries;
+	     sector_entry_index++ )
+	{
+		if( allocation_table->byte_order == LIBOLECF_ENDIAN_LITTLE )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 sector_entry,
+			 allocation_table->sector_identifiers[ entry_index ] );
+		}
+		else
+		{
+			byte_stream_copy_to_uint32_big_endian(
+			 sector_entry,
+			 allocation_table->sector_identifiers[ entry_index ] );
+		}
+		sector_entry += 4;
+
+		entry_index++;
+	}
+	memory_free(
+	 sector_data );
+
+	allocation_table->table_sector_read_flags[ table_sector_index ] = 1;
+
+	return( 1 );
+
+on_error:
+	if( sector_data != NULL )
+	{
+		memory_free(
+		 sector_data );
+	}
+	return( -1 );
+}
+
+/* Reads the table sectors that were not read before
+ * Afterwards the allocation table no longer reads from the file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_allocation_table_read_all_table_sectors(
+     libolecf_allocation_table_t *allocation_table,
+     libcerror_error_t **error )
+{
+	static char *function  = "libolecf_allocation_table_read_all_table_sectors";
+	int table_sector_index = 0;
+
+	if( allocation_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation table.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_table->table_sector_read_flags == NULL )
+	{
+		return( 1 );
+	}
+	for( table_sector_index = 0;
+	     table_sector_index < allocation_table->number_of_table_sectors;
+	     table_sector_index++ )
+	{
+		if( libolecf_allocation_table_read_table_sector(
+		     allocation_table,
+		     table_sector_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read table sector: %d.",
+			 function,
+			 table_sector_index );
+
+			return( -1 );
+		}
+	}
+	memory_free(
+	 allocation_table->table_sector_read_flags );
+
+	allocation_table->table_sector_read_flags = NULL;
+
+	if( allocation_table->table_sector_identifiers != NULL )
+	{
+		memory_free(
+		 allocation_table->table_sector_identifiers );
+
+		allocation_table->table_sector_identifiers = NULL;
+	}
+	allocation_table->number_of_table_sectors = 0;
+	allocation_table->file_io_handle          = NULL;
+
+	return( 1 );
+}
+
+/* Stores the sector identifiers run-length encoded
+ * Consecutive entries that refer to consecutive sectors, such as the sectors
+ * of a contiguous chain, or that have the same sector identifier, such as
+ * free sectors, are stored as a single run
+ * The sector identifiers are only stored run-length encoded if this reduces
+ * the memory used, table sectors that are read on demand are not supported
+ * Returns 1 if successful, 0 if not stored run-length encoded or -1 on error
+ */
+int libolecf_allocation_table_compact(
+     libolecf_allocation_table_t *allocation_table,
+     libcerror_error_t **error )
+{
+	libolecf_allocation_table_run_t *runs = NULL;
+	static char *function                 = "libolecf_allocation_table_compact";
+	size_t runs_size                      = 0;
+	uint32_t sector_identifier            = 0;
+	int entry_index                       = 0;
+	int number_of_runs                    = 0;
+	int pass_index                        = 0;
+	int run_entry_index                   = 0;
+	int run_index                         = 0;
+	uint8_t is_consecutive                = 0;
+
+	if( allocation_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( allocation_table->sector_identifiers == NULL )
+	 || ( allocation_table->table_sector_identifiers != NULL ) )
+	{
+		return( 0 );
+	}
+	/* Determine the number of runs first to determine if run-length encoding
+	 * reduces the memory used
+	 */
+	for( pass_index = 0;
+	     pass_index < 2;
+	     pass_index++ )
+	{
+		entry_index = 0;
+		run_index   = 0;
+
+		while( entry_index < allocation_table->number_of_sector_identifiers )
+		{
+			run_entry_index   = entry_index;
+			sector_identifier = allocation_table->sector_identifiers[ entry_index ];
+			is_consecutive    = 0;
+
+			entry_index++;
+
+			/* Consecutive runs never contain the special sector identifiers
+			 * such as unused and end of chain
+			 */
+			if( ( entry_index < allocation_table->number_of_sector_identifiers )
+			 && ( sector_identifier < LIBOLECF_SECTOR_IDENTIFIER_MSAT ) )
+			{
+				if( allocation_table->sector_identifiers[ entry_index ] == ( sector_identifier + 1 ) )
+				{
+					is_consecutive = 1;
+				}
+			}
+			if( is_consecutive != 0 )
+			{
+				while( ( entry_index < allocation_table->number_of_sector_identifiers )
+				    && ( allocation_table->sector_identifiers[ entry_index ] < LIBOLECF_SECTOR_IDENTIFIER_MSAT )
+				    && ( allocation_table->sector_identifiers[ entry_index ] == ( sector_identifier + (uint32_t) ( entry_index - run_entry_index ) ) ) )
+				{
+					entry_index++;
+				}
+			}
+			else
+			{
+				while( ( entry_index < allocation_table->number_of_sector_identifiers )
+				    && ( allocation_table->sector_identifiers[ entry_index ] == sector_identifier ) )
+				{
+					entry_index++;
+				}
+			}
+			if( runs != NULL )
+			{
+				runs[ run_index ].entry_index       = (uint32_t) run_entry_index;
+				runs[ run_index ].sector_identifier = sector_identifier;
+				runs[ run_index ].is_consecutive    = is_consecutive;
+			}
+			run_index++;
+		}
+		if( runs != NULL )
+		{
+			break;
+		}
+		number_of_runs = run_index;
+
+		runs_size = sizeof( libolecf_allocation_table_run_t ) * (size_t) number_of_runs;
+
+		if( runs_size >= ( sizeof( uint32_t ) * (size_t) allocation_table->number_of_sector_identifiers ) )
+		{
+			return( 0 );
+		}
+		runs = (libolecf_allocation_table_run_t *) memory_allocate(
+		                                            runs_size );
+
+		if( runs == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create runs.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	memory_free(
+	 allocation_table->sector_identifiers );
+
+	allocation_table->sector_identifiers = NULL;
+	allocation_table->runs               = runs;
+	allocation_table->number_of_runs     = number_of_runs;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the memory used by the allocation table
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_allocation_table_get_memory_size(
+     libolecf_allocation_table_t *allocation_table,
+     size_t *memory_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_allocation_table_get_memory_size";
+	size_t safe_size      = 0;
+
+	if( allocation_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_size = sizeof( libolecf_allocation_table_t );
+
+	if( allocation_table->sector_identifiers != NULL )
+	{
+		safe_size += sizeof( uint32_t ) * (size_t) allocation_table->number_of_sector_identifiers;
+	}
+	if( allocation_table->runs != NULL )
+	{
+		safe_size += sizeof( libolecf_allocation_table_run_t ) * (size_t) allocation_table->number_of_runs;
+	}
+	if( allocation_table->table_sector_identifiers != NULL )
+	{
+		safe_size += sizeof( uint32_t ) * (size_t) allocation_table->number_of_table_sectors;
+	}
+	if( allocation_table->table_sector_read_flags != NULL )
+	{
+		safe_size += sizeof( uint8_t ) * (size_t) allocation_table->number_of_table_sectors;
+	}
+	*memory_size = safe_size;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the run that contains a specific entry
+ * The allocation table must contain runs and the entry index must be valid
+ * Returns the run index
+ */
+int libolecf_allocation_table_get_run_index_by_entry_index(
+     libolecf_allocation_table_t *allocation_table,
+     int entry_index )
+{
+	int run_index             = 0;
+	int run_index_lower_bound = 0;
+	int run_index_upper_bound = allocation_table->number_of_runs;
+
+	/* Find the last run that starts at or before the entry
+	 */
+	while( ( run_index_upper_bound - run_index_lower_bound ) > 1 )
+	{
+		run_index = run_index_lower_bound + ( ( run_index_upper_bound - run_index_lower_bound ) / 2 );
+
+		if( allocation_table->runs[ run_index ].entry_index <= (uint32_t) entry_index )
+		{
+			run_index_lower_bound = run_index;
+		}
+		else
+		{
+			run_index_upper_bound = run_index;
+		}
+	}
+	return( run_index_lower_bound );
+}
+
+/* Scans sector identifiers for the first entry that either matches or does not match
+ * a specific sector identifier
+ * The vector width, AVX2 or SSE2, is determined at compile time
+ * Returns the index of the entry or end_index if no such entry
+ */
+int libolecf_allocation_table_scan_sector_identifiers(
+     const uint32_t *sector_identifiers,
+     int start_index,
+     int end_index,
+     uint32_t sector_identifier,
+     uint8_t match )
+{
+#if defined( __AVX2__ )
+	__m256i compare_vector  = _mm256_set1_epi32( (int) sector_identifier );
+	__m256i values_vector;
+	int compare_mask        = 0;
+#elif defined( LIBOLECF_ALLOCATION_TABLE_HAVE_SSE2 )
+	__m128i compare_vector  = _mm_set1_epi32( (int) sector_identifier );
+	__m128i values_vector;
+	int compare_mask        = 0;
+#endif
+	int entry_index         = start_index;
+
+#if defined( __AVX2__ )
+	/* Compare 8 sector identifiers at a time and only fall back to a per entry
+	 * comparison for the block that contains the entry
+	 */
+	while( ( entry_index + 8 ) <= end_index )
+	{
+		values_vector = _mm256_loadu_si256(
+		                 (const __m256i *) &( sector_identifiers[ entry_index ] ) );
+
+		compare_mask = _mm256_movemask_ps(
+		                _mm256_castsi256_ps(
+		                 _mm256_cmpeq_epi32(
+		                  values_vector,
+		                  compare_vector ) ) );
+
+		if( match == 0 )
+		{
+			compare_mask ^= 0xff;
+		}
+		if( compare_mask != 0 )
+		{
+			break;
+		}
+		entry_index += 8;
+	}
+#elif defined( LIBOLECF_ALLOCATION_TABLE_HAVE_SSE2 )
+	/* Compare 4 sector identifiers at a time and only fall back to a per entry
+	 * comparison for the block that contains the entry
+	 */
+	while( ( entry_index + 4 ) <= end_index )
+	{
+		values_vector = _mm_loadu_si128(
+		                 (const __m128i *) &( sector_identifiers[ entry_index ] ) );
+
+		compare_mask = _mm_movemask_ps(
+		                _mm_castsi128_ps(
+		                 _mm_cmpeq_epi32(
+		                  values_vector,
+		                  compare_vector ) ) );
+
+		if( match == 0 )
+		{
+			compare_mask ^= 0x0f;
+		}
+		if( compare_mask != 0 )
+		{
+			break;
+		}
+		entry_index += 4;
+	}
+#endif
+	while( entry_index < end_index )
+	{
+		if( ( sector_identifiers[ entry_index ] == sector_identifier ) == ( match != 0 ) )
+		{
+			break;
+		}
+		entry_index++;
+	}
+	return( entry_index );
+}
+
+/* Retrieves the first range of unused sectors at or after a specific entry
+ * Table sectors that are read on demand are read if necessary
+ * Returns 1 if successful, 0 if no such range or -1 on error
+ */
+int libolecf_allocation_table_get_unused_range(
+     libolecf_allocation_table_t *allocation_table,
+     int entry_index,
+     int *range_entry_index,
+     int *range_number_of_entries,
+     libcerror_error_t **error )
+{
+	libolecf_allocation_table_run_t *run = NULL;
+	static char *function                = "libolecf_allocation_table_get_unused_range";
+	int range_end_index                  = 0;
+	int range_start_index                = 0;
+	int run_end_index                    = 0;
+	int run_index                        = 0;
+	int run_unused_end_index             = 0;
+	int table_sector_index               = 0;
+
+	if( allocation_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation table.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index >= allocation_table->number_of_sector_identifiers )
+	{
+		return( 0 );
+	}
+	if( allocation_table->table_sector_read_flags != NULL )
+	{
+		for( table_sector_index = entry_index / (int) ( allocation_table->sector_size / 4 );
+		     table_sector_index < allocation_table->number_of_table_sectors;
+		     table_sector_index++ )
+		{
+			if( allocation_table->table_sector_read_flags[ table_sector_index ] != 0 )
+			{
+				continue;
+			}
+			if( libolecf_allocation_table_read_table_sector(
+			     allocation_table,
+			     table_sector_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read table sector: %d.",
+				 function,
+				 table_sector_index );
+
+				return( -1 );
+			}
+		}
+	}
+	if( allocation_table->runs != NULL )
+	{
+		range_start_index = allocation_table->number_of_sector_identifiers;
+		range_end_index   = allocation_table->number_of_sector_identifiers;
+
+		for( run_index = libolecf_allocation_table_get_run_index_by_entry_index(
+		                  allocation_table,
+		                  entry_index );
+		     run_index < allocation_table->number_of_runs;
+		     run_index++ )
+		{
+			run = &( allocation_table->runs[ run_index ] );
+
+			if( ( run_index + 1 ) < allocation_table->number_of_runs )
+			{
+				run_end_index = (int) allocation_table->runs[ run_index + 1 ].entry_index;
+			}
+			else
+			{
+				run_end_index = allocation_table->number_of_sector_identifiers;
+			}
+			/* Consecutive runs do not contain unused sector identifiers
+			 */
+			if( ( run->is_consecutive != 0 )
+			 || ( run->sector_identifier != LIBOLECF_SECTOR_IDENTIFIER_UNUSED ) )
+			{
+				run_unused_end_index = (int) run->entry_index;
+			}
+			else
+			{
+				run_unused_end_index = run_end_index;
+			}
+			if( range_start_index < allocation_table->number_of_sector_identifiers )
+			{
+				if( run_unused_end_index == (int) run->entry_index )
+				{
+					break;
+				}
+				range_end_index = run_unused_end_index;
+			}
+			else if( ( run_unused_end_index > (int) run->entry_index )
+			      && ( run_unused_end_index > entry_index ) )
+			{
+				range_start_index = (int) run->entry_index;
+
+				if( range_start_index < entry_index )
+				{
+					range_start_index = entry_index;
+				}
+				range_end_index = run_unused_end_index;
+			}
+			if( ( range_start_index < allocation_table->number_of_sector_identifiers )
+			 && ( run_unused_end_index < run_end_index ) )
+			{
+				break;
+			}
+		}
+	}
+	else
+	{
+		range_start_index = libolecf_allocation_table_scan_sector_identifiers(
+		                     allocation_table->sector_identifiers,
+		                     entry_index,
+		                     allocation_table->number_of_sector_identifiers,
+		                     LIBOLECF_SECTOR_IDENTIFIER_UNUSED,
+		                     1 );
+
+		range_end_index = libolecf_allocation_table_scan_sector_identifiers(
+		                   allocation_table->sector_identifiers,
+		                   range_start_index,
+		                   allocation_table->number_of_sector_identifiers,
+		                   LIBOLECF_SECTOR_IDENTIFIER_UNUSED,
+		                   0 );
+	}
+	if( range_start_index >= allocation_table->number_of_sector_identifiers )
+	{
+		return( 0 );
+	}
+	*range_entry_index       = range_start_index;
+	*range_number_of_entries = range_end_index - range_start_index;
+
+	return( 1 );
+}
+
 /* Retrieves a specific sector identifier from the allocation table
+ * The table sector that contains the entry is read on demand if needed
  * Returns 1 if successful or -1 on error
  */
 int libolecf_allocation_table_get_sector_identifier_by_index(
@@ -276,7 +1207,10 @@ int libolecf_allocation_table_get_sector_identifier_by_index(
      uint32_t *sector_identifier,
      libcerror_error_t **error )
 {
-	static char *function = "libolecf_allocation_table_resize";
+	libolecf_allocation_table_run_t *run = NULL;
+	static char *function                = "libolecf_allocation_table_get_sector_identifier_by_index";
+	int run_index                        = 0;
+	int table_sector_index               = 0;
 
 	if( allocation_table == NULL )
 	{
@@ -312,6 +1246,48 @@ int libolecf_allocation_table_get_sector_identifier_by_index(
 
 		return( -1 );
 	}
+	if( allocation_table->table_sector_read_flags != NULL )
+	{
+		table_sector_index = entry_index / (int) ( allocation_table->sector_size / 4 );
+
+		if( ( table_sector_index < allocation_table->number_of_table_sectors )
+		 && ( allocation_table->table_sector_read_flags[ table_sector_index ] == 0 ) )
+		{
+			if( libolecf_allocation_table_read_table_sector(
+			     allocation_table,
+			     table_sector_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read table sector: %d.",
+				 function,
+				 table_sector_index );
+
+				return( -1 );
+			}
+		}
+	}
+	if( allocation_table->runs != NULL )
+	{
+		run_index = libolecf_allocation_table_get_run_index_by_entry_index(
+		             allocation_table,
+		             entry_index );
+
+		run = &( allocation_table->runs[ run_index ] );
+
+		if( run->is_consecutive != 0 )
+		{
+			*sector_identifier = run->sector_identifier + ( (uint32_t) entry_index - run->entry_index );
+		}
+		else
+		{
+			*sector_identifier = run->sector_identifier;
+		}
+		return( 1 );
+	}
 	*sector_identifier = allocation_table->sector_identifiers[ entry_index ];
 
 	return( 1 );
@@ -25,12 +25,31 @@
 #include <common.h>
 #include <types.h>
 
+#include "libolecf_libbfio.h"
 #include "libolecf_libcerror.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+typedef struct libolecf_allocation_table_run libolecf_allocation_table_run_t;
+
+struct libolecf_allocation_table_run
+{
+	/* The index of the first entry in the run
+	 */
+	uint32_t entry_index;
+
+	/* The sector identifier of the first entry in the run
+	 */
+	uint32_t sector_identifier;
+
+	/* Value to indicate the sector identifiers in the run are consecutive
+	 * otherwise all entries in the run have the same sector identifier
+	 */
+	uint8_t is_consecutive;
+};
+
 typedef struct libolecf_allocation_table libolecf_allocation_table_t;
 
 struct libolecf_allocation_table
@@ -40,8 +59,42 @@ struct libolecf_allocation_table
 	int number_of_sector_identifiers;
 
 	/* The sector identifiers
+	 * NULL if the sector identifiers are stored run-length encoded
 	 */
 	uint32_t *sector_identifiers;
+
+	/* The number of runs
+	 */
+	int number_of_runs;
+
+	/* The runs of the run-length encoded sector identifiers
+	 */
+	libolecf_allocation_table_run_t *runs;
+
+	/* The file IO handle used to read the table sectors on demand
+	 * or NULL if all table sectors were read
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The number of table sectors
+	 */
+	int number_of_table_sectors;
+
+	/* The table sector identifiers
+	 */
+	uint32_t *table_sector_identifiers;
+
+	/* Per table sector value to indicate if the sector was read
+	 */
+	uint8_t *table_sector_read_flags;
+
+	/* The (table) sector size
+	 */
+	size_t sector_size;
+
+	/* The byte order of the table data
+	 */
+	uint8_t byte_order;
 };
 
 int libolecf_allocation_table_initialize(
@@ -58,6 +111,51 @@ int libolecf_allocation_table_resize(
      int number_of_sector_identifiers,
      libcerror_error_t **error );
 
+int libolecf_allocation_table_set_table_sectors(
+     libolecf_allocation_table_t *allocation_table,
+     libbfio_handle_t *file_io_handle,
+     const uint32_t *table_sector_identifiers,
+     int number_of_table_sectors,
+     size_t sector_size,
+     uint8_t byte_order,
+     libcerror_error_t **error );
+
+int libolecf_allocation_table_read_table_sector(
+     libolecf_allocation_table_t *allocation_table,
+     int table_sector_index,
+     libcerror_error_t **error );
+
+int libolecf_allocation_table_read_all_table_sectors(
+     libolecf_allocation_table_t *allocation_table,
+     libcerror_error_t **error );
+
+int libolecf_allocation_table_compact(
+     libolecf_allocation_table_t *allocation_table,
+     libcerror_error_t **error );
+
+int libolecf_allocation_table_get_memory_size(
+     libolecf_allocation_table_t *allocation_table,
+     size_t *memory_size,
+     libcerror_error_t **error );
+
+int libolecf_allocation_table_get_run_index_by_entry_index(
+     libolecf_allocation_table_t *allocation_table,
+     int entry_index );
+
+int libolecf_allocation_table_scan_sector_identifiers(
+     const uint32_t *sector_identifiers,
+     int start_index,
+     int end_index,
+     uint32_t sector_identifier,
+     uint8_t match );
+
+int libolecf_allocation_table_get_unused_range(
+     libolecf_allocation_table_t *allocation_table,
+     int entry_index,
+     int *range_entry_index,
+     int *range_number_of_entries,
+     libcerror_error_t **error );
+
 int libolecf_allocation_table_get_sector_identifier_by_index(
      libolecf_allocation_table_t *allocation_table,
      int entry_index,
@@ -0,0 +1,623 @@
+/*
+ * Block cache functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libolecf_block_cache.h"
+#include "libolecf_libcerror.h"
+
+/* Creates a block cache
+ * Make sure the value block_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_block_cache_initialize(
+     libolecf_block_cache_t **block_cache,
+     int number_of_entries,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_block_cache_initialize";
+	size_t data_size      = 0;
+	int entry_index       = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries <= 0 )
+	 || ( (size_t) number_of_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libolecf_block_cache_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) SSIZE_MAX )
+	 || ( block_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / (size_t) number_of_entries ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*block_cache = memory_allocate_structure(
+	                libolecf_block_cache_t );
+
+	if( *block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *block_cache,
+	     0,
+	     sizeof( libolecf_block_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block cache.",
+		 function );
+
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+
+		return( -1 );
+	}
+	( *block_cache )->entries = (libolecf_block_cache_entry_t *) memory_allocate(
+	                                                              sizeof( libolecf_block_cache_entry_t ) * number_of_entries );
+
+	if( ( *block_cache )->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	( *block_cache )->buckets = (int *) memory_allocate(
+	                                     sizeof( int ) * number_of_entries );
+
+	if( ( *block_cache )->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	data_size = block_size * (size_t) number_of_entries;
+
+	( *block_cache )->data = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * data_size );
+
+	if( ( *block_cache )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		( *block_cache )->entries[ entry_index ].file_offset          = -1;
+		( *block_cache )->entries[ entry_index ].data_size            = 0;
+		( *block_cache )->entries[ entry_index ].next_in_bucket_index = -1;
+		( *block_cache )->entries[ entry_index ].previous_index       = -1;
+		( *block_cache )->entries[ entry_index ].next_index           = -1;
+
+		( *block_cache )->buckets[ entry_index ] = -1;
+	}
+	( *block_cache )->block_size                = block_size;
+	( *block_cache )->number_of_entries         = number_of_entries;
+	( *block_cache )->most_recently_used_index  = -1;
+	( *block_cache )->least_recently_used_index = -1;
+
+	return( 1 );
+
+on_error:
+	if( *block_cache != NULL )
+	{
+		if( ( *block_cache )->buckets != NULL )
+		{
+			memory_free(
+			 ( *block_cache )->buckets );
+		}
+		if( ( *block_cache )->entries != NULL )
+		{
+			memory_free(
+			 ( *block_cache )->entries );
+		}
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a block cache
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_block_cache_free(
+     libolecf_block_cache_t **block_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_block_cache_free";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache != NULL )
+	{
+		if( ( *block_cache )->data != NULL )
+		{
+			memory_free(
+			 ( *block_cache )->data );
+		}
+		if( ( *block_cache )->buckets != NULL )
+		{
+			memory_free(
+			 ( *block_cache )->buckets );
+		}
+		if( ( *block_cache )->entries != NULL )
+		{
+			memory_free(
+			 ( *block_cache )->entries );
+		}
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+	}
+	return( 1 );
+}
+
+/* Removes an entry from the list of recently used entries
+ */
+void libolecf_block_cache_unlink_entry(
+      libolecf_block_cache_t *block_cache,
+      int entry_index )
+{
+	libolecf_block_cache_entry_t *entry = &( block_cache->entries[ entry_index ] );
+
+	if( entry->previous_index != -1 )
+	{
+		block_cache->entries[ entry->previous_index ].next_index = entry->next_index;
+	}
+	else if( block_cache->most_recently_used_index == entry_index )
+	{
+		block_cache->most_recently_used_index = entry->next_index;
+	}
+	if( entry->next_index != -1 )
+	{
+		block_cache->entries[ entry->next_index ].previous_index = entry->previous_index;
+	}
+	else if( block_cache->least_recently_used_index == entry_index )
+	{
+		block_cache->least_recently_used_index = entry->previous_index;
+	}
+	entry->previous_index = -1;
+	entry->next_index     = -1;
+}
+
+/* Inserts an entry at the start (most recently used) or end (least recently used)
+ * of the list of recently used entries
+ */
+void libolecf_block_cache_link_entry(
+      libolecf_block_cache_t *block_cache,
+      int entry_index,
+      uint8_t most_recently_used )
+{
+	libolecf_block_cache_entry_t *entry = &( block_cache->entries[ entry_index ] );
+
+	if( most_recently_used != 0 )
+	{
+		entry->previous_index = -1;
+		entry->next_index     = block_cache->most_recently_used_index;
+
+		if( block_cache->most_recently_used_index != -1 )
+		{
+			block_cache->entries[ block_cache->most_recently_used_index ].previous_index = entry_index;
+		}
+		block_cache->most_recently_used_index = entry_index;
+
+		if( block_cache->least_recently_used_index == -1 )
+		{
+			block_cache->least_recently_used_index = entry_index;
+		}
+	}
+	else
+	{
+		entry->previous_index = block_cache->least_recently_used_index;
+		entry->next_index     = -1;
+
+		if( block_cache->least_recently_used_index != -1 )
+		{
+			block_cache->entries[ block_cache->least_recently_used_index ].next_index = entry_index;
+		}
+		block_cache->least_recently_used_index = entry_index;
+
+		if( block_cache->most_recently_used_index == -1 )
+		{
+			block_cache->most_recently_used_index = entry_index;
+		}
+	}
+}
+
+/* Retrieves the index of the entry that contains the block at a specific file offset
+ * Returns the entry index or -1 if the block is not cached
+ */
+int libolecf_block_cache_find_entry(
+     libolecf_block_cache_t *block_cache,
+     off64_t file_offset )
+{
+	int bucket_index = 0;
+	int entry_index  = 0;
+
+	bucket_index = (int) ( ( (size64_t) file_offset / block_cache->block_size ) % (size64_t) block_cache->number_of_entries );
+
+	for( entry_index = block_cache->buckets[ bucket_index ];
+	     entry_index != -1;
+	     entry_index = block_cache->entries[ entry_index ].next_in_bucket_index )
+	{
+		if( block_cache->entries[ entry_index ].file_offset == file_offset )
+		{
+			break;
+		}
+	}
+	return( entry_index );
+}
+
+/* Retrieves an entry to store a block
+ * An unused entry is used first, otherwise the least recently used entry is replaced
+ * The entry is removed from the list of recently used entries and from its bucket
+ * Returns the entry index
+ */
+int libolecf_block_cache_reuse_entry(
+     libolecf_block_cache_t *block_cache )
+{
+	libolecf_block_cache_entry_t *entry = NULL;
+	int bucket_index                    = 0;
+	int entry_index                     = 0;
+
+	if( block_cache->number_of_used_entries < block_cache->number_of_entries )
+	{
+		entry_index = block_cache->number_of_used_entries;
+
+		block_cache->number_of_used_entries += 1;
+	}
+	else
+	{
+		entry_index = block_cache->least_recently_used_index;
+
+		libolecf_block_cache_unlink_entry(
+		 block_cache,
+		 entry_index );
+	}
+	entry = &( block_cache->entries[ entry_index ] );
+
+	if( entry->file_offset != -1 )
+	{
+		/* Remove the entry from the bucket of the block it previously contained
+		 */
+		bucket_index = (int) ( ( (size64_t) entry->file_offset / block_cache->block_size ) % (size64_t) block_cache->number_of_entries );
+
+		if( block_cache->buckets[ bucket_index ] == entry_index )
+		{
+			block_cache->buckets[ bucket_index ] = entry->next_in_bucket_index;
+		}
+		else
+		{
+			for( bucket_index = block_cache->buckets[ bucket_index ];
+			     bucket_index != -1;
+			     bucket_index = block_cache->entries[ bucket_index ].next_in_bucket_index )
+			{
+				if( block_cache->entries[ bucket_index ].next_in_bucket_index == entry_index )
+				{
+					block_cache->entries[ bucket_index ].next_in_bucket_index = entry->next_in_bucket_index;
+
+					break;
+				}
+			}
+		}
+		entry->file_offset          = -1;
+		entry->data_size            = 0;
+		entry->next_in_bucket_index = -1;
+	}
+	return( entry_index );
+}
+
+/* Inserts an entry that contains the block at a specific file offset
+ * into its bucket and as the most recently used entry
+ */
+void libolecf_block_cache_insert_entry(
+      libolecf_block_cache_t *block_cache,
+      int entry_index,
+      off64_t file_offset,
+      size_t data_size )
+{
+	libolecf_block_cache_entry_t *entry = &( block_cache->entries[ entry_index ] );
+	int bucket_index                    = 0;
+
+	bucket_index = (int) ( ( (size64_t) file_offset / block_cache->block_size ) % (size64_t) block_cache->number_of_entries );
+
+	entry->file_offset          = file_offset;
+	entry->data_size            = data_size;
+	entry->next_in_bucket_index = block_cache->buckets[ bucket_index ];
+
+	block_cache->buckets[ bucket_index ] = entry_index;
+
+	libolecf_block_cache_link_entry(
+	 block_cache,
+	 entry_index,
+	 1 );
+}
+
+/* Retrieves the data of the cached block at a specific file offset
+ * The file offset must be a multiple of the block size
+ * The data remains valid until the next call to the block cache
+ * Returns 1 if successful, 0 if the block is not cached or -1 on error
+ */
+int libolecf_block_cache_get_cached_block(
+     libolecf_block_cache_t *block_cache,
+     off64_t file_offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_block_cache_get_cached_block";
+	int entry_index       = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_offset < 0 )
+	 || ( ( (size64_t) file_offset % block_cache->block_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = libolecf_block_cache_find_entry(
+	               block_cache,
+	               file_offset );
+
+	if( entry_index == -1 )
+	{
+		block_cache->number_of_misses += 1;
+
+		return( 0 );
+	}
+	block_cache->number_of_hits += 1;
+
+	if( block_cache->most_recently_used_index != entry_index )
+	{
+		libolecf_block_cache_unlink_entry(
+		 block_cache,
+		 entry_index );
+
+		libolecf_block_cache_link_entry(
+		 block_cache,
+		 entry_index,
+		 1 );
+	}
+	*data      = &( block_cache->data[ (size_t) entry_index * block_cache->block_size ] );
+	*data_size = block_cache->entries[ entry_index ].data_size;
+
+	return( 1 );
+}
+
+/* Sets the data of the block at a specific file offset
+ * The file offset must be a multiple of the block size
+ * The data is copied into the cache, the least recently used block is replaced
+ * A block that is already cached is not changed
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_block_cache_set_block(
+     libolecf_block_cache_t *block_cache,
+     off64_t file_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_block_cache_set_block";
+	int entry_index       = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_offset < 0 )
+	 || ( ( (size64_t) file_offset % block_cache->block_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > block_cache->block_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Another reader can have cached the block after it was looked up
+	 */
+	if( libolecf_block_cache_find_entry(
+	     block_cache,
+	     file_offset ) != -1 )
+	{
+		return( 1 );
+	}
+	entry_index = libolecf_block_cache_reuse_entry(
+	               block_cache );
+
+	if( memory_copy(
+	     &( block_cache->data[ (size_t) entry_index * block_cache->block_size ] ),
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy block data.",
+		 function );
+
+		/* Make the unused entry the first to be replaced
+		 */
+		libolecf_block_cache_link_entry(
+		 block_cache,
+		 entry_index,
+		 0 );
+
+		return( -1 );
+	}
+	libolecf_block_cache_insert_entry(
+	 block_cache,
+	 entry_index,
+	 file_offset,
+	 data_size );
+
+	return( 1 );
+}
+
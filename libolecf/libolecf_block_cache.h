@@ -0,0 +1,155 @@
+/*
+ * Block cache functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBOLECF_BLOCK_CACHE_H )
+#define _LIBOLECF_BLOCK_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libolecf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libolecf_block_cache_entry libolecf_block_cache_entry_t;
+
+struct libolecf_block_cache_entry
+{
+	/* The file offset of the block or -1 if not set
+	 */
+	off64_t file_offset;
+
+	/* The block data size
+	 */
+	size_t data_size;
+
+	/* The index of the next entry in the same hash bucket or -1 if not set
+	 */
+	int next_in_bucket_index;
+
+	/* The index of the more recently used entry or -1 if not set
+	 */
+	int previous_index;
+
+	/* The index of the less recently used entry or -1 if not set
+	 */
+	int next_index;
+};
+
+typedef struct libolecf_block_cache libolecf_block_cache_t;
+
+struct libolecf_block_cache
+{
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of used entries
+	 */
+	int number_of_used_entries;
+
+	/* The entries
+	 */
+	libolecf_block_cache_entry_t *entries;
+
+	/* The hash buckets, that contain the index of the first entry in the bucket or -1 if not set
+	 */
+	int *buckets;
+
+	/* The data of the entries
+	 */
+	uint8_t *data;
+
+	/* The index of the most recently used entry or -1 if not set
+	 */
+	int most_recently_used_index;
+
+	/* The index of the least recently used entry or -1 if not set
+	 */
+	int least_recently_used_index;
+
+	/* The number of cache hits
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of cache misses
+	 */
+	uint64_t number_of_misses;
+};
+
+int libolecf_block_cache_initialize(
+     libolecf_block_cache_t **block_cache,
+     int number_of_entries,
+     size_t block_size,
+     libcerror_error_t **error );
+
+int libolecf_block_cache_free(
+     libolecf_block_cache_t **block_cache,
+     libcerror_error_t **error );
+
+void libolecf_block_cache_unlink_entry(
+      libolecf_block_cache_t *block_cache,
+      int entry_index );
+
+void libolecf_block_cache_link_entry(
+      libolecf_block_cache_t *block_cache,
+      int entry_index,
+      uint8_t most_recently_used );
+
+int libolecf_block_cache_find_entry(
+     libolecf_block_cache_t *block_cache,
+     off64_t file_offset );
+
+int libolecf_block_cache_reuse_entry(
+     libolecf_block_cache_t *block_cache );
+
+void libolecf_block_cache_insert_entry(
+      libolecf_block_cache_t *block_cache,
+      int entry_index,
+      off64_t file_offset,
+      size_t data_size );
+
+int libolecf_block_cache_get_cached_block(
+     libolecf_block_cache_t *block_cache,
+     off64_t file_offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libolecf_block_cache_set_block(
+     libolecf_block_cache_t *block_cache,
+     off64_t file_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBOLECF_BLOCK_CACHE_H ) */
+
@@ -27,12 +27,14 @@
 #include "libolecf_debug.h"
 #include "libolecf_definitions.h"
 #include "libolecf_directory_entry.h"
+#include "libolecf_extent_map.h"
 #include "libolecf_libcdata.h"
 #include "libolecf_libcerror.h"
 #include "libolecf_libcnotify.h"
 #include "libolecf_libfdatetime.h"
 #include "libolecf_libfguid.h"
 #include "libolecf_libuna.h"
+#include "libolecf_name_index.h"
 
 #include "olecf_directory.h"
 
@@ -117,6 +119,7 @@ int libolecf_directory_entry_free(
      libcerror_error_t **error )
 {
 	static char *function = "libolecf_directory_entry_free";
+	int result            = 1;
 
 	if( directory_entry == NULL )
 	{
@@ -131,6 +134,19 @@ int libolecf_directory_entry_free(
 	}
 	if( *directory_entry != NULL )
 	{
+		if( libolecf_directory_entry_clear(
+		     *directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear directory entry.",
+			 function );
+
+			result = -1;
+		}
 		if( ( *directory_entry )->name != NULL )
 		{
 			memory_free(
@@ -141,7 +157,7 @@ int libolecf_directory_entry_free(
 
 		*directory_entry = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Frees a directory entry that is not part of the directory tree
@@ -167,17 +183,235 @@ int libolecf_directory_entry_free_not_in_tree(
 	if( ( *directory_entry != NULL )
 	 && ( ( *directory_entry )->set_in_tree == 0 ) )
 	{
-		if( ( *directory_entry )->name != NULL )
+		if( libolecf_directory_entry_free(
+		     directory_entry,
+		     error ) != 1 )
 		{
-			memory_free(
-			 ( *directory_entry )->name );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory entry.",
+			 function );
+
+			return( -1 );
 		}
+	}
+	return( 1 );
+}
+
+/* Clears a directory entry
+ * Frees the values that were created on demand, the name is not freed
+ * since it can be managed by the directory table
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_directory_entry_clear(
+     libolecf_directory_entry_t *directory_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_directory_entry_clear";
+	int result            = 1;
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry->extent_map != NULL )
+	{
+		if( libolecf_extent_map_free(
+		     &( directory_entry->extent_map ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free extent map.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( directory_entry->sub_nodes_array != NULL )
+	{
+		/* The sub nodes are managed by the directory tree
+		 */
+		if( libcdata_array_free(
+		     &( directory_entry->sub_nodes_array ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub nodes array.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( directory_entry->sub_node_name_index != NULL )
+	{
+		if( libolecf_name_index_free(
+		     &( directory_entry->sub_node_name_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub node name index.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( directory_entry->utf8_name != NULL )
+	{
 		memory_free(
-		 *directory_entry );
+		 directory_entry->utf8_name );
 
-		*directory_entry = NULL;
+		directory_entry->utf8_name = NULL;
+	}
+	directory_entry->utf8_name_size = 0;
+
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded name
+ * The UTF-8 encoded name is created on first use and remains valid
+ * until the directory entry is freed
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_directory_entry_get_utf8_name(
+     libolecf_directory_entry_t *directory_entry,
+     uint8_t byte_order,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t *utf8_name    = NULL;
+	static char *function = "libolecf_directory_entry_get_utf8_name";
+	size_t utf8_name_size = 0;
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
 	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry->utf8_name == NULL )
+	{
+		if( libuna_utf8_string_size_from_utf16_stream(
+		     directory_entry->name,
+		     directory_entry->name_size,
+		     byte_order,
+		     &utf8_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine size of name as UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( utf8_name_size == 0 )
+		 || ( utf8_name_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-8 name size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		utf8_name = (uint8_t *) memory_allocate(
+		                         sizeof( uint8_t ) * utf8_name_size );
+
+		if( utf8_name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 name.",
+			 function );
+
+			goto on_error;
+		}
+		if( libuna_utf8_string_copy_from_utf16_stream(
+		     utf8_name,
+		     utf8_name_size,
+		     directory_entry->name,
+		     directory_entry->name_size,
+		     byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy name to UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+		directory_entry->utf8_name      = utf8_name;
+		directory_entry->utf8_name_size = utf8_name_size;
+	}
+	*utf8_string      = directory_entry->utf8_name;
+	*utf8_string_size = directory_entry->utf8_name_size;
+
 	return( 1 );
+
+on_error:
+	if( utf8_name != NULL )
+	{
+		memory_free(
+		 utf8_name );
+	}
+	return( -1 );
 }
 
 /* Compares two directory entries
@@ -224,6 +458,9 @@ int libolecf_directory_entry_compare(
 }
 
 /* Reads a directory entry
+ * If the name is set it refers to a buffer of name size bytes that is managed
+ * by the caller, such as the names data of the directory table, otherwise
+ * the name is allocated
  * Returns 1 if successful, 0 if empty or -1 on error
  */
 int libolecf_directory_entry_read_data(
@@ -234,6 +471,7 @@ int libolecf_directory_entry_read_data(
      uint8_t byte_order,
      libcerror_error_t **error )
 {
+	uint8_t *name           = NULL;
 	static char *function   = "libolecf_directory_entry_read_data";
 	uint16_t name_data_size = 0;
 
@@ -319,16 +557,31 @@ int libolecf_directory_entry_read_data(
 
 			goto on_error;
 		}
-		directory_entry->name = (uint8_t *) memory_allocate(
-		                                     sizeof( uint8_t ) * name_data_size );
-
 		if( directory_entry->name == NULL )
+		{
+			name = (uint8_t *) memory_allocate(
+			                    sizeof( uint8_t ) * name_data_size );
+
+			if( name == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create name.",
+				 function );
+
+				goto on_error;
+			}
+			directory_entry->name = name;
+		}
+		else if( (size_t) name_data_size > directory_entry->name_size )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create name.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: name byte size value exceeds name buffer size.",
 			 function );
 
 			goto on_error;
@@ -564,10 +817,10 @@ int libolecf_directory_entry_read_data(
 	return( 1 );
 
 on_error:
-	if( directory_entry->name != NULL )
+	if( name != NULL )
 	{
 		memory_free(
-		 directory_entry->name );
+		 name );
 
 		directory_entry->name = NULL;
 	}
@@ -25,7 +25,10 @@
 #include <common.h>
 #include <types.h>
 
+#include "libolecf_extent_map.h"
+#include "libolecf_libcdata.h"
 #include "libolecf_libcerror.h"
+#include "libolecf_name_index.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -43,6 +46,15 @@ struct libolecf_directory_entry
 	 */
 	size_t name_size;
 
+	/* The UTF-8 encoded directory name, created on first use
+	 */
+	uint8_t *utf8_name;
+
+	/* The size of the UTF-8 encoded directory name
+	 * including the end of string character
+	 */
+	size_t utf8_name_size;
+
 	/* Creation time
 	 */
 	uint64_t creation_time;
@@ -82,6 +94,34 @@ struct libolecf_directory_entry
 	/* Value to indicate the directory entry was set in the tree
 	 */
 	uint8_t set_in_tree;
+
+	/* Value to indicate the sub directory entries were added to the tree
+	 */
+	uint8_t sub_nodes_read;
+
+	/* The array of the sub nodes
+	 */
+	libcdata_array_t *sub_nodes_array;
+
+	/* The name index of the sub nodes
+	 */
+	libolecf_name_index_t *sub_node_name_index;
+
+	/* The extent map
+	 */
+	libolecf_extent_map_t *extent_map;
+
+	/* The stream offset following the last read
+	 */
+	off64_t next_read_offset;
+
+	/* The stream offset up to which read-ahead was advised
+	 */
+	off64_t read_ahead_offset;
+
+	/* The read-ahead window size
+	 */
+	size64_t read_ahead_size;
 };
 
 int libolecf_directory_entry_initialize(
@@ -96,6 +136,17 @@ int libolecf_directory_entry_free_not_in_tree(
      libolecf_directory_entry_t **directory_entry,
      libcerror_error_t **error );
 
+int libolecf_directory_entry_clear(
+     libolecf_directory_entry_t *directory_entry,
+     libcerror_error_t **error );
+
+int libolecf_directory_entry_get_utf8_name(
+     libolecf_directory_entry_t *directory_entry,
+     uint8_t byte_order,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 int libolecf_directory_entry_compare(
      libolecf_directory_entry_t *first_directory_entry,
      libolecf_directory_entry_t *second_directory_entry,
@@ -0,0 +1,542 @@
+/*
+ * Directory table functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libolecf_definitions.h"
+#include "libolecf_directory_entry.h"
+#include "libolecf_directory_table.h"
+#include "libolecf_libcerror.h"
+
+#include "olecf_directory.h"
+
+/* Creates a directory table
+ * Make sure the value directory_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_directory_table_initialize(
+     libolecf_directory_table_t **directory_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_directory_table_initialize";
+
+	if( directory_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*directory_table = memory_allocate_structure(
+	                    libolecf_directory_table_t );
+
+	if( *directory_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *directory_table,
+	     0,
+	     sizeof( libolecf_directory_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear directory table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *directory_table != NULL )
+	{
+		memory_free(
+		 *directory_table );
+
+		*directory_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a directory table
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_directory_table_free(
+     libolecf_directory_table_t **directory_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_directory_table_free";
+	int entry_index       = 0;
+	int result            = 1;
+
+	if( directory_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_table != NULL )
+	{
+		if( ( *directory_table )->entries != NULL )
+		{
+			for( entry_index = 0;
+			     entry_index < ( *directory_table )->number_of_entries;
+			     entry_index++ )
+			{
+				if( libolecf_directory_entry_clear(
+				     &( ( *directory_table )->entries[ entry_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to clear directory entry: %d.",
+					 function,
+					 entry_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *directory_table )->entries );
+		}
+		if( ( *directory_table )->names_data != NULL )
+		{
+			memory_free(
+			 ( *directory_table )->names_data );
+		}
+		memory_free(
+		 *directory_table );
+
+		*directory_table = NULL;
+	}
+	return( result );
+}
+
+/* Reads the directory table
+ * The data contains the directory entries of the directory sector chain
+ * The directory entries are stored in a single allocation and their names
+ * in a single names data allocation
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_directory_table_read_data(
+     libolecf_directory_table_t *directory_table,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t byte_order,
+     libcerror_error_t **error )
+{
+	libolecf_directory_entry_t *directory_entry = NULL;
+	const uint8_t *directory_entry_data         = NULL;
+	static char *function                       = "libolecf_directory_table_read_data";
+	size_t entries_size                         = 0;
+	size_t names_data_offset                    = 0;
+	size_t names_data_size                      = 0;
+	uint16_t name_data_size                     = 0;
+	int entry_index                             = 0;
+	int number_of_entries                       = 0;
+
+	if( directory_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory table.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_table->entries != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory table - entries value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size > (size_t) SSIZE_MAX )
+	 || ( ( data_size % sizeof( olecf_directory_entry_t ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_order != LIBOLECF_ENDIAN_BIG )
+	 && ( byte_order != LIBOLECF_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size / sizeof( olecf_directory_entry_t ) ) > (size_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_entries = (int) ( data_size / sizeof( olecf_directory_entry_t ) );
+
+	if( number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	/* Determine the size of the names data up front so that the name of
+	 * every directory entry can refer into a single allocation
+	 */
+	directory_entry_data = data;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( ( (olecf_directory_entry_t *) directory_entry_data )->type != LIBOLECF_ITEM_TYPE_EMPTY )
+		{
+			if( byte_order == LIBOLECF_ENDIAN_LITTLE )
+			{
+				byte_stream_copy_to_uint16_little_endian(
+				 ( (olecf_directory_entry_t *) directory_entry_data )->name_data_size,
+				 name_data_size );
+			}
+			else
+			{
+				byte_stream_copy_to_uint16_big_endian(
+				 ( (olecf_directory_entry_t *) directory_entry_data )->name_data_size,
+				 name_data_size );
+			}
+			/* Values that are out of bounds are reported when the directory entry is read
+			 */
+			if( (size_t) name_data_size <= sizeof( olecf_directory_entry_t ) )
+			{
+				names_data_size += name_data_size;
+			}
+		}
+		directory_entry_data += sizeof( olecf_directory_entry_t );
+	}
+	entries_size = sizeof( libolecf_directory_entry_t ) * (size_t) number_of_entries;
+
+	if( ( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	 || ( names_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid directory table size value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	directory_table->entries = (libolecf_directory_entry_t *) memory_allocate(
+	                                                           entries_size );
+
+	if( directory_table->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     directory_table->entries,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( names_data_size > 0 )
+	{
+		directory_table->names_data = (uint8_t *) memory_allocate(
+		                                           sizeof( uint8_t ) * names_data_size );
+
+		if( directory_table->names_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create names data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	directory_table->number_of_entries = number_of_entries;
+	directory_table->names_data_size   = names_data_size;
+
+	directory_entry_data = data;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		directory_entry = &( directory_table->entries[ entry_index ] );
+
+		/* The name of the directory entry refers to the remainder of the names data
+		 */
+		if( names_data_offset < names_data_size )
+		{
+			directory_entry->name      = &( directory_table->names_data[ names_data_offset ] );
+			directory_entry->name_size = names_data_size - names_data_offset;
+		}
+		if( libolecf_directory_entry_read_data(
+		     directory_entry,
+		     entry_index,
+		     directory_entry_data,
+		     sizeof( olecf_directory_entry_t ),
+		     byte_order,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( ( directory_entry->type == LIBOLECF_ITEM_TYPE_EMPTY )
+		 || ( directory_entry->name_size == 0 ) )
+		{
+			directory_entry->name      = NULL;
+			directory_entry->name_size = 0;
+		}
+		names_data_offset += directory_entry->name_size;
+
+		directory_entry_data += sizeof( olecf_directory_entry_t );
+	}
+	return( 1 );
+
+on_error:
+	if( directory_table->names_data != NULL )
+	{
+		memory_free(
+		 directory_table->names_data );
+
+		directory_table->names_data = NULL;
+	}
+	if( directory_table->entries != NULL )
+	{
+		memory_free(
+		 directory_table->entries );
+
+		directory_table->entries = NULL;
+	}
+	directory_table->number_of_entries = 0;
+	directory_table->names_data_size   = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the number of directory entries
+ * The number includes the empty directory entries
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_directory_table_get_number_of_entries(
+     libolecf_directory_table_t *directory_table,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_directory_table_get_number_of_entries";
+
+	if( directory_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory table.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = directory_table->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific directory entry
+ * Returns 1 if successful, 0 if not found or empty or -1 on error
+ */
+int libolecf_directory_table_get_entry_by_identifier(
+     libolecf_directory_table_t *directory_table,
+     uint32_t directory_identifier,
+     libolecf_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_directory_table_get_entry_by_identifier";
+
+	if( directory_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory table.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	*directory_entry = NULL;
+
+	if( directory_identifier >= (uint32_t) directory_table->number_of_entries )
+	{
+		return( 0 );
+	}
+	if( directory_table->entries[ directory_identifier ].type == LIBOLECF_ITEM_TYPE_EMPTY )
+	{
+		return( 0 );
+	}
+	*directory_entry = &( directory_table->entries[ directory_identifier ] );
+
+	return( 1 );
+}
+
+/* Marks the sub nodes of all the directory entries as read
+ * This prevents sub nodes from being created on demand once the directory tree was fully created
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_directory_table_set_sub_nodes_read(
+     libolecf_directory_table_t *directory_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_directory_table_set_sub_nodes_read";
+	int entry_index       = 0;
+
+	if( directory_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory table.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < directory_table->number_of_entries;
+	     entry_index++ )
+	{
+		directory_table->entries[ entry_index ].sub_nodes_read = 1;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,94 @@
+/*
+ * Directory table functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBOLECF_DIRECTORY_TABLE_H )
+#define _LIBOLECF_DIRECTORY_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libolecf_directory_entry.h"
+#include "libolecf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libolecf_directory_table libolecf_directory_table_t;
+
+struct libolecf_directory_table
+{
+	/* The directory entries
+	 * stored contiguously and indexed by directory identifier
+	 */
+	libolecf_directory_entry_t *entries;
+
+	/* The number of directory entries
+	 */
+	int number_of_entries;
+
+	/* The names data
+	 * contains the names of all the directory entries
+	 */
+	uint8_t *names_data;
+
+	/* The names data size
+	 */
+	size_t names_data_size;
+};
+
+int libolecf_directory_table_initialize(
+     libolecf_directory_table_t **directory_table,
+     libcerror_error_t **error );
+
+int libolecf_directory_table_free(
+     libolecf_directory_table_t **directory_table,
+     libcerror_error_t **error );
+
+int libolecf_directory_table_read_data(
+     libolecf_directory_table_t *directory_table,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t byte_order,
+     libcerror_error_t **error );
+
+int libolecf_directory_table_get_number_of_entries(
+     libolecf_directory_table_t *directory_table,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libolecf_directory_table_get_entry_by_identifier(
+     libolecf_directory_table_t *directory_table,
+     uint32_t directory_identifier,
+     libolecf_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
+int libolecf_directory_table_set_sub_nodes_read(
+     libolecf_directory_table_t *directory_table,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBOLECF_DIRECTORY_TABLE_H ) */
+
@@ -20,20 +20,24 @@
  */
 
 #include <common.h>
+#include <memory.h>
 #include <types.h>
 
 #include "libolecf_definitions.h"
 #include "libolecf_directory_entry.h"
-#include "libolecf_directory_list.h"
+#include "libolecf_directory_table.h"
 #include "libolecf_directory_tree.h"
 #include "libolecf_libcdata.h"
 #include "libolecf_libcerror.h"
 #include "libolecf_libcnotify.h"
 #include "libolecf_libuna.h"
+#include "libolecf_name_index.h"
 
 #include "olecf_directory.h"
 
-/* Create the directory tree from the directory entry list
+/* Create the directory tree from the directory table
+ * If read on demand is set only the sub nodes of the root node are created,
+ * the other sub nodes are created when first accessed
  * Returns 1 if successful, 0 if no directory entries or -1 on error
  */
 int libolecf_directory_tree_create(
@@ -41,15 +45,21 @@ int libolecf_directory_tree_create(
      uint32_t *short_sector_stream_start_sector_identifier,
      libolecf_directory_entry_t **document_summary_information_directory_entry,
      libolecf_directory_entry_t **summary_information_directory_entry,
-     libcdata_list_t *directory_entry_list,
+     libolecf_directory_table_t *directory_table,
      uint8_t byte_order,
+     uint8_t read_on_demand,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *list_element       = NULL;
-	libolecf_directory_entry_t *directory_entry = NULL;
-	static char *function                       = "libolecf_directory_tree_create";
-	int element_index                           = 0;
-	int number_of_elements                      = 0;
+	libcdata_tree_node_t **directory_tree_node_stack = NULL;
+	libcdata_tree_node_t *directory_tree_node        = NULL;
+	libcdata_tree_node_t *sub_directory_tree_node    = NULL;
+	libolecf_directory_entry_t *directory_entry      = NULL;
+	libolecf_directory_entry_t *sub_directory_entry  = NULL;
+	static char *function                            = "libolecf_directory_tree_create";
+	int entry_index                                  = 0;
+	int number_of_entries                            = 0;
+	int result                                       = 0;
+	int stack_depth                                  = 0;
 
 	if( directory_tree_root_node == NULL )
 	{
@@ -84,91 +94,54 @@ int libolecf_directory_tree_create(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_number_of_elements(
-	     directory_entry_list,
-	     &number_of_elements,
+	if( libolecf_directory_table_get_number_of_entries(
+	     directory_table,
+	     &number_of_entries,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements in directory entry list.",
+		 "%s: unable to retrieve number of entries in directory table.",
 		 function );
 
 		goto on_error;
 	}
-	if( number_of_elements == 0 )
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
 	{
-		return( 0 );
-	}
-	if( libcdata_list_get_first_element(
-	     directory_entry_list,
-	     &list_element,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first element of directory entry list.",
-		 function );
+		result = libolecf_directory_table_get_entry_by_identifier(
+		          directory_table,
+		          (uint32_t) entry_index,
+		          &directory_entry,
+		          error );
 
-		goto on_error;
-	}
-	for( element_index = 0;
-	     element_index < number_of_elements;
-	     element_index++ )
-	{
-		if( libcdata_list_element_get_value(
-		     list_element,
-		     (intptr_t **) &directory_entry,
-		     error ) != 1 )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from element: %d.",
-			 function,
-			 element_index );
-
-			goto on_error;
-		}
-		if( directory_entry == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing directory entry: %d.",
+			 "%s: unable to retrieve directory entry: %d.",
 			 function,
-			 element_index );
+			 entry_index );
 
 			goto on_error;
 		}
-		if( directory_entry->type == LIBOLECF_ITEM_TYPE_ROOT_STORAGE )
+		if( ( result != 0 )
+		 && ( directory_entry->type == LIBOLECF_ITEM_TYPE_ROOT_STORAGE ) )
 		{
 			break;
 		}
-		if( libcdata_list_element_get_next_element(
-		     list_element,
-		     &list_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next element of element: %d.",
-			 function,
-			 element_index );
-
-			goto on_error;
-		}
 	}
-	if( list_element == NULL )
+	if( entry_index >= number_of_entries )
 	{
+		if( number_of_entries == 0 )
+		{
+			return( 0 );
+		}
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
@@ -178,22 +151,10 @@ int libolecf_directory_tree_create(
 
 		goto on_error;
 	}
-	if( directory_entry == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing directory entry: %d.",
-		 function,
-		 element_index );
-
-		goto on_error;
-	}
 #if defined( HAVE_VERBOSE_OUTPUT ) || defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
-		if( element_index != 0 )
+		if( entry_index != 0 )
 		{
 			libcnotify_printf(
 			 "%s: root storage is not first directory entry.\n",
@@ -246,33 +207,183 @@ int libolecf_directory_tree_create(
 	}
 	*short_sector_stream_start_sector_identifier = directory_entry->sector_identifier;
 
-	if( libolecf_directory_tree_create_process_entry(
-	     *directory_tree_root_node,
-	     directory_entry,
-	     document_summary_information_directory_entry,
-	     summary_information_directory_entry,
-	     directory_entry_list,
-	     directory_entry,
-	     byte_order,
+	/* Mark the root storage before creating the sub nodes so that a sibling
+	 * directory identifier that refers back to it is detected
+	 */
+	directory_entry->set_in_tree = 1;
+
+	if( read_on_demand != 0 )
+	{
+		if( libolecf_directory_tree_create_sub_nodes(
+		     *directory_tree_root_node,
+		     document_summary_information_directory_entry,
+		     summary_information_directory_entry,
+		     directory_table,
+		     byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to process sub directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	/* Use an explicit stack instead of recursion, every directory entry is added
+	 * to the tree at most once hence the stack depth is bound by the number of entries
+	 */
+	directory_tree_node_stack = (libcdata_tree_node_t **) memory_allocate(
+	                                                       sizeof( libcdata_tree_node_t * ) * number_of_entries );
+
+	if( directory_tree_node_stack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory tree node stack.",
+		 function );
+
+		goto on_error;
+	}
+	directory_tree_node_stack[ stack_depth++ ] = *directory_tree_root_node;
+
+	while( stack_depth > 0 )
+	{
+		directory_tree_node = directory_tree_node_stack[ --stack_depth ];
+
+		if( libolecf_directory_tree_create_sub_nodes(
+		     directory_tree_node,
+		     document_summary_information_directory_entry,
+		     summary_information_directory_entry,
+		     directory_table,
+		     byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to process sub directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		/* Sub directories are only processed if the root storage is the first directory entry
+		 */
+		if( directory_entry->directory_identifier != 0 )
+		{
+			break;
+		}
+		if( libcdata_tree_node_get_first_sub_node(
+		     directory_tree_node,
+		     &sub_directory_tree_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first sub node.",
+			 function );
+
+			goto on_error;
+		}
+		while( sub_directory_tree_node != NULL )
+		{
+			if( libcdata_tree_node_get_value(
+			     sub_directory_tree_node,
+			     (intptr_t **) &sub_directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from sub directory tree node.",
+				 function );
+
+				goto on_error;
+			}
+			if( sub_directory_entry == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing sub directory entry.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( sub_directory_entry->sub_directory_identifier != LIBOLECF_SECTOR_IDENTIFIER_UNUSED )
+			 && ( sub_directory_entry->sub_directory_identifier != 0 ) )
+			{
+				if( stack_depth >= number_of_entries )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid stack depth value out of bounds.",
+					 function );
+
+					goto on_error;
+				}
+				directory_tree_node_stack[ stack_depth++ ] = sub_directory_tree_node;
+			}
+			if( libcdata_tree_node_get_next_node(
+			     sub_directory_tree_node,
+			     &sub_directory_tree_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next node of sub directory tree node.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	memory_free(
+	 directory_tree_node_stack );
+
+	directory_tree_node_stack = NULL;
+
+	/* The directory tree is fully created, prevent the sub nodes
+	 * of directory entries that were not processed from being created on demand
+	 */
+	if( libolecf_directory_table_set_sub_nodes_read(
+	     directory_table,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to process sub directory entry.",
+		 "%s: unable to set sub nodes read in directory table.",
 		 function );
 
 		goto on_error;
 	}
-	directory_entry->set_in_tree = 1;
-
 	return( 1 );
 
 on_error:
+	if( directory_tree_node_stack != NULL )
+	{
+		memory_free(
+		 directory_tree_node_stack );
+	}
 	if( *directory_tree_root_node != NULL )
 	{
-		/* The directory entry is managed by the list
+		/* The directory entry is managed by the directory table
 		 */
 		libcdata_tree_node_free(
 		 directory_tree_root_node,
@@ -282,507 +393,1247 @@ on_error:
 	return( -1 );
 }
 
-/* Process the directory entry and adds it to the directory tree node
- * Returns 1 if successful or -1 on error
+/* Appends the directory entry with a specific identifier to the sub directory entries
+ * The sub directory entries are resized as needed and the directory entry is marked as set in tree
+ * Returns 1 if successful, 0 if not found or -1 on error
  */
-int libolecf_directory_tree_create_process_entry(
-     libcdata_tree_node_t *directory_tree_node,
-     const libolecf_directory_entry_t *root_directory_entry,
-     libolecf_directory_entry_t **document_summary_information_directory_entry,
-     libolecf_directory_entry_t **summary_information_directory_entry,
-     libcdata_list_t *directory_entry_list,
-     libolecf_directory_entry_t *directory_entry,
-     uint8_t byte_order,
+int libolecf_directory_tree_append_sub_directory_entry(
+     libolecf_directory_table_t *directory_table,
+     uint32_t directory_identifier,
+     libolecf_directory_entry_t ***sub_directory_entries,
+     int *number_of_sub_directory_entries,
+     int *number_of_allocated_sub_directory_entries,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *parent_node               = NULL;
 	libolecf_directory_entry_t *sub_directory_entry = NULL;
-	libcdata_tree_node_t *tree_node                 = NULL;
-	static char *function                           = "libolecf_directory_tree_create_process_entry";
+	void *reallocation                              = NULL;
+	static char *function                           = "libolecf_directory_tree_append_sub_directory_entry";
+	int number_of_allocated_entries                 = 0;
 	int result                                      = 0;
 
-	if( directory_tree_node == NULL )
+	if( sub_directory_entries == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory tree node.",
+		 "%s: invalid sub directory entries.",
 		 function );
 
 		return( -1 );
 	}
-	if( root_directory_entry == NULL )
+	if( number_of_sub_directory_entries == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid root directory entry.",
+		 "%s: invalid number of sub directory entries.",
 		 function );
 
 		return( -1 );
 	}
-	if( document_summary_information_directory_entry == NULL )
+	if( number_of_allocated_sub_directory_entries == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid document summary information directory entry.",
+		 "%s: invalid number of allocated sub directory entries.",
 		 function );
 
 		return( -1 );
 	}
-	if( summary_information_directory_entry == NULL )
+	result = libolecf_directory_table_get_entry_by_identifier(
+	          directory_table,
+	          directory_identifier,
+	          &sub_directory_entry,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid summary information directory entry.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry: 0x%08" PRIx32 ".",
+		 function,
+		 directory_identifier );
 
 		return( -1 );
 	}
-	if( directory_entry->name_size == 28 )
+	else if( result == 0 )
 	{
-		result = libuna_utf8_string_compare_with_utf16_stream(
-		          (uint8_t *) "\005DocumentSummaryInformation",
-		          28,
-		          directory_entry->name,
-		          directory_entry->name_size,
-		          byte_order,
-		          error );
+		return( 0 );
+	}
+	if( sub_directory_entry->set_in_tree != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: directory entry tree node already set.",
+		 function );
 
-		if( result == -1 )
+		return( -1 );
+	}
+	if( *number_of_sub_directory_entries >= *number_of_allocated_sub_directory_entries )
+	{
+		if( *number_of_allocated_sub_directory_entries == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to compare directory entry name.",
-			 function );
-
-			goto on_error;
+			number_of_allocated_entries = 16;
 		}
-		else if( result == LIBUNA_COMPARE_EQUAL )
+		else
 		{
-			*document_summary_information_directory_entry = directory_entry;
+			number_of_allocated_entries = *number_of_allocated_sub_directory_entries * 2;
 		}
-	}
-	else if( directory_entry->name_size == 20 )
-	{
-		result = libuna_utf8_string_compare_with_utf16_stream(
-		          (uint8_t *) "\005SummaryInformation",
-		          20,
-		          directory_entry->name,
-		          directory_entry->name_size,
-		          byte_order,
-		          error );
-
-		if( result == -1 )
+		if( ( number_of_allocated_entries <= *number_of_allocated_sub_directory_entries )
+		 || ( (size_t) number_of_allocated_entries > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libolecf_directory_entry_t * ) ) ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to compare directory entry name.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of allocated sub directory entries value out of bounds.",
 			 function );
 
-			goto on_error;
-		}
-		else if( result == LIBUNA_COMPARE_EQUAL )
-		{
-			*summary_information_directory_entry = directory_entry;
+			return( -1 );
 		}
-	}
-	/* Process sub directory identifier
-	 */
-	if( ( directory_entry->sub_directory_identifier != LIBOLECF_SECTOR_IDENTIFIER_UNUSED )
-	 && ( directory_entry->sub_directory_identifier != 0 )
-	 && ( root_directory_entry->directory_identifier == 0 ) )
-	{
-		result = libolecf_directory_list_get_element_by_identifier(
-		          directory_entry_list,
-		          directory_entry->sub_directory_identifier,
-		          &sub_directory_entry,
-		          error );
+		reallocation = memory_reallocate(
+		                *sub_directory_entries,
+		                sizeof( libolecf_directory_entry_t * ) * number_of_allocated_entries );
 
-		if( result == -1 )
+		if( reallocation == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub directory entry list element: %" PRIu32 ".",
-			 function,
-			 directory_entry->sub_directory_identifier );
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize sub directory entries.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		else if( result != 0 )
-		{
-			if( sub_directory_entry == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing sub directory entry: %" PRIu32 ".",
-				 function,
-				 directory_entry->sub_directory_identifier );
+		*sub_directory_entries                     = (libolecf_directory_entry_t **) reallocation;
+		*number_of_allocated_sub_directory_entries = number_of_allocated_entries;
+	}
+	( *sub_directory_entries )[ *number_of_sub_directory_entries ] = sub_directory_entry;
 
-				goto on_error;
-			}
-			if( sub_directory_entry->set_in_tree != 0 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-				 "%s: directory entry tree node already set.",
-				 function );
+	*number_of_sub_directory_entries += 1;
 
-				goto on_error;
-			}
-			if( libcdata_tree_node_initialize(
-			     &tree_node,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create directory tree node.",
-				 function );
+	sub_directory_entry->set_in_tree = 1;
 
-				goto on_error;
-			}
-			if( libcdata_tree_node_set_value(
-			     tree_node,
-			     (intptr_t *) sub_directory_entry,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set directory tree node value.",
-				 function );
+	return( 1 );
+}
 
-				goto on_error;
-			}
-			if( libcdata_tree_node_insert_node(
-			     directory_tree_node,
-			     tree_node,
-			     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libolecf_directory_entry_compare,
-			     LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to insert sub directory tree node.",
-				 function );
+/* Retrieves the sub directory entries of a directory entry
+ * The sub directory entries form a red-black tree, starting at the sub directory
+ * identifier, that is linked by the previous and next directory identifiers.
+ * The red-black tree is traversed iteratively, using the sub directory entries
+ * as work list, and the result is sorted by directory identifier
+ * The sub directory entries are marked as set in tree and must be freed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_directory_tree_get_sub_directory_entries(
+     libolecf_directory_table_t *directory_table,
+     libolecf_directory_entry_t *directory_entry,
+     libolecf_directory_entry_t ***sub_directory_entries,
+     int *number_of_sub_directory_entries,
+     libcerror_error_t **error )
+{
+	libolecf_directory_entry_t **safe_sub_directory_entries = NULL;
+	libolecf_directory_entry_t *sub_directory_entry         = NULL;
+	static char *function                                   = "libolecf_directory_tree_get_sub_directory_entries";
+	int entry_index                                         = 0;
+	int number_of_allocated_entries                         = 0;
+	int number_of_entries                                   = 0;
+	int result                                              = 0;
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_directory_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub directory entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_directory_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sub directory entries.",
+		 function );
+
+		return( -1 );
+	}
+	result = libolecf_directory_tree_append_sub_directory_entry(
+	          directory_table,
+	          directory_entry->sub_directory_identifier,
+	          &safe_sub_directory_entries,
+	          &number_of_entries,
+	          &number_of_allocated_entries,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append sub directory entry: %" PRIu32 ".",
+		 function,
+		 directory_entry->sub_directory_identifier );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		sub_directory_entry = safe_sub_directory_entries[ entry_index ];
+
+		if( sub_directory_entry->previous_directory_identifier != LIBOLECF_SECTOR_IDENTIFIER_UNUSED )
+		{
+			result = libolecf_directory_tree_append_sub_directory_entry(
+			          directory_table,
+			          sub_directory_entry->previous_directory_identifier,
+			          &safe_sub_directory_entries,
+			          &number_of_entries,
+			          &number_of_allocated_entries,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append previous directory entry: 0x%08" PRIx32 ".",
+				 function,
+				 sub_directory_entry->previous_directory_identifier );
 
 				goto on_error;
 			}
-			sub_directory_entry->set_in_tree = 1;
-
-			if( libolecf_directory_tree_create_process_entry(
-			     tree_node,
-			     root_directory_entry,
-			     document_summary_information_directory_entry,
-			     summary_information_directory_entry,
-			     directory_entry_list,
-			     sub_directory_entry,
-			     byte_order,
-			     error ) != 1 )
+			/* The reallocation can have moved the sub directory entries
+			 */
+			sub_directory_entry = safe_sub_directory_entries[ entry_index ];
+		}
+		if( sub_directory_entry->next_directory_identifier != LIBOLECF_SECTOR_IDENTIFIER_UNUSED )
+		{
+			result = libolecf_directory_tree_append_sub_directory_entry(
+			          directory_table,
+			          sub_directory_entry->next_directory_identifier,
+			          &safe_sub_directory_entries,
+			          &number_of_entries,
+			          &number_of_allocated_entries,
+			          error );
+
+			if( result != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to process sub directory entry.",
-				 function );
-
-				tree_node = NULL;
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append next directory entry: 0x%08" PRIx32 ".",
+				 function,
+				 sub_directory_entry->next_directory_identifier );
 
 				goto on_error;
 			}
-			tree_node = NULL;
 		}
 	}
-	/* Process previous directory identifier
+	/* A sub directory identifier that refers to a missing directory entry is ignored
 	 */
-	if( directory_entry->previous_directory_identifier != LIBOLECF_SECTOR_IDENTIFIER_UNUSED )
+	if( number_of_entries > 0 )
 	{
-		result = libolecf_directory_list_get_element_by_identifier(
-		          directory_entry_list,
-		          (int) directory_entry->previous_directory_identifier,
-		          &sub_directory_entry,
-		          error );
-
-		if( result == -1 )
+		if( libolecf_directory_tree_sort_directory_entries(
+		     safe_sub_directory_entries,
+		     number_of_entries,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve previous directory entry: 0x%08" PRIx32 ".",
-			 function,
-			 directory_entry->previous_directory_identifier );
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to sort sub directory entries.",
+			 function );
 
 			goto on_error;
 		}
-		else if( result != 0 )
+	}
+	*sub_directory_entries           = safe_sub_directory_entries;
+	*number_of_sub_directory_entries = number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( safe_sub_directory_entries != NULL )
+	{
+		memory_free(
+		 safe_sub_directory_entries );
+	}
+	return( -1 );
+}
+
+/* Sorts directory entries by directory identifier
+ * Uses a bottom-up merge sort
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_directory_tree_sort_directory_entries(
+     libolecf_directory_entry_t **directory_entries,
+     int number_of_directory_entries,
+     libcerror_error_t **error )
+{
+	libolecf_directory_entry_t **merged_directory_entries  = NULL;
+	libolecf_directory_entry_t **scratch_directory_entries = NULL;
+	libolecf_directory_entry_t **sorted_directory_entries  = NULL;
+	libolecf_directory_entry_t **swap_directory_entries    = NULL;
+	static char *function                                  = "libolecf_directory_tree_sort_directory_entries";
+	int first_end_index                                    = 0;
+	int first_index                                        = 0;
+	int merged_index                                       = 0;
+	int range_size                                         = 0;
+	int range_start_index                                  = 0;
+	int result                                             = 0;
+	int second_end_index                                   = 0;
+	int second_index                                       = 0;
+
+	if( directory_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_directory_entries < 0 )
+	 || ( (size_t) number_of_directory_entries > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libolecf_directory_entry_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of directory entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_directory_entries < 2 )
+	{
+		return( 1 );
+	}
+	scratch_directory_entries = (libolecf_directory_entry_t **) memory_allocate(
+	                                                             sizeof( libolecf_directory_entry_t * ) * number_of_directory_entries );
+
+	if( scratch_directory_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scratch directory entries.",
+		 function );
+
+		return( -1 );
+	}
+	sorted_directory_entries = directory_entries;
+	merged_directory_entries = scratch_directory_entries;
+
+	for( range_size = 1;
+	     range_size < number_of_directory_entries;
+	     range_size *= 2 )
+	{
+		for( range_start_index = 0;
+		     range_start_index < number_of_directory_entries;
+		     range_start_index += 2 * range_size )
 		{
-			if( sub_directory_entry == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing previous directory entry: %" PRIu32 ".",
-				 function,
-				 directory_entry->previous_directory_identifier );
+			first_index      = range_start_index;
+			first_end_index  = range_start_index + range_size;
+			second_index     = first_end_index;
+			second_end_index = second_index + range_size;
+			merged_index     = range_start_index;
 
-				goto on_error;
+			if( first_end_index > number_of_directory_entries )
+			{
+				first_end_index = number_of_directory_entries;
 			}
-			if( sub_directory_entry->set_in_tree != 0 )
+			if( second_end_index > number_of_directory_entries )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-				 "%s: directory entry tree node already set.",
-				 function );
-
-				goto on_error;
+				second_end_index = number_of_directory_entries;
 			}
-			if( libcdata_tree_node_initialize(
-			     &tree_node,
-			     error ) != 1 )
+			while( ( first_index < first_end_index )
+			    && ( second_index < second_end_index ) )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create directory tree node.",
-				 function );
-
-				goto on_error;
+				result = libolecf_directory_entry_compare(
+				          sorted_directory_entries[ first_index ],
+				          sorted_directory_entries[ second_index ],
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to compare directory entries.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result == LIBCDATA_COMPARE_GREATER )
+				{
+					merged_directory_entries[ merged_index++ ] = sorted_directory_entries[ second_index++ ];
+				}
+				else
+				{
+					merged_directory_entries[ merged_index++ ] = sorted_directory_entries[ first_index++ ];
+				}
 			}
-			if( libcdata_tree_node_set_value(
-			     tree_node,
-			     (intptr_t *) sub_directory_entry,
-			     error ) != 1 )
+			while( first_index < first_end_index )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set directory tree node value.",
-				 function );
-
-				goto on_error;
+				merged_directory_entries[ merged_index++ ] = sorted_directory_entries[ first_index++ ];
 			}
-			if( libcdata_tree_node_get_parent_node(
-			     directory_tree_node,
-			     &parent_node,
-			     error ) != 1 )
+			while( second_index < second_end_index )
+			{
+				merged_directory_entries[ merged_index++ ] = sorted_directory_entries[ second_index++ ];
+			}
+		}
+		swap_directory_entries   = sorted_directory_entries;
+		sorted_directory_entries = merged_directory_entries;
+		merged_directory_entries = swap_directory_entries;
+	}
+	if( sorted_directory_entries != directory_entries )
+	{
+		if( memory_copy(
+		     directory_entries,
+		     sorted_directory_entries,
+		     sizeof( libolecf_directory_entry_t * ) * number_of_directory_entries ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sorted directory entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 scratch_directory_entries );
+
+	return( 1 );
+
+on_error:
+	memory_free(
+	 scratch_directory_entries );
+
+	return( -1 );
+}
+
+/* Creates the sub nodes of the directory tree node
+ * The sub nodes are the sub directory entry and the entries reachable through
+ * its previous and next directory identifiers, sub directories of these sub nodes
+ * are not created
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_directory_tree_create_sub_nodes(
+     libcdata_tree_node_t *directory_tree_node,
+     libolecf_directory_entry_t **document_summary_information_directory_entry,
+     libolecf_directory_entry_t **summary_information_directory_entry,
+     libolecf_directory_table_t *directory_table,
+     uint8_t byte_order,
+     libcerror_error_t **error )
+{
+	libolecf_directory_entry_t **sub_directory_entries = NULL;
+	libolecf_directory_entry_t *directory_entry        = NULL;
+	libolecf_directory_entry_t *sub_directory_entry    = NULL;
+	libcdata_tree_node_t *tree_node                    = NULL;
+	static char *function                              = "libolecf_directory_tree_create_sub_nodes";
+	int number_of_sub_directory_entries                = 0;
+	int result                                         = 0;
+	int sub_directory_entry_index                      = 0;
+
+	if( directory_tree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( document_summary_information_directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid document summary information directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( summary_information_directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid summary information directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_get_value(
+	     directory_tree_node,
+	     (intptr_t **) &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from directory tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry->sub_nodes_read != 0 )
+	{
+		return( 1 );
+	}
+	if( ( directory_entry->sub_directory_identifier != LIBOLECF_SECTOR_IDENTIFIER_UNUSED )
+	 && ( directory_entry->sub_directory_identifier != 0 ) )
+	{
+		if( libolecf_directory_tree_get_sub_directory_entries(
+		     directory_table,
+		     directory_entry,
+		     &sub_directory_entries,
+		     &number_of_sub_directory_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub directory entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The sub directory entries are sorted by directory identifier
+	 * hence the sub nodes can be appended instead of inserted
+	 */
+	for( sub_directory_entry_index = 0;
+	     sub_directory_entry_index < number_of_sub_directory_entries;
+	     sub_directory_entry_index++ )
+	{
+		sub_directory_entry = sub_directory_entries[ sub_directory_entry_index ];
+
+		if( sub_directory_entry->name_size == 28 )
+		{
+			result = libuna_utf8_string_compare_with_utf16_stream(
+			          (uint8_t *) "\005DocumentSummaryInformation",
+			          28,
+			          sub_directory_entry->name,
+			          sub_directory_entry->name_size,
+			          byte_order,
+			          error );
+
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve parent node.",
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare directory entry name.",
 				 function );
 
 				goto on_error;
 			}
-			if( libcdata_tree_node_insert_node(
-			     parent_node,
-			     tree_node,
-			     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libolecf_directory_entry_compare,
-			     LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
-			     error ) != 1 )
+			else if( result == LIBUNA_COMPARE_EQUAL )
+			{
+				*document_summary_information_directory_entry = sub_directory_entry;
+			}
+		}
+		else if( sub_directory_entry->name_size == 20 )
+		{
+			result = libuna_utf8_string_compare_with_utf16_stream(
+			          (uint8_t *) "\005SummaryInformation",
+			          20,
+			          sub_directory_entry->name,
+			          sub_directory_entry->name_size,
+			          byte_order,
+			          error );
+
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to insert previous directory tree node.",
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare directory entry name.",
 				 function );
 
 				goto on_error;
 			}
-			sub_directory_entry->set_in_tree = 1;
-
-			if( libolecf_directory_tree_create_process_entry(
-			     tree_node,
-			     root_directory_entry,
-			     document_summary_information_directory_entry,
-			     summary_information_directory_entry,
-			     directory_entry_list,
-			     sub_directory_entry,
-			     byte_order,
-			     error ) != 1 )
+			else if( result == LIBUNA_COMPARE_EQUAL )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to process previous directory entry.",
-				 function );
-
-				tree_node = NULL;
+				*summary_information_directory_entry = sub_directory_entry;
+			}
+		}
+		if( libcdata_tree_node_initialize(
+		     &tree_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory tree node.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_tree_node_set_value(
+		     tree_node,
+		     (intptr_t *) sub_directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set directory tree node value.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_tree_node_append_node(
+		     directory_tree_node,
+		     tree_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append sub directory tree node.",
+			 function );
+
+			goto on_error;
+		}
+		tree_node = NULL;
+	}
+	if( sub_directory_entries != NULL )
+	{
+		memory_free(
+		 sub_directory_entries );
+	}
+	directory_entry->sub_nodes_read = 1;
+
+	return( 1 );
+
+on_error:
+	if( tree_node != NULL )
+	{
+		libcdata_tree_node_free(
+		 &tree_node,
+		 NULL,
+		 NULL );
+	}
+	if( sub_directory_entries != NULL )
+	{
+		memory_free(
+		 sub_directory_entries );
+	}
+	return( -1 );
+}
+
+/* Reads the sub nodes of the directory tree node if not read before
+ * A directory table of NULL indicates the directory tree was fully created
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_directory_tree_read_sub_nodes(
+     libcdata_tree_node_t *directory_tree_node,
+     libolecf_directory_table_t *directory_table,
+     uint8_t byte_order,
+     libcerror_error_t **error )
+{
+	libolecf_directory_entry_t *document_summary_information_directory_entry = NULL;
+	libolecf_directory_entry_t *summary_information_directory_entry          = NULL;
+	static char *function                                                    = "libolecf_directory_tree_read_sub_nodes";
+
+	if( directory_tree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_table == NULL )
+	{
+		return( 1 );
+	}
+	/* The summary information directory entries are only determined
+	 * for the sub nodes of the root node
+	 */
+	if( libolecf_directory_tree_create_sub_nodes(
+	     directory_tree_node,
+	     &document_summary_information_directory_entry,
+	     &summary_information_directory_entry,
+	     directory_table,
+	     byte_order,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of sub nodes of the directory tree node
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_directory_tree_get_number_of_sub_nodes(
+     libcdata_tree_node_t *directory_tree_node,
+     libolecf_directory_table_t *directory_table,
+     uint8_t byte_order,
+     int *number_of_sub_nodes,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_directory_tree_get_number_of_sub_nodes";
+
+	if( libolecf_directory_tree_read_sub_nodes(
+	     directory_tree_node,
+	     directory_table,
+	     byte_order,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_get_number_of_sub_nodes(
+	     directory_tree_node,
+	     number_of_sub_nodes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the array of the sub nodes of the directory tree node
+ * The array is created on first use and provides indexed access to the sub nodes
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_directory_tree_get_sub_nodes_array(
+     libcdata_tree_node_t *directory_tree_node,
+     libcdata_array_t **sub_nodes_array,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *safe_sub_nodes_array        = NULL;
+	libcdata_tree_node_t *sub_directory_tree_node = NULL;
+	libolecf_directory_entry_t *directory_entry   = NULL;
+	static char *function                         = "libolecf_directory_tree_get_sub_nodes_array";
+	int number_of_sub_nodes                       = 0;
+	int sub_node_index                            = 0;
+
+	if( directory_tree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_nodes_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub nodes array.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_get_value(
+	     directory_tree_node,
+	     (intptr_t **) &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from directory tree node.",
+		 function );
+
+		goto on_error;
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( directory_entry->sub_nodes_array != NULL )
+	{
+		*sub_nodes_array = directory_entry->sub_nodes_array;
+
+		return( 1 );
+	}
+	if( libcdata_tree_node_get_number_of_sub_nodes(
+	     directory_tree_node,
+	     &number_of_sub_nodes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub nodes.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &safe_sub_nodes_array,
+	     number_of_sub_nodes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sub nodes array.",
+		 function );
+
+		goto on_error;
+	}
+	/* Walk the sub nodes once instead of retrieving every sub node by index
+	 */
+	if( libcdata_tree_node_get_first_sub_node(
+	     directory_tree_node,
+	     &sub_directory_tree_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first sub node.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_node_index = 0;
+	     sub_node_index < number_of_sub_nodes;
+	     sub_node_index++ )
+	{
+		if( sub_directory_tree_node == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			goto on_error;
+		}
+		if( libcdata_array_set_entry_by_index(
+		     safe_sub_nodes_array,
+		     sub_node_index,
+		     (intptr_t *) sub_directory_tree_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set sub node: %d in array.",
+			 function,
+			 sub_node_index );
+
+			goto on_error;
+		}
+		if( libcdata_tree_node_get_next_node(
+		     sub_directory_tree_node,
+		     &sub_directory_tree_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next node of sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			goto on_error;
+		}
+	}
+	directory_entry->sub_nodes_array = safe_sub_nodes_array;
+
+	*sub_nodes_array = safe_sub_nodes_array;
+
+	return( 1 );
+
+on_error:
+	if( safe_sub_nodes_array != NULL )
+	{
+		/* The sub nodes are managed by the directory tree
+		 */
+		libcdata_array_free(
+		 &safe_sub_nodes_array,
+		 NULL,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific sub node of the directory tree node
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_directory_tree_get_sub_node_by_index(
+     libcdata_tree_node_t *directory_tree_node,
+     libolecf_directory_table_t *directory_table,
+     uint8_t byte_order,
+     int sub_node_index,
+     libcdata_tree_node_t **sub_directory_tree_node,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *sub_nodes_array = NULL;
+	static char *function             = "libolecf_directory_tree_get_sub_node_by_index";
+
+	if( libolecf_directory_tree_read_sub_nodes(
+	     directory_tree_node,
+	     directory_table,
+	     byte_order,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libolecf_directory_tree_get_sub_nodes_array(
+	     directory_tree_node,
+	     &sub_nodes_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub nodes array.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     sub_nodes_array,
+	     sub_node_index,
+	     (intptr_t **) sub_directory_tree_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub node: %d.",
+		 function,
+		 sub_node_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the name index of the sub nodes of the directory tree node
+ * The name index is created on first use
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_directory_tree_get_sub_node_name_index(
+     libcdata_tree_node_t *directory_tree_node,
+     uint8_t byte_order,
+     libolecf_name_index_t **name_index,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *sub_nodes_array               = NULL;
+	libcdata_tree_node_t *sub_directory_tree_node   = NULL;
+	libolecf_directory_entry_t *directory_entry     = NULL;
+	libolecf_directory_entry_t *sub_directory_entry = NULL;
+	libolecf_name_index_t *safe_name_index          = NULL;
+	static char *function                           = "libolecf_directory_tree_get_sub_node_name_index";
+	uint32_t name_hash                              = 0;
+	int number_of_sub_nodes                         = 0;
+	int sub_node_index                              = 0;
+
+	if( directory_tree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_get_value(
+	     directory_tree_node,
+	     (intptr_t **) &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from directory tree node.",
+		 function );
+
+		goto on_error;
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( directory_entry->sub_node_name_index != NULL )
+	{
+		*name_index = directory_entry->sub_node_name_index;
+
+		return( 1 );
+	}
+	if( libolecf_directory_tree_get_sub_nodes_array(
+	     directory_tree_node,
+	     &sub_nodes_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub nodes array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     sub_nodes_array,
+	     &number_of_sub_nodes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub nodes.",
+		 function );
+
+		goto on_error;
+	}
+	if( libolecf_name_index_initialize(
+	     &safe_name_index,
+	     number_of_sub_nodes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create name index.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_node_index = 0;
+	     sub_node_index < number_of_sub_nodes;
+	     sub_node_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     sub_nodes_array,
+		     sub_node_index,
+		     (intptr_t **) &sub_directory_tree_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub node: %d.",
+			 function,
+			 sub_node_index );
 
-				goto on_error;
-			}
-			tree_node = NULL;
+			goto on_error;
 		}
-	}
-	/* Process next directory identifier
-	 */
-	if( directory_entry->next_directory_identifier != LIBOLECF_SECTOR_IDENTIFIER_UNUSED )
-	{
-		result = libolecf_directory_list_get_element_by_identifier(
-		          directory_entry_list,
-		          (int) directory_entry->next_directory_identifier,
-		          &sub_directory_entry,
-		          error );
-
-		if( result != 1 )
+		if( libcdata_tree_node_get_value(
+		     sub_directory_tree_node,
+		     (intptr_t **) &sub_directory_entry,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next directory entry: 0x%08" PRIx32 ".",
+			 "%s: unable to retrieve value from sub directory tree node: %d.",
 			 function,
-			 directory_entry->next_directory_identifier );
+			 sub_node_index );
 
 			goto on_error;
 		}
-		else if( result != 0 )
+		if( sub_directory_entry == NULL )
 		{
-			if( sub_directory_entry == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing next directory entry: %" PRIu32 ".",
-				 function,
-				 directory_entry->sub_directory_identifier );
-
-				goto on_error;
-			}
-			if( sub_directory_entry->set_in_tree != 0 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-				 "%s: directory entry tree node already set.",
-				 function );
-
-				goto on_error;
-			}
-			if( libcdata_tree_node_initialize(
-			     &tree_node,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create directory tree node.",
-				 function );
-
-				goto on_error;
-			}
-			if( libcdata_tree_node_set_value(
-			     tree_node,
-			     (intptr_t *) sub_directory_entry,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set directory tree node value.",
-				 function );
-
-				goto on_error;
-			}
-			if( libcdata_tree_node_get_parent_node(
-			     directory_tree_node,
-			     &parent_node,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve parent node.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing sub directory entry: %d.",
+			 function,
+			 sub_node_index );
 
-				goto on_error;
-			}
-			if( libcdata_tree_node_insert_node(
-			     parent_node,
-			     tree_node,
-			     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libolecf_directory_entry_compare,
-			     LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to insert next directory tree node.",
-				 function );
+			goto on_error;
+		}
+		name_hash = LIBOLECF_NAME_INDEX_INITIAL_HASH;
 
-				goto on_error;
-			}
-			sub_directory_entry->set_in_tree = 1;
-
-			if( libolecf_directory_tree_create_process_entry(
-			     tree_node,
-			     root_directory_entry,
-			     document_summary_information_directory_entry,
-			     summary_information_directory_entry,
-			     directory_entry_list,
-			     sub_directory_entry,
+		if( sub_directory_entry->name != NULL )
+		{
+			if( libolecf_name_index_calculate_hash_from_utf16_stream(
+			     sub_directory_entry->name,
+			     sub_directory_entry->name_size,
 			     byte_order,
+			     &name_hash,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to process next directory entry.",
-				 function );
-
-				tree_node = NULL;
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to calculate sub directory entry: %d name hash.",
+				 function,
+				 sub_node_index );
 
 				goto on_error;
 			}
-			tree_node = NULL;
+		}
+		if( libolecf_name_index_insert_value(
+		     safe_name_index,
+		     name_hash,
+		     (intptr_t *) sub_directory_tree_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert sub directory tree node: %d into name index.",
+			 function,
+			 sub_node_index );
+
+			goto on_error;
 		}
 	}
+	directory_entry->sub_node_name_index = safe_name_index;
+
+	*name_index = safe_name_index;
+
 	return( 1 );
 
 on_error:
-	if( tree_node != NULL )
+	if( safe_name_index != NULL )
 	{
-		libcdata_tree_node_free(
-		 &tree_node,
-		 NULL,
+		libolecf_name_index_free(
+		 &safe_name_index,
 		 NULL );
 	}
 	return( -1 );
@@ -793,6 +1644,7 @@ on_error:
  */
 int libolecf_directory_tree_get_sub_node_by_utf8_name(
      libcdata_tree_node_t *directory_tree_node,
+     libolecf_directory_table_t *directory_table,
      const uint8_t *utf8_string,
      size_t utf8_string_length,
      uint8_t byte_order,
@@ -801,9 +1653,13 @@ int libolecf_directory_tree_get_sub_node_by_utf8_name(
 {
 	libcdata_tree_node_t *safe_sub_directory_tree_node = NULL;
 	libolecf_directory_entry_t *sub_directory_entry    = NULL;
+	libolecf_name_index_t *name_index                  = NULL;
 	static char *function                              = "libolecf_directory_tree_get_sub_node_by_utf8_name";
+	uint32_t name_hash                                 = 0;
+	int compare_result                                 = 0;
 	int number_of_sub_nodex                            = 0;
 	int result                                         = 0;
+	int slot_index                                     = 0;
 	int sub_node_index                                 = 0;
 
 	if( directory_tree_node == NULL )
@@ -830,6 +1686,21 @@ int libolecf_directory_tree_get_sub_node_by_utf8_name(
 	}
 	*sub_directory_tree_node = NULL;
 
+	if( libolecf_directory_tree_read_sub_nodes(
+	     directory_tree_node,
+	     directory_table,
+	     byte_order,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read sub nodes.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_tree_node_get_number_of_sub_nodes(
 	     directory_tree_node,
 	     &number_of_sub_nodex,
@@ -844,6 +1715,121 @@ int libolecf_directory_tree_get_sub_node_by_utf8_name(
 
 		return( -1 );
 	}
+	if( number_of_sub_nodex >= LIBOLECF_NAME_INDEX_MINIMUM_NUMBER_OF_SUB_NODES )
+	{
+		if( libolecf_directory_tree_get_sub_node_name_index(
+		     directory_tree_node,
+		     byte_order,
+		     &name_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub node name index.",
+			 function );
+
+			return( -1 );
+		}
+		if( libolecf_name_index_calculate_hash_from_utf8_string(
+		     utf8_string,
+		     utf8_string_length,
+		     &name_hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate UTF-8 name hash.",
+			 function );
+
+			return( -1 );
+		}
+		slot_index = -1;
+
+		do
+		{
+			result = libolecf_name_index_get_value_by_hash(
+			          name_index,
+			          name_hash,
+			          &slot_index,
+			          (intptr_t **) &safe_sub_directory_tree_node,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub directory tree node from name index.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			if( libcdata_tree_node_get_value(
+			     safe_sub_directory_tree_node,
+			     (intptr_t **) &sub_directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from sub directory tree node.",
+				 function );
+
+				return( -1 );
+			}
+			if( sub_directory_entry == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing sub directory entry.",
+				 function );
+
+				return( -1 );
+			}
+			/* The name index is case-insensitive, hence the names are compared
+			 */
+			compare_result = libuna_utf8_string_compare_with_utf16_stream(
+			                  utf8_string,
+			                  utf8_string_length,
+			                  sub_directory_entry->name,
+			                  sub_directory_entry->name_size,
+			                  byte_order,
+			                  error );
+
+			if( compare_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare sub directory entry name.",
+				 function );
+
+				return( -1 );
+			}
+			else if( compare_result == LIBUNA_COMPARE_EQUAL )
+			{
+				*sub_directory_tree_node = safe_sub_directory_tree_node;
+
+				return( 1 );
+			}
+		}
+		while( result != 0 );
+
+		return( 0 );
+	}
 	for( sub_node_index = 0;
 	     sub_node_index < number_of_sub_nodex;
 	     sub_node_index++ )
@@ -926,6 +1912,7 @@ int libolecf_directory_tree_get_sub_node_by_utf8_name(
  */
 int libolecf_directory_tree_get_sub_node_by_utf16_name(
      libcdata_tree_node_t *directory_tree_node,
+     libolecf_directory_table_t *directory_table,
      const uint16_t *utf16_string,
      size_t utf16_string_length,
      uint8_t byte_order,
@@ -934,9 +1921,13 @@ int libolecf_directory_tree_get_sub_node_by_utf16_name(
 {
 	libcdata_tree_node_t *safe_sub_directory_tree_node = NULL;
 	libolecf_directory_entry_t *sub_directory_entry    = NULL;
+	libolecf_name_index_t *name_index                  = NULL;
 	static char *function                              = "libolecf_directory_tree_get_sub_node_by_utf16_name";
+	uint32_t name_hash                                 = 0;
+	int compare_result                                 = 0;
 	int number_of_sub_nodex                            = 0;
 	int result                                         = 0;
+	int slot_index                                     = 0;
 	int sub_node_index                                 = 0;
 
 	if( directory_tree_node == NULL )
@@ -963,6 +1954,21 @@ int libolecf_directory_tree_get_sub_node_by_utf16_name(
 	}
 	*sub_directory_tree_node = NULL;
 
+	if( libolecf_directory_tree_read_sub_nodes(
+	     directory_tree_node,
+	     directory_table,
+	     byte_order,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read sub nodes.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_tree_node_get_number_of_sub_nodes(
 	     directory_tree_node,
 	     &number_of_sub_nodex,
@@ -977,6 +1983,121 @@ int libolecf_directory_tree_get_sub_node_by_utf16_name(
 
 		return( -1 );
 	}
+	if( number_of_sub_nodex >= LIBOLECF_NAME_INDEX_MINIMUM_NUMBER_OF_SUB_NODES )
+	{
+		if( libolecf_directory_tree_get_sub_node_name_index(
+		     directory_tree_node,
+		     byte_order,
+		     &name_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub node name index.",
+			 function );
+
+			return( -1 );
+		}
+		if( libolecf_name_index_calculate_hash_from_utf16_string(
+		     utf16_string,
+		     utf16_string_length,
+		     &name_hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate UTF-16 name hash.",
+			 function );
+
+			return( -1 );
+		}
+		slot_index = -1;
+
+		do
+		{
+			result = libolecf_name_index_get_value_by_hash(
+			          name_index,
+			          name_hash,
+			          &slot_index,
+			          (intptr_t **) &safe_sub_directory_tree_node,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub directory tree node from name index.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			if( libcdata_tree_node_get_value(
+			     safe_sub_directory_tree_node,
+			     (intptr_t **) &sub_directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from sub directory tree node.",
+				 function );
+
+				return( -1 );
+			}
+			if( sub_directory_entry == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing sub directory entry.",
+				 function );
+
+				return( -1 );
+			}
+			/* The name index is case-insensitive, hence the names are compared
+			 */
+			compare_result = libuna_utf16_string_compare_with_utf16_stream(
+			                  utf16_string,
+			                  utf16_string_length,
+			                  sub_directory_entry->name,
+			                  sub_directory_entry->name_size,
+			                  byte_order,
+			                  error );
+
+			if( compare_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare sub directory entry name.",
+				 function );
+
+				return( -1 );
+			}
+			else if( compare_result == LIBUNA_COMPARE_EQUAL )
+			{
+				*sub_directory_tree_node = safe_sub_directory_tree_node;
+
+				return( 1 );
+			}
+		}
+		while( result != 0 );
+
+		return( 0 );
+	}
 	for( sub_node_index = 0;
 	     sub_node_index < number_of_sub_nodex;
 	     sub_node_index++ )
@@ -26,8 +26,10 @@
 #include <types.h>
 
 #include "libolecf_directory_entry.h"
+#include "libolecf_directory_table.h"
 #include "libolecf_libcdata.h"
 #include "libolecf_libcerror.h"
+#include "libolecf_name_index.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -38,22 +40,74 @@ int libolecf_directory_tree_create(
      uint32_t *short_sector_stream_start_sector_identifier,
      libolecf_directory_entry_t **document_summary_information_directory_entry,
      libolecf_directory_entry_t **summary_information_directory_entry,
-     libcdata_list_t *directory_entry_list,
+     libolecf_directory_table_t *directory_table,
      uint8_t byte_order,
+     uint8_t read_on_demand,
      libcerror_error_t **error );
 
-int libolecf_directory_tree_create_process_entry(
+int libolecf_directory_tree_append_sub_directory_entry(
+     libolecf_directory_table_t *directory_table,
+     uint32_t directory_identifier,
+     libolecf_directory_entry_t ***sub_directory_entries,
+     int *number_of_sub_directory_entries,
+     int *number_of_allocated_sub_directory_entries,
+     libcerror_error_t **error );
+
+int libolecf_directory_tree_get_sub_directory_entries(
+     libolecf_directory_table_t *directory_table,
+     libolecf_directory_entry_t *directory_entry,
+     libolecf_directory_entry_t ***sub_directory_entries,
+     int *number_of_sub_directory_entries,
+     libcerror_error_t **error );
+
+int libolecf_directory_tree_sort_directory_entries(
+     libolecf_directory_entry_t **directory_entries,
+     int number_of_directory_entries,
+     libcerror_error_t **error );
+
+int libolecf_directory_tree_create_sub_nodes(
      libcdata_tree_node_t *directory_tree_node,
-     const libolecf_directory_entry_t *root_directory_entry,
      libolecf_directory_entry_t **document_summary_information_directory_entry,
      libolecf_directory_entry_t **summary_information_directory_entry,
-     libcdata_list_t *directory_entry_list,
-     libolecf_directory_entry_t *directory_entry,
+     libolecf_directory_table_t *directory_table,
+     uint8_t byte_order,
+     libcerror_error_t **error );
+
+int libolecf_directory_tree_read_sub_nodes(
+     libcdata_tree_node_t *directory_tree_node,
+     libolecf_directory_table_t *directory_table,
+     uint8_t byte_order,
+     libcerror_error_t **error );
+
+int libolecf_directory_tree_get_number_of_sub_nodes(
+     libcdata_tree_node_t *directory_tree_node,
+     libolecf_directory_table_t *directory_table,
+     uint8_t byte_order,
+     int *number_of_sub_nodes,
+     libcerror_error_t **error );
+
+int libolecf_directory_tree_get_sub_nodes_array(
+     libcdata_tree_node_t *directory_tree_node,
+     libcdata_array_t **sub_nodes_array,
+     libcerror_error_t **error );
+
+int libolecf_directory_tree_get_sub_node_by_index(
+     libcdata_tree_node_t *directory_tree_node,
+     libolecf_directory_table_t *directory_table,
+     uint8_t byte_order,
+     int sub_node_index,
+     libcdata_tree_node_t **sub_directory_tree_node,
+     libcerror_error_t **error );
+
+int libolecf_directory_tree_get_sub_node_name_index(
+     libcdata_tree_node_t *directory_tree_node,
      uint8_t byte_order,
+     libolecf_name_index_t **name_index,
      libcerror_error_t **error );
 
 int libolecf_directory_tree_get_sub_node_by_utf8_name(
      libcdata_tree_node_t *directory_tree_node,
+     libolecf_directory_table_t *directory_table,
      const uint8_t *utf8_string,
      size_t utf8_string_length,
      uint8_t byte_order,
@@ -62,6 +116,7 @@ int libolecf_directory_tree_get_sub_node_by_utf8_name(
 
 int libolecf_directory_tree_get_sub_node_by_utf16_name(
      libcdata_tree_node_t *directory_tree_node,
+     libolecf_directory_table_t *directory_table,
      const uint16_t *utf16_string,
      size_t utf16_string_length,
      uint8_t byte_order,
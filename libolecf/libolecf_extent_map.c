@@ -0,0 +1,460 @@
+/*
+ * Extent map functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libolecf_extent_map.h"
+#include "libolecf_libcerror.h"
+
+/* Creates an extent map
+ * Make sure the value extent_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_extent_map_initialize(
+     libolecf_extent_map_t **extent_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_extent_map_initialize";
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extent map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*extent_map = memory_allocate_structure(
+	               libolecf_extent_map_t );
+
+	if( *extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create extent map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *extent_map,
+	     0,
+	     sizeof( libolecf_extent_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear extent map.",
+		 function );
+
+		memory_free(
+		 *extent_map );
+
+		*extent_map = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *extent_map != NULL )
+	{
+		memory_free(
+		 *extent_map );
+
+		*extent_map = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an extent map
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_extent_map_free(
+     libolecf_extent_map_t **extent_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_extent_map_free";
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent_map != NULL )
+	{
+		if( ( *extent_map )->extents != NULL )
+		{
+			memory_free(
+			 ( *extent_map )->extents );
+		}
+		memory_free(
+		 *extent_map );
+
+		*extent_map = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an extent to the extent map
+ * The short-sector stream offset should be -1 if the extent is not stored in the short-sector stream
+ * The extent is merged with the last extent if both are contiguous in the file
+ * and in the short-sector stream
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_extent_map_append_extent(
+     libolecf_extent_map_t *extent_map,
+     off64_t file_offset,
+     off64_t short_sector_stream_offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libolecf_extent_t *extent       = NULL;
+	void *reallocation              = NULL;
+	static char *function           = "libolecf_extent_map_append_extent";
+	size_t extents_size             = 0;
+	int number_of_allocated_extents = 0;
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( short_sector_stream_offset < -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid short-sector stream offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size64_t) INT64_MAX )
+	 || ( extent_map->size > ( (size64_t) INT64_MAX - size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_map->number_of_extents > 0 )
+	{
+		extent = &( extent_map->extents[ extent_map->number_of_extents - 1 ] );
+
+		if( ( ( extent->file_offset + (off64_t) extent->size ) == file_offset )
+		 && ( ( short_sector_stream_offset == -1 )
+		  || ( ( extent->short_sector_stream_offset + (off64_t) extent->size ) == short_sector_stream_offset ) ) )
+		{
+			extent->size     += size;
+			extent_map->size += size;
+
+			return( 1 );
+		}
+	}
+	if( extent_map->number_of_extents >= extent_map->number_of_allocated_extents )
+	{
+		if( extent_map->number_of_allocated_extents == 0 )
+		{
+			number_of_allocated_extents = 16;
+		}
+		else
+		{
+			number_of_allocated_extents = extent_map->number_of_allocated_extents * 2;
+		}
+		if( (size_t) number_of_allocated_extents > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libolecf_extent_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of allocated extents value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		extents_size = sizeof( libolecf_extent_t ) * number_of_allocated_extents;
+
+		reallocation = memory_reallocate(
+		                extent_map->extents,
+		                extents_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize extents.",
+			 function );
+
+			return( -1 );
+		}
+		extent_map->extents                     = (libolecf_extent_t *) reallocation;
+		extent_map->number_of_allocated_extents = number_of_allocated_extents;
+	}
+	extent = &( extent_map->extents[ extent_map->number_of_extents ] );
+
+	extent->offset                     = (off64_t) extent_map->size;
+	extent->file_offset                = file_offset;
+	extent->size                       = size;
+	extent->short_sector_stream_offset = short_sector_stream_offset;
+
+	extent_map->number_of_extents += 1;
+	extent_map->size              += size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of extents
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_extent_map_get_number_of_extents(
+     libolecf_extent_map_t *extent_map,
+     int *number_of_extents,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_extent_map_get_number_of_extents";
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_extents = extent_map->number_of_extents;
+
+	return( 1 );
+}
+
+/* Retrieves a specific extent
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_extent_map_get_extent_by_index(
+     libolecf_extent_map_t *extent_map,
+     int extent_index,
+     off64_t *offset,
+     off64_t *file_offset,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libolecf_extent_t *extent = NULL;
+	static char *function     = "libolecf_extent_map_get_extent_by_index";
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( extent_index < 0 )
+	 || ( extent_index >= extent_map->number_of_extents ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid extent index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	extent = &( extent_map->extents[ extent_index ] );
+
+	*offset      = extent->offset;
+	*file_offset = extent->file_offset;
+	*size        = extent->size;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the extent that contains a specific (stream) offset
+ * Returns 1 if successful, 0 if no such extent or -1 on error
+ */
+int libolecf_extent_map_get_extent_index_by_offset(
+     libolecf_extent_map_t *extent_map,
+     off64_t offset,
+     int *extent_index,
+     libcerror_error_t **error )
+{
+	libolecf_extent_t *extent = NULL;
+	static char *function     = "libolecf_extent_map_get_extent_index_by_offset";
+	int lower_extent_index    = 0;
+	int middle_extent_index   = 0;
+	int upper_extent_index    = 0;
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( (size64_t) offset >= extent_map->size ) )
+	{
+		return( 0 );
+	}
+	/* The extents are stored in ascending (stream) offset order
+	 */
+	upper_extent_index = extent_map->number_of_extents;
+
+	while( lower_extent_index < upper_extent_index )
+	{
+		middle_extent_index = lower_extent_index + ( ( upper_extent_index - lower_extent_index ) / 2 );
+
+		extent = &( extent_map->extents[ middle_extent_index ] );
+
+		if( offset < extent->offset )
+		{
+			upper_extent_index = middle_extent_index;
+		}
+		else if( (size64_t) ( offset - extent->offset ) >= extent->size )
+		{
+			lower_extent_index = middle_extent_index + 1;
+		}
+		else
+		{
+			*extent_index = middle_extent_index;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,115 @@
+/*
+ * Extent map functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBOLECF_EXTENT_MAP_H )
+#define _LIBOLECF_EXTENT_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libolecf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libolecf_extent libolecf_extent_t;
+
+struct libolecf_extent
+{
+	/* The (stream) offset
+	 */
+	off64_t offset;
+
+	/* The file offset
+	 */
+	off64_t file_offset;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The short-sector stream offset or -1 if not stored in the short-sector stream
+	 */
+	off64_t short_sector_stream_offset;
+};
+
+typedef struct libolecf_extent_map libolecf_extent_map_t;
+
+struct libolecf_extent_map
+{
+	/* The extents
+	 */
+	libolecf_extent_t *extents;
+
+	/* The number of extents
+	 */
+	int number_of_extents;
+
+	/* The number of allocated extents
+	 */
+	int number_of_allocated_extents;
+
+	/* The (stream) size
+	 */
+	size64_t size;
+};
+
+int libolecf_extent_map_initialize(
+     libolecf_extent_map_t **extent_map,
+     libcerror_error_t **error );
+
+int libolecf_extent_map_free(
+     libolecf_extent_map_t **extent_map,
+     libcerror_error_t **error );
+
+int libolecf_extent_map_append_extent(
+     libolecf_extent_map_t *extent_map,
+     off64_t file_offset,
+     off64_t short_sector_stream_offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libolecf_extent_map_get_number_of_extents(
+     libolecf_extent_map_t *extent_map,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
+int libolecf_extent_map_get_extent_by_index(
+     libolecf_extent_map_t *extent_map,
+     int extent_index,
+     off64_t *offset,
+     off64_t *file_offset,
+     size64_t *size,
+     libcerror_error_t **error );
+
+int libolecf_extent_map_get_extent_index_by_offset(
+     libolecf_extent_map_t *extent_map,
+     off64_t offset,
+     int *extent_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBOLECF_EXTENT_MAP_H ) */
+
@@ -26,10 +26,12 @@
 #include <wide_string.h>
 
 #include "libolecf_codepage.h"
+#include "libolecf_allocation_table.h"
 #include "libolecf_debug.h"
 #include "libolecf_definitions.h"
 #include "libolecf_directory_entry.h"
 #include "libolecf_directory_tree.h"
+#include "libolecf_extent_map.h"
 #include "libolecf_file.h"
 #include "libolecf_file_header.h"
 #include "libolecf_item.h"
@@ -39,6 +41,8 @@
 #include "libolecf_libcerror.h"
 #include "libolecf_libcnotify.h"
 #include "libolecf_libuna.h"
+#include "libolecf_memory_map.h"
+#include "libolecf_read_ahead.h"
 #include "libolecf_types.h"
 
 /* Creates a file
@@ -115,6 +119,21 @@ int libolecf_file_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_file->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	*file = (libolecf_file_t *) internal_file;
 
 	return( 1 );
@@ -122,6 +141,12 @@ int libolecf_file_initialize(
 on_error:
 	if( internal_file != NULL )
 	{
+		if( internal_file->io_handle != NULL )
+		{
+			libolecf_io_handle_free(
+			 &( internal_file->io_handle ),
+			 NULL );
+		}
 		memory_free(
 		 internal_file );
 	}
@@ -188,6 +213,21 @@ int libolecf_file_free(
 				result = -1;
 			}
 		}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_file->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 internal_file );
 	}
@@ -336,6 +376,59 @@ int libolecf_file_open(
 	}
 	internal_file->file_io_handle_created_in_library = 1;
 
+	if( ( access_flags & LIBOLECF_ACCESS_FLAG_MEMORY_MAP ) != 0 )
+	{
+		/* Inputs that cannot be memory mapped are read using the file IO handle
+		 */
+		if( libolecf_file_open_memory_map(
+		     internal_file,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to memory map file: %s.",
+			 function,
+			 filename );
+
+			libolecf_file_close(
+			 file,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( ( access_flags & LIBOLECF_ACCESS_FLAG_READ_AHEAD ) != 0 )
+	{
+		/* Read-ahead is an optimization, the file is read without prefetching
+		 * if the read-ahead cannot be opened
+		 */
+		if( libolecf_file_open_read_ahead(
+		     internal_file,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open read-ahead for file: %s.",
+			 function,
+			 filename );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( libcnotify_verbose != 0 )
+			 && ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+	}
 	return( 1 );
 
 on_error:
@@ -453,6 +546,59 @@ int libolecf_file_open_wide(
 	}
 	internal_file->file_io_handle_created_in_library = 1;
 
+	if( ( access_flags & LIBOLECF_ACCESS_FLAG_MEMORY_MAP ) != 0 )
+	{
+		/* Inputs that cannot be memory mapped are read using the file IO handle
+		 */
+		if( libolecf_file_open_memory_map(
+		     internal_file,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to memory map file: %ls.",
+			 function,
+			 filename );
+
+			libolecf_file_close(
+			 file,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( ( access_flags & LIBOLECF_ACCESS_FLAG_READ_AHEAD ) != 0 )
+	{
+		/* Read-ahead is an optimization, the file is read without prefetching
+		 * if the read-ahead cannot be opened
+		 */
+		if( libolecf_file_open_read_ahead(
+		     internal_file,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open read-ahead for file: %ls.",
+			 function,
+			 filename );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( libcnotify_verbose != 0 )
+			 && ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+	}
 	return( 1 );
 
 on_error:
@@ -468,6 +614,7 @@ on_error:
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
 /* Opens a file using a Basic File IO (bfio) handle
+ * Reads are not prefetched since the type of the file IO handle is not known
  * Returns 1 if successful or -1 on error
  */
 int libolecf_file_open_file_io_handle(
@@ -480,6 +627,7 @@ int libolecf_file_open_file_io_handle(
 	static char *function                   = "libolecf_file_open_file_io_handle";
 	int bfio_access_flags                   = 0;
 	int file_io_handle_is_open              = 0;
+	int result                              = 0;
 
 	if( file == NULL )
 	{
@@ -576,10 +724,29 @@ int libolecf_file_open_file_io_handle(
 		}
 		internal_file->file_io_handle_opened_in_library = 1;
 	}
-	if( libolecf_file_open_read(
-	     internal_file,
-	     file_io_handle,
+	internal_file->access_flags = access_flags;
+
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	result = libolecf_file_open_read(
+	          internal_file,
+	          file_io_handle,
+	          error );
+
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -587,14 +754,35 @@ int libolecf_file_open_file_io_handle(
 		 LIBCERROR_IO_ERROR_READ_FAILED,
 		 "%s: unable to read from file handle.",
 		 function );
+	}
+	else
+	{
+		internal_file->file_io_handle = file_io_handle;
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
 		goto on_error;
 	}
-	internal_file->file_io_handle = file_io_handle;
-
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
+	internal_file->access_flags = 0;
+
 	if( ( file_io_handle_is_open == 0 )
 	 && ( internal_file->file_io_handle_opened_in_library != 0 ) )
 	{
@@ -644,6 +832,21 @@ int libolecf_file_close(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -700,7 +903,40 @@ int libolecf_file_close(
 		internal_file->file_io_handle_created_in_library = 0;
 	}
 	internal_file->file_io_handle = NULL;
+	internal_file->access_flags   = 0;
+
+	if( internal_file->read_ahead != NULL )
+	{
+		if( libolecf_read_ahead_free(
+		     &( internal_file->read_ahead ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read-ahead.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->memory_map != NULL )
+	{
+		if( libolecf_memory_map_free(
+		     &( internal_file->memory_map ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free memory map.",
+			 function );
 
+			result = -1;
+		}
+	}
 	if( libolecf_io_handle_clear(
 	     internal_file->io_handle,
 	     error ) != 1 )
@@ -714,6 +950,20 @@ int libolecf_file_close(
 
 		result = -1;
 	}
+	if( internal_file->metadata_is_shared != 0 )
+	{
+		/* The metadata of a clone is owned by the source file
+		 */
+		internal_file->sat                                          = NULL;
+		internal_file->ssat                                         = NULL;
+		internal_file->directory_tree_root_node                     = NULL;
+		internal_file->directory_table                              = NULL;
+		internal_file->summary_information_directory_entry          = NULL;
+		internal_file->document_summary_information_directory_entry = NULL;
+		internal_file->metadata_is_shared                           = 0;
+	}
+	internal_file->metadata_is_complete = 0;
+
 	if( internal_file->msat != NULL )
 	{
 		 if( libolecf_allocation_table_free(
@@ -781,9 +1031,11 @@ int libolecf_file_close(
 	}
 	if( internal_file->directory_tree_root_node != NULL )
 	{
+		/* The directory entries are managed by the directory table
+		 */
 		if( libcdata_tree_node_free(
 		     &( internal_file->directory_tree_root_node ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libolecf_directory_entry_free,
+		     NULL,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -796,6 +1048,37 @@ int libolecf_file_close(
 			result = -1;
 		}
 	}
+	if( internal_file->directory_table != NULL )
+	{
+		if( libolecf_directory_table_free(
+		     &( internal_file->directory_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory table.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	return( result );
 }
 
@@ -807,10 +1090,11 @@ int libolecf_file_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	libcdata_list_t *directory_entry_list = NULL;
-	libolecf_file_header_t *file_header   = NULL;
-	static char *function                 = "libolecf_file_open_read";
-	int result                            = 0;
+	libolecf_directory_table_t *directory_table = NULL;
+	libolecf_file_header_t *file_header         = NULL;
+	static char *function                       = "libolecf_file_open_read";
+	uint8_t read_on_demand                      = 0;
+	int result                                  = 0;
 
 	if( internal_file == NULL )
 	{
@@ -889,6 +1173,17 @@ int libolecf_file_open_read(
 
 		return( -1 );
 	}
+	if( internal_file->directory_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - directory table already set.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -990,13 +1285,31 @@ int libolecf_file_open_read(
 
 		goto on_error;
 	}
-	if( libolecf_io_handle_read_sat(
-	     internal_file->io_handle,
-	     file_io_handle,
-	     internal_file->msat,
-	     internal_file->sat,
-	     file_header->number_of_sat_sectors,
-	     error ) != 1 )
+	if( ( internal_file->access_flags & LIBOLECF_ACCESS_FLAG_LOAD_ON_DEMAND ) != 0 )
+	{
+		read_on_demand = 1;
+	}
+	if( read_on_demand != 0 )
+	{
+		result = libolecf_io_handle_read_sat_on_demand(
+		          internal_file->io_handle,
+		          file_io_handle,
+		          internal_file->msat,
+		          internal_file->sat,
+		          file_header->number_of_sat_sectors,
+		          error );
+	}
+	else
+	{
+		result = libolecf_io_handle_read_sat(
+		          internal_file->io_handle,
+		          file_io_handle,
+		          internal_file->msat,
+		          internal_file->sat,
+		          file_header->number_of_sat_sectors,
+		          error );
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -1007,6 +1320,21 @@ int libolecf_file_open_read(
 
 		goto on_error;
 	}
+	/* The MSAT is only needed to read the SAT
+	 */
+	if( libolecf_allocation_table_free(
+	     &( internal_file->msat ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free MSAT.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -1046,6 +1374,41 @@ int libolecf_file_open_read(
 
 		goto on_error;
 	}
+	if( read_on_demand == 0 )
+	{
+		if( internal_file->sat->number_of_sector_identifiers >= LIBOLECF_ALLOCATION_TABLE_RUN_LENGTH_ENCODING_THRESHOLD )
+		{
+			if( libolecf_allocation_table_compact(
+			     internal_file->sat,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to compact SAT.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( internal_file->ssat->number_of_sector_identifiers >= LIBOLECF_ALLOCATION_TABLE_RUN_LENGTH_ENCODING_THRESHOLD )
+		{
+			if( libolecf_allocation_table_compact(
+			     internal_file->ssat,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to compact SSAT.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -1053,15 +1416,15 @@ int libolecf_file_open_read(
 		 "Reading directory entries:\n" );
 	}
 #endif
-	if( libcdata_list_initialize(
-	     &directory_entry_list,
+	if( libolecf_directory_table_initialize(
+	     &directory_table,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create directory entry list.",
+		 "%s: unable to create directory table.",
 		 function );
 
 		goto on_error;
@@ -1070,7 +1433,7 @@ int libolecf_file_open_read(
 	     internal_file->io_handle,
 	     file_io_handle,
 	     internal_file->sat,
-	     directory_entry_list,
+	     directory_table,
 	     file_header->root_directory_sector_identifier,
 	     error ) != 1 )
 	{
@@ -1108,8 +1471,9 @@ int libolecf_file_open_read(
 	          &( internal_file->io_handle->short_sector_stream_start_sector_identifier ),
 	          &( internal_file->document_summary_information_directory_entry ),
 	          &( internal_file->summary_information_directory_entry ),
-	          directory_entry_list,
+	          directory_table,
 	          internal_file->io_handle->byte_order,
+	          read_on_demand,
 	          error );
 
 	if( result == -1 )
@@ -1123,20 +1487,12 @@ int libolecf_file_open_read(
 
 		goto on_error;
 	}
-	if( libcdata_list_free(
-	     &directory_entry_list,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libolecf_directory_entry_free_not_in_tree,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free directory entry list.",
-		 function );
+	/* The directory table is retained since it contains the directory entries
+	 * of the directory tree, when the directory tree is read on demand it is also
+	 * used to create the sub nodes of the directory tree when they are first accessed
+	 */
+	internal_file->directory_table = directory_table;
 
-		goto on_error;
-	}
 	return( 1 );
 
 on_error:
@@ -1154,11 +1510,10 @@ on_error:
 		 NULL,
 		 NULL );
 	}
-	if( directory_entry_list != NULL )
+	if( directory_table != NULL )
 	{
-		libcdata_list_free(
-		 &directory_entry_list,
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libolecf_directory_entry_free,
+		libolecf_directory_table_free(
+		 &directory_table,
 		 NULL );
 	}
 	if( internal_file->ssat != NULL )
@@ -1188,18 +1543,26 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the sector size
+/* Reads the metadata that is otherwise read on demand
+ * Afterwards the metadata is not modified when it is accessed so that it can be shared
  * Returns 1 if successful or -1 on error
  */
-int libolecf_file_get_sector_size(
-     libolecf_file_t *file,
-     size32_t *sector_size,
+int libolecf_file_read_all_metadata(
+     libolecf_internal_file_t *internal_file,
      libcerror_error_t **error )
 {
-	libolecf_internal_file_t *internal_file = NULL;
-	static char *function                   = "libolecf_file_get_sector_size";
+	libcdata_array_t *sub_nodes_array              = NULL;
+	libcdata_tree_node_t *directory_tree_node      = NULL;
+	libcdata_tree_node_t *next_directory_tree_node = NULL;
+	libolecf_directory_entry_t *directory_entry    = NULL;
+	libolecf_extent_map_t *extent_map              = NULL;
+	libolecf_name_index_t *name_index              = NULL;
+	const uint8_t *utf8_name                       = NULL;
+	static char *function                          = "libolecf_file_read_all_metadata";
+	size_t utf8_name_size                          = 0;
+	int result                                     = 0;
 
-	if( file == NULL )
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1210,8 +1573,6 @@ int libolecf_file_get_sector_size(
 
 		return( -1 );
 	}
-	internal_file = (libolecf_internal_file_t *) file;
-
 	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -1223,156 +1584,450 @@ int libolecf_file_get_sector_size(
 
 		return( -1 );
 	}
-	if( sector_size == NULL )
+	if( internal_file->metadata_is_complete != 0 )
+	{
+		return( 1 );
+	}
+	if( libolecf_allocation_table_read_all_table_sectors(
+	     internal_file->sat,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid size.",
-		 function );
-
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read SAT.",
+		 function );
+
 		return( -1 );
 	}
-	if( internal_file->io_handle->sector_size > (size_t) UINT32_MAX )
+	if( libolecf_allocation_table_read_all_table_sectors(
+	     internal_file->ssat,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid sector size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read SSAT.",
 		 function );
 
 		return( -1 );
 	}
-	*sector_size = (size32_t) internal_file->io_handle->sector_size;
+	directory_tree_node = internal_file->directory_tree_root_node;
+
+	while( directory_tree_node != NULL )
+	{
+		if( libolecf_directory_tree_read_sub_nodes(
+		     directory_tree_node,
+		     internal_file->directory_table,
+		     internal_file->io_handle->byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read sub nodes.",
+			 function );
+
+			return( -1 );
+		}
+		if( libolecf_directory_tree_get_sub_nodes_array(
+		     directory_tree_node,
+		     &sub_nodes_array,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub nodes array.",
+			 function );
+
+			return( -1 );
+		}
+		if( libolecf_directory_tree_get_sub_node_name_index(
+		     directory_tree_node,
+		     internal_file->io_handle->byte_order,
+		     &name_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub node name index.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdata_tree_node_get_value(
+		     directory_tree_node,
+		     (intptr_t **) &directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry.",
+			 function );
+
+			return( -1 );
+		}
+		if( directory_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing directory entry.",
+			 function );
+
+			return( -1 );
+		}
+		/* A name or a sector chain that cannot be read is not fatal. The SAT and SSAT
+		 * were read in full above, so the sector chain walk only uses the in-memory
+		 * allocation tables and a failure is deterministic. A failure is never stored,
+		 * accessing the name or extent map later fails in the same way. A successfully
+		 * determined name or extent map is stored in the directory entry, which is
+		 * shared with the clones of the file.
+		 */
+		if( libolecf_directory_entry_get_utf8_name(
+		     directory_entry,
+		     internal_file->io_handle->byte_order,
+		     &utf8_name,
+		     &utf8_name_size,
+		     error ) != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( libcnotify_verbose != 0 )
+			 && ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		if( ( directory_entry->type == LIBOLECF_ITEM_TYPE_STREAM )
+		 && ( directory_entry->size > 0 ) )
+		{
+			result = libolecf_io_handle_get_stream_extent_map_with_lock(
+			          internal_file->io_handle,
+			          internal_file->sat,
+			          internal_file->ssat,
+			          directory_entry,
+			          &extent_map,
+			          error );
+
+			if( result != 1 )
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( ( libcnotify_verbose != 0 )
+				 && ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+#endif
+				libcerror_error_free(
+				 error );
+			}
+		}
+		/* Continue with the first sub node, the next node or the next node of a parent node
+		 */
+		if( libcdata_tree_node_get_first_sub_node(
+		     directory_tree_node,
+		     &next_directory_tree_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first sub node.",
+			 function );
+
+			return( -1 );
+		}
+		while( ( next_directory_tree_node == NULL )
+		    && ( directory_tree_node != internal_file->directory_tree_root_node ) )
+		{
+			if( libcdata_tree_node_get_next_node(
+			     directory_tree_node,
+			     &next_directory_tree_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next node.",
+				 function );
+
+				return( -1 );
+			}
+			if( next_directory_tree_node == NULL )
+			{
+				if( libcdata_tree_node_get_parent_node(
+				     directory_tree_node,
+				     &directory_tree_node,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve parent node.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+		directory_tree_node = next_directory_tree_node;
+	}
+	internal_file->metadata_is_complete = 1;
 
 	return( 1 );
 }
 
-/* Retrieves the short sector size
+/* Clones an open file
+ * The clone has its own file IO handle and caches but shares the metadata,
+ * such as the allocation tables and the directory tree, with the source file
+ * The first time a file is cloned all the metadata that is otherwise read on demand is read
+ * The source file must remain open until the clone is closed
  * Returns 1 if successful or -1 on error
  */
-int libolecf_file_get_short_sector_size(
-     libolecf_file_t *file,
-     size32_t *short_sector_size,
+int libolecf_file_clone(
+     libolecf_file_t **destination_file,
+     libolecf_file_t *source_file,
      libcerror_error_t **error )
 {
-	libolecf_internal_file_t *internal_file = NULL;
-	static char *function                   = "libolecf_file_get_short_sector_size";
+	libolecf_internal_file_t *internal_destination_file = NULL;
+	libolecf_internal_file_t *internal_source_file      = NULL;
+	libolecf_file_t *safe_destination_file              = NULL;
+	static char *function                               = "libolecf_file_clone";
+	int file_io_handle_is_open                          = 0;
 
-	if( file == NULL )
+	if( destination_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 "%s: invalid destination file.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libolecf_internal_file_t *) file;
-
-	if( internal_file->io_handle == NULL )
+	if( *destination_file != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination file value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( short_sector_size == NULL )
+	if( source_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid size.",
+		 "%s: invalid source file.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->io_handle->short_sector_size > (size_t) UINT32_MAX )
+	internal_source_file = (libolecf_internal_file_t *) source_file;
+
+	if( internal_source_file->file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid short sector size value exceeds maximum.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid source file - missing file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	*short_sector_size = (size32_t) internal_file->io_handle->short_sector_size;
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_source_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
-	return( 1 );
-}
+		return( -1 );
+	}
+#endif
+	if( libolecf_file_read_all_metadata(
+	     internal_source_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read metadata of source file.",
+		 function );
 
-/* Retrieves the ASCII codepage
- * Returns 1 if successful or -1 on error
- */
-int libolecf_file_get_ascii_codepage(
-     libolecf_file_t *file,
-     int *ascii_codepage,
-     libcerror_error_t **error )
-{
-	libolecf_internal_file_t *internal_file = NULL;
-	static char *function                   = "libolecf_file_get_ascii_codepage";
+		goto on_error;
+	}
+	if( libolecf_file_initialize(
+	     &safe_destination_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination file.",
+		 function );
 
-	if( file == NULL )
+		goto on_error;
+	}
+	internal_destination_file = (libolecf_internal_file_t *) safe_destination_file;
+
+	if( libbfio_handle_clone(
+	     &( internal_destination_file->file_io_handle ),
+	     internal_source_file->file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_file = (libolecf_internal_file_t *) file;
+	internal_destination_file->file_io_handle_created_in_library = 1;
 
-	if( internal_file->io_handle == NULL )
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          internal_destination_file->file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if destination file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     internal_destination_file->file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open destination file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_destination_file->file_io_handle_opened_in_library = 1;
+
+	if( libolecf_io_handle_copy_values(
+	     internal_destination_file->io_handle,
+	     internal_source_file->io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy IO handle values.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( ascii_codepage == NULL )
+	internal_destination_file->io_handle->uses_shared_directory_entries = 1;
+
+	internal_destination_file->access_flags                                 = LIBOLECF_ACCESS_FLAG_READ;
+	internal_destination_file->sat                                          = internal_source_file->sat;
+	internal_destination_file->ssat                                         = internal_source_file->ssat;
+	internal_destination_file->directory_tree_root_node                     = internal_source_file->directory_tree_root_node;
+	internal_destination_file->directory_table                              = internal_source_file->directory_table;
+	internal_destination_file->summary_information_directory_entry          = internal_source_file->summary_information_directory_entry;
+	internal_destination_file->document_summary_information_directory_entry = internal_source_file->document_summary_information_directory_entry;
+	internal_destination_file->metadata_is_complete                         = 1;
+	internal_destination_file->metadata_is_shared                           = 1;
+
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_source_file->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid ASCII codepage.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
+		libolecf_file_free(
+		 &safe_destination_file,
+		 NULL );
+
 		return( -1 );
 	}
-	*ascii_codepage = internal_file->io_handle->ascii_codepage;
+#endif
+	*destination_file = safe_destination_file;
 
 	return( 1 );
+
+on_error:
+	if( safe_destination_file != NULL )
+	{
+		libolecf_file_free(
+		 &safe_destination_file,
+		 NULL );
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_source_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Sets the ASCII codepage
+/* Retrieves the sector size
  * Returns 1 if successful or -1 on error
  */
-int libolecf_file_set_ascii_codepage(
+int libolecf_file_get_sector_size(
      libolecf_file_t *file,
-     int ascii_codepage,
+     size32_t *sector_size,
      libcerror_error_t **error )
 {
 	libolecf_internal_file_t *internal_file = NULL;
-	static char *function                   = "libolecf_file_set_ascii_codepage";
+	static char *function                   = "libolecf_file_get_sector_size";
 
 	if( file == NULL )
 	{
@@ -1398,21 +2053,196 @@ int libolecf_file_set_ascii_codepage(
 
 		return( -1 );
 	}
-	if( ( ascii_codepage != LIBOLECF_CODEPAGE_ASCII )
-	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_874 )
-	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_932 )
-	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_936 )
-	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_949 )
-	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_950 )
-	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_1250 )
-	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_1251 )
-	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_1252 )
-	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_1253 )
-	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_1254 )
-	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_1255 )
-	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_1256 )
-	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_1257 )
-	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_1258 ) )
+	if( sector_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->sector_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sector size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*sector_size = (size32_t) internal_file->io_handle->sector_size;
+
+	return( 1 );
+}
+
+/* Retrieves the short sector size
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_file_get_short_sector_size(
+     libolecf_file_t *file,
+     size32_t *short_sector_size,
+     libcerror_error_t **error )
+{
+	libolecf_internal_file_t *internal_file = NULL;
+	static char *function                   = "libolecf_file_get_short_sector_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libolecf_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( short_sector_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->short_sector_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid short sector size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*short_sector_size = (size32_t) internal_file->io_handle->short_sector_size;
+
+	return( 1 );
+}
+
+/* Retrieves the ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_file_get_ascii_codepage(
+     libolecf_file_t *file,
+     int *ascii_codepage,
+     libcerror_error_t **error )
+{
+	libolecf_internal_file_t *internal_file = NULL;
+	static char *function                   = "libolecf_file_get_ascii_codepage";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libolecf_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_codepage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	*ascii_codepage = internal_file->io_handle->ascii_codepage;
+
+	return( 1 );
+}
+
+/* Sets the ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_file_set_ascii_codepage(
+     libolecf_file_t *file,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libolecf_internal_file_t *internal_file = NULL;
+	static char *function                   = "libolecf_file_set_ascii_codepage";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libolecf_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_codepage != LIBOLECF_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBOLECF_CODEPAGE_WINDOWS_1258 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -1428,17 +2258,16 @@ int libolecf_file_set_ascii_codepage(
 	return( 1 );
 }
 
-/* Retrieves the format version
+/* Retrieves the maximum short-sector stream cache size
  * Returns 1 if successful or -1 on error
  */
-int libolecf_file_get_format_version(
+int libolecf_file_get_maximum_short_sector_stream_cache_size(
      libolecf_file_t *file,
-     uint16_t *major_version,
-     uint16_t *minor_version,
+     size_t *maximum_cache_size,
      libcerror_error_t **error )
 {
 	libolecf_internal_file_t *internal_file = NULL;
-	static char *function                   = "libolecf_file_get_format_version";
+	static char *function                   = "libolecf_file_get_maximum_short_sector_stream_cache_size";
 
 	if( file == NULL )
 	{
@@ -1464,32 +2293,1281 @@ int libolecf_file_get_format_version(
 
 		return( -1 );
 	}
-	if( major_version == NULL )
+	if( maximum_cache_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid major version.",
+		 "%s: invalid maximum cache size.",
 		 function );
 
 		return( -1 );
 	}
-	if( minor_version == NULL )
+	*maximum_cache_size = internal_file->io_handle->maximum_short_sector_stream_cache_size;
+
+	return( 1 );
+}
+
+/* Sets the maximum short-sector stream cache size
+ * A value of 0 disables the short-sector stream cache
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_file_set_maximum_short_sector_stream_cache_size(
+     libolecf_file_t *file,
+     size_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libolecf_internal_file_t *internal_file = NULL;
+	static char *function                   = "libolecf_file_set_maximum_short_sector_stream_cache_size";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid minor version.",
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	*major_version = internal_file->io_handle->major_format_version;
-	*minor_version = internal_file->io_handle->minor_format_version;
+	internal_file = (libolecf_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum cache size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_file->io_handle->short_sector_stream_data != NULL )
+	 && ( internal_file->io_handle->short_sector_stream_data_size > maximum_cache_size ) )
+	{
+		memory_free(
+		 internal_file->io_handle->short_sector_stream_data );
+
+		internal_file->io_handle->short_sector_stream_data      = NULL;
+		internal_file->io_handle->short_sector_stream_data_size = 0;
+	}
+	internal_file->io_handle->maximum_short_sector_stream_cache_size = maximum_cache_size;
+
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the maximum block cache size
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_file_get_maximum_block_cache_size(
+     libolecf_file_t *file,
+     size_t *maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libolecf_internal_file_t *internal_file = NULL;
+	static char *function                   = "libolecf_file_get_maximum_block_cache_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libolecf_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum cache size.",
+		 function );
+
+		return( -1 );
+	}
+	*maximum_cache_size = internal_file->io_handle->maximum_block_cache_size;
+
+	return( 1 );
+}
+
+/* Sets the maximum block cache size
+ * A value smaller than the block size disables the block cache
+ * Changing the maximum block cache size clears the block cache and its statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_file_set_maximum_block_cache_size(
+     libolecf_file_t *file,
+     size_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libolecf_internal_file_t *internal_file = NULL;
+	static char *function                   = "libolecf_file_set_maximum_block_cache_size";
+	int result                              = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libolecf_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum cache size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->io_handle->block_cache != NULL )
+	{
+		if( libolecf_block_cache_free(
+		     &( internal_file->io_handle->block_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free block cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		internal_file->io_handle->maximum_block_cache_size = maximum_cache_size;
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the block cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_file_get_block_cache_statistics(
+     libolecf_file_t *file,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	libolecf_internal_file_t *internal_file = NULL;
+	static char *function                   = "libolecf_file_get_block_cache_statistics";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libolecf_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+	/* The block cache statistics are updated by stream reads that only hold
+	 * the read lock of the file
+	 */
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->io_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->io_handle->block_cache == NULL )
+	{
+		*number_of_hits   = 0;
+		*number_of_misses = 0;
+	}
+	else
+	{
+		*number_of_hits   = internal_file->io_handle->block_cache->number_of_hits;
+		*number_of_misses = internal_file->io_handle->block_cache->number_of_misses;
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->io_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the size of the memory used by the allocation tables
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_file_get_allocation_table_memory_size(
+     libolecf_file_t *file,
+     size64_t *memory_size,
+     libcerror_error_t **error )
+{
+	libolecf_allocation_table_t *allocation_tables[ 3 ];
+
+	libolecf_internal_file_t *internal_file = NULL;
+	static char *function                   = "libolecf_file_get_allocation_table_memory_size";
+	size64_t safe_memory_size               = 0;
+	size_t allocation_table_memory_size     = 0;
+	int allocation_table_index              = 0;
+	int result                              = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libolecf_internal_file_t *) file;
+
+	if( memory_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	allocation_tables[ 0 ] = internal_file->msat;
+	allocation_tables[ 1 ] = internal_file->sat;
+	allocation_tables[ 2 ] = internal_file->ssat;
+
+	for( allocation_table_index = 0;
+	     allocation_table_index < 3;
+	     allocation_table_index++ )
+	{
+		if( allocation_tables[ allocation_table_index ] == NULL )
+		{
+			continue;
+		}
+		if( libolecf_allocation_table_get_memory_size(
+		     allocation_tables[ allocation_table_index ],
+		     &allocation_table_memory_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve memory size of allocation table: %d.",
+			 function,
+			 allocation_table_index );
+
+			result = -1;
+
+			break;
+		}
+		safe_memory_size += (size64_t) allocation_table_memory_size;
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		*memory_size = safe_memory_size;
+	}
+	return( result );
+}
+
+/* Retrieves the format version
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_file_get_format_version(
+     libolecf_file_t *file,
+     uint16_t *major_version,
+     uint16_t *minor_version,
+     libcerror_error_t **error )
+{
+	libolecf_internal_file_t *internal_file = NULL;
+	static char *function                   = "libolecf_file_get_format_version";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libolecf_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( major_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid major version.",
+		 function );
+
+		return( -1 );
+	}
+	if( minor_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid minor version.",
+		 function );
+
+		return( -1 );
+	}
+	*major_version = internal_file->io_handle->major_format_version;
+	*minor_version = internal_file->io_handle->minor_format_version;
+
+	return( 1 );
+}
+
+/* Memory maps the file of a file IO handle created by the library
+ * The file is mapped by the name of the file IO handle and is only used
+ * if it refers to the same file as the open file IO handle
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libolecf_file_open_memory_map(
+     libolecf_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI ) && defined( HAVE_WIDE_CHARACTER_TYPE )
+	wchar_t *filename     = NULL;
+#else
+	char *filename        = NULL;
+#endif
+	static char *function = "libolecf_file_open_memory_map";
+	size_t filename_size  = 0;
+	int result            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->memory_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - memory map already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && defined( HAVE_WIDE_CHARACTER_TYPE )
+	result = libbfio_file_get_name_size_wide(
+	          internal_file->file_io_handle,
+	          &filename_size,
+	          error );
+#else
+	result = libbfio_file_get_name_size(
+	          internal_file->file_io_handle,
+	          &filename_size,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename size from file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( filename_size == 0 )
+	 || ( filename_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( WINAPI ) && defined( HAVE_WIDE_CHARACTER_TYPE )
+	filename = wide_string_allocate(
+	            filename_size );
+#else
+	filename = narrow_string_allocate(
+	            filename_size );
+#endif
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( WINAPI ) && defined( HAVE_WIDE_CHARACTER_TYPE )
+	result = libbfio_file_get_name_wide(
+	          internal_file->file_io_handle,
+	          filename,
+	          filename_size,
+	          error );
+#else
+	result = libbfio_file_get_name(
+	          internal_file->file_io_handle,
+	          filename,
+	          filename_size,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename from file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libolecf_memory_map_initialize(
+	     &( internal_file->memory_map ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create memory map.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( WINAPI ) && defined( HAVE_WIDE_CHARACTER_TYPE )
+	result = libolecf_memory_map_open_wide(
+	          internal_file->memory_map,
+	          filename,
+	          error );
+#else
+	result = libolecf_memory_map_open(
+	          internal_file->memory_map,
+	          filename,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open memory map.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		/* The header, allocation tables and directory were read using the file IO handle
+		 * hence stream data is only read from the mapped file if both are the same file
+		 */
+		result = libolecf_memory_map_verify_file_io_handle(
+		          internal_file->memory_map,
+		          internal_file->file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify memory mapped file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		internal_file->io_handle->memory_mapped_data      = internal_file->memory_map->data;
+		internal_file->io_handle->memory_mapped_data_size = internal_file->memory_map->data_size;
+	}
+	else if( libolecf_memory_map_free(
+	          &( internal_file->memory_map ),
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free memory map.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 filename );
+
+	return( result );
+
+on_error:
+	if( internal_file->memory_map != NULL )
+	{
+		internal_file->io_handle->memory_mapped_data      = NULL;
+		internal_file->io_handle->memory_mapped_data_size = 0;
+
+		libolecf_memory_map_free(
+		 &( internal_file->memory_map ),
+		 NULL );
+	}
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	return( -1 );
+}
+
+/* Opens the read-ahead of a file IO handle created by the library
+ * The file IO handle is a file handle of which the name is used
+ * to open a separate file descriptor to advise the system
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libolecf_file_open_read_ahead(
+     libolecf_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	char *filename        = NULL;
+	static char *function = "libolecf_file_open_read_ahead";
+	size_t filename_size  = 0;
+	int result            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->read_ahead != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - read-ahead already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->memory_mapped_data != NULL )
+	{
+		return( 0 );
+	}
+	if( libbfio_file_get_name_size(
+	     internal_file->file_io_handle,
+	     &filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename size from file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( filename_size == 0 )
+	 || ( filename_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	filename = narrow_string_allocate(
+	            filename_size );
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_get_name(
+	     internal_file->file_io_handle,
+	     filename,
+	     filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename from file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libolecf_read_ahead_initialize(
+	     &( internal_file->read_ahead ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read-ahead.",
+		 function );
+
+		goto on_error;
+	}
+	result = libolecf_read_ahead_open(
+	          internal_file->read_ahead,
+	          filename,
+	          internal_file->file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open read-ahead.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		internal_file->io_handle->read_ahead = internal_file->read_ahead;
+	}
+	else if( libolecf_read_ahead_free(
+	          &( internal_file->read_ahead ),
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free read-ahead.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 filename );
+
+	return( result );
+
+on_error:
+	if( internal_file->read_ahead != NULL )
+	{
+		internal_file->io_handle->read_ahead = NULL;
+
+		libolecf_read_ahead_free(
+		 &( internal_file->read_ahead ),
+		 NULL );
+	}
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	return( -1 );
+}
+
+/* Reads the unallocated blocks
+ * The unallocated blocks are determined from the unused sectors in the SAT
+ * and the unused short-sectors in the SSAT, adjacent blocks are merged
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_file_read_unallocated_blocks(
+     libolecf_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	libolecf_extent_map_t *short_sector_stream_extent_map = NULL;
+	static char *function                                 = "libolecf_file_read_unallocated_blocks";
+	size64_t block_size                                   = 0;
+	size64_t extent_size                                  = 0;
+	size64_t file_size                                    = 0;
+	off64_t block_offset                                  = 0;
+	off64_t extent_file_offset                            = 0;
+	off64_t extent_offset                                 = 0;
+	off64_t short_sector_stream_offset                    = 0;
+	int entry_index                                       = 0;
+	int extent_index                                      = 0;
+	int range_entry_index                                 = 0;
+	int range_number_of_entries                           = 0;
+	int result                                            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->unallocated_block_list != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - unallocated block list already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->sat == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing SAT.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->ssat == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing SSAT.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_range_list_initialize(
+	     &( internal_file->unallocated_block_list ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create unallocated block list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_get_size(
+	     internal_file->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	/* The SAT can contain more entries than there are sectors in the file
+	 * hence the blocks are limited to the file size
+	 */
+	do
+	{
+		result = libolecf_allocation_table_get_unused_range(
+		          internal_file->sat,
+		          entry_index,
+		          &range_entry_index,
+		          &range_number_of_entries,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve unused range from SAT.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		entry_index = range_entry_index + range_number_of_entries;
+
+		block_offset = ( (off64_t) range_entry_index + 1 ) * internal_file->io_handle->sector_size;
+		block_size   = (size64_t) range_number_of_entries * internal_file->io_handle->sector_size;
+
+		if( (size64_t) block_offset >= file_size )
+		{
+			break;
+		}
+		if( block_size > ( file_size - (size64_t) block_offset ) )
+		{
+			block_size = file_size - (size64_t) block_offset;
+		}
+		if( libcdata_range_list_insert_range(
+		     internal_file->unallocated_block_list,
+		     (uint64_t) block_offset,
+		     (uint64_t) block_size,
+		     NULL,
+		     NULL,
+		     NULL,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert unallocated block into range list.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( result != 0 );
+
+	if( internal_file->ssat->number_of_sector_identifiers == 0 )
+	{
+		return( 1 );
+	}
+	if( libolecf_io_handle_get_short_sector_stream_extent_map(
+	     internal_file->io_handle,
+	     internal_file->sat,
+	     &short_sector_stream_extent_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve short-sector stream extent map.",
+		 function );
+
+		goto on_error;
+	}
+	/* The unused short-sectors are mapped onto the sectors of the short-sector stream
+	 */
+	entry_index = 0;
+
+	do
+	{
+		result = libolecf_allocation_table_get_unused_range(
+		          internal_file->ssat,
+		          entry_index,
+		          &range_entry_index,
+		          &range_number_of_entries,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve unused range from SSAT.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		entry_index = range_entry_index + range_number_of_entries;
+
+		short_sector_stream_offset = (off64_t) range_entry_index * internal_file->io_handle->short_sector_size;
+		block_size                 = (size64_t) range_number_of_entries * internal_file->io_handle->short_sector_size;
+
+		while( block_size > 0 )
+		{
+			result = libolecf_extent_map_get_extent_index_by_offset(
+			          short_sector_stream_extent_map,
+			          short_sector_stream_offset,
+			          &extent_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve short-sector stream extent index for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 short_sector_stream_offset,
+				 short_sector_stream_offset );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			if( libolecf_extent_map_get_extent_by_index(
+			     short_sector_stream_extent_map,
+			     extent_index,
+			     &extent_offset,
+			     &extent_file_offset,
+			     &extent_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve short-sector stream extent: %d.",
+				 function,
+				 extent_index );
+
+				goto on_error;
+			}
+			extent_size        -= (size64_t) ( short_sector_stream_offset - extent_offset );
+			extent_file_offset += short_sector_stream_offset - extent_offset;
+
+			if( extent_size > block_size )
+			{
+				extent_size = block_size;
+			}
+			if( libcdata_range_list_insert_range(
+			     internal_file->unallocated_block_list,
+			     (uint64_t) extent_file_offset,
+			     (uint64_t) extent_size,
+			     NULL,
+			     NULL,
+			     NULL,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert unallocated block into range list.",
+				 function );
+
+				goto on_error;
+			}
+			short_sector_stream_offset += (off64_t) extent_size;
+			block_size                 -= extent_size;
+		}
+		result = 1;
+	}
+	while( result != 0 );
 
 	return( 1 );
+
+on_error:
+	if( internal_file->unallocated_block_list != NULL )
+	{
+		libcdata_range_list_free(
+		 &( internal_file->unallocated_block_list ),
+		 NULL,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Retrieves the number of unallocated blocks
@@ -1502,6 +3580,7 @@ int libolecf_file_get_number_of_unallocated_blocks(
 {
 	libolecf_internal_file_t *internal_file = NULL;
 	static char *function                   = "libolecf_file_get_number_of_unallocated_blocks";
+	int result                              = 1;
 
 	if( file == NULL )
 	{
@@ -1516,22 +3595,49 @@ int libolecf_file_get_number_of_unallocated_blocks(
 	}
 	internal_file = (libolecf_internal_file_t *) file;
 
+	if( number_of_unallocated_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of unallocated blocks.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( internal_file->unallocated_block_list == NULL )
 	{
-		if( number_of_unallocated_blocks == NULL )
+		if( libolecf_file_read_unallocated_blocks(
+		     internal_file,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-			 "%s: invalid number of unallocated blocks.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read unallocated blocks.",
 			 function );
 
-			return( -1 );
+			result = -1;
 		}
-		*number_of_unallocated_blocks = 0;
 	}
-	else
+	if( result == 1 )
 	{
 		if( libcdata_range_list_get_number_of_elements(
 		     internal_file->unallocated_block_list,
@@ -1545,10 +3651,25 @@ int libolecf_file_get_number_of_unallocated_blocks(
 			 "%s: unable to retrieve number of elements.",
 			 function );
 
-			return( -1 );
+			result = -1;
 		}
 	}
-	return( 1 );
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
 }
 
 /* Retrieves a specific unallocated block
@@ -1564,6 +3685,7 @@ int libolecf_file_get_unallocated_block(
 	libolecf_internal_file_t *internal_file = NULL;
 	static char *function                   = "libolecf_file_get_unallocated_block";
 	intptr_t *value                         = NULL;
+	int result                              = 1;
 
 	if( file == NULL )
 	{
@@ -1578,25 +3700,74 @@ int libolecf_file_get_unallocated_block(
 	}
 	internal_file = (libolecf_internal_file_t *) file;
 
-	if( libcdata_range_list_get_range_by_index(
-	     internal_file->unallocated_block_list,
-	     unallocated_block_index,
-	     (uint64_t *) offset,
-	     (uint64_t *) size,
-	     &value,
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve unallocated block range: %d.",
-		 function,
-		 internal_file->unallocated_block_list );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	if( internal_file->unallocated_block_list == NULL )
+	{
+		if( libolecf_file_read_unallocated_blocks(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read unallocated blocks.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libcdata_range_list_get_range_by_index(
+		     internal_file->unallocated_block_list,
+		     unallocated_block_index,
+		     (uint64_t *) offset,
+		     (uint64_t *) size,
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve unallocated block range: %d.",
+			 function,
+			 unallocated_block_index );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
 }
 
 /* Retrieves the root item from the file
@@ -1609,6 +3780,7 @@ int libolecf_file_get_root_item(
 {
 	libolecf_internal_file_t *internal_file = NULL;
 	static char *function                   = "libolecf_file_get_root_item";
+	int result                              = 0;
 
 	if( file == NULL )
 	{
@@ -1645,52 +3817,82 @@ int libolecf_file_get_root_item(
 
 		return( -1 );
 	}
-	if( internal_file->directory_tree_root_node == NULL )
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
-		return( 0 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
 	}
-	if( libolecf_item_initialize(
-	     root_item,
-	     internal_file->io_handle,
-	     internal_file->file_io_handle,
-	     internal_file,
-	     internal_file->directory_tree_root_node,
+#endif
+	if( internal_file->directory_tree_root_node != NULL )
+	{
+		result = libolecf_item_initialize(
+		          root_item,
+		          internal_file->io_handle,
+		          internal_file->file_io_handle,
+		          internal_file,
+		          internal_file->directory_tree_root_node,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create root item.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create root item.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
 /* Retrieves the item for the specific UTF-8 encoded path
  * The path separator is the \ character
  * Returns 1 if successful, 0 if no such item or -1 on error
  */
-int libolecf_file_get_item_by_utf8_path(
-     libolecf_file_t *file,
+int libolecf_internal_file_get_item_by_utf8_path(
+     libolecf_internal_file_t *internal_file,
      const uint8_t *utf8_string,
      size_t utf8_string_length,
      libolecf_item_t **item,
      libcerror_error_t **error )
 {
-	libolecf_internal_file_t *internal_file       = NULL;
 	libcdata_tree_node_t *directory_tree_node     = NULL;
 	libcdata_tree_node_t *sub_directory_tree_node = NULL;
 	uint8_t *utf8_string_segment                  = NULL;
-	static char *function                         = "libolecf_file_get_item_by_utf8_path";
+	static char *function                         = "libolecf_internal_file_get_item_by_utf8_path";
 	libuna_unicode_character_t unicode_character  = 0;
 	size_t utf8_string_index                      = 0;
 	size_t utf8_string_segment_length             = 0;
 	int result                                    = 0;
 
-	if( file == NULL )
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1701,8 +3903,6 @@ int libolecf_file_get_item_by_utf8_path(
 
 		return( -1 );
 	}
-	internal_file = (libolecf_internal_file_t *) file;
-
 	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -1793,6 +3993,7 @@ int libolecf_file_get_item_by_utf8_path(
 		{
 			result = libolecf_directory_tree_get_sub_node_by_utf8_name(
 				  directory_tree_node,
+				  internal_file->directory_table,
 				  utf8_string_segment,
 				  utf8_string_segment_length,
 				  internal_file->io_handle->byte_order,
@@ -1839,28 +4040,106 @@ int libolecf_file_get_item_by_utf8_path(
 	return( result );
 }
 
-/* Retrieves the item for the specific UTF-16 encoded path
+/* Retrieves the item for the specific UTF-8 encoded path
  * The path separator is the \ character
  * Returns 1 if successful, 0 if no such item or -1 on error
  */
-int libolecf_file_get_item_by_utf16_path(
+int libolecf_file_get_item_by_utf8_path(
      libolecf_file_t *file,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libolecf_item_t **item,
+     libcerror_error_t **error )
+{
+	libolecf_internal_file_t *internal_file = NULL;
+	static char *function                   = "libolecf_file_get_item_by_utf8_path";
+	int result                              = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libolecf_internal_file_t *) file;
+
+	/* The directory tree is read on demand hence the write lock
+	 */
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libolecf_internal_file_get_item_by_utf8_path(
+	          internal_file,
+	          utf8_string,
+	          utf8_string_length,
+	          item,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve item by UTF-8 path.",
+		 function );
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the item for the specific UTF-16 encoded path
+ * The path separator is the \ character
+ * Returns 1 if successful, 0 if no such item or -1 on error
+ */
+int libolecf_internal_file_get_item_by_utf16_path(
+     libolecf_internal_file_t *internal_file,
      const uint16_t *utf16_string,
      size_t utf16_string_length,
      libolecf_item_t **item,
      libcerror_error_t **error )
 {
-	libolecf_internal_file_t *internal_file       = NULL;
 	libcdata_tree_node_t *directory_tree_node     = NULL;
 	libcdata_tree_node_t *sub_directory_tree_node = NULL;
 	uint16_t *utf16_string_segment                = NULL;
-	static char *function                         = "libolecf_file_get_item_by_utf16_path";
+	static char *function                         = "libolecf_internal_file_get_item_by_utf16_path";
 	libuna_unicode_character_t unicode_character  = 0;
 	size_t utf16_string_index                     = 0;
 	size_t utf16_string_segment_length            = 0;
 	int result                                    = 0;
 
-	if( file == NULL )
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1871,8 +4150,6 @@ int libolecf_file_get_item_by_utf16_path(
 
 		return( -1 );
 	}
-	internal_file = (libolecf_internal_file_t *) file;
-
 	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -1963,6 +4240,7 @@ int libolecf_file_get_item_by_utf16_path(
 		{
 			result = libolecf_directory_tree_get_sub_node_by_utf16_name(
 				  directory_tree_node,
+				  internal_file->directory_table,
 				  utf16_string_segment,
 				  utf16_string_segment_length,
 				  internal_file->io_handle->byte_order,
@@ -2009,3 +4287,82 @@ int libolecf_file_get_item_by_utf16_path(
 	return( result );
 }
 
+/* Retrieves the item for the specific UTF-16 encoded path
+ * The path separator is the \ character
+ * Returns 1 if successful, 0 if no such item or -1 on error
+ */
+int libolecf_file_get_item_by_utf16_path(
+     libolecf_file_t *file,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libolecf_item_t **item,
+     libcerror_error_t **error )
+{
+	libolecf_internal_file_t *internal_file = NULL;
+	static char *function                   = "libolecf_file_get_item_by_utf16_path";
+	int result                              = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libolecf_internal_file_t *) file;
+
+	/* The directory tree is read on demand hence the write lock
+	 */
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libolecf_internal_file_get_item_by_utf16_path(
+	          internal_file,
+	          utf16_string,
+	          utf16_string_length,
+	          item,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve item by UTF-16 path.",
+		 function );
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
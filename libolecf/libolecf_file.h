@@ -27,11 +27,15 @@
 
 #include "libolecf_allocation_table.h"
 #include "libolecf_directory_entry.h"
+#include "libolecf_directory_table.h"
 #include "libolecf_extern.h"
 #include "libolecf_io_handle.h"
 #include "libolecf_libbfio.h"
 #include "libolecf_libcdata.h"
 #include "libolecf_libcerror.h"
+#include "libolecf_libcthreads.h"
+#include "libolecf_memory_map.h"
+#include "libolecf_read_ahead.h"
 #include "libolecf_types.h"
 
 #if defined( __cplusplus )
@@ -58,6 +62,18 @@ struct libolecf_internal_file
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
+	/* The access flags
+	 */
+	int access_flags;
+
+	/* The memory map
+	 */
+	libolecf_memory_map_t *memory_map;
+
+	/* The read-ahead
+	 */
+	libolecf_read_ahead_t *read_ahead;
+
 	/* The master sector allocation table (MSAT)
 	 */
 	libolecf_allocation_table_t *msat;
@@ -78,6 +94,11 @@ struct libolecf_internal_file
 	 */
 	libcdata_tree_node_t *directory_tree_root_node;
 
+	/* The directory table
+	 * contains the directory entries referenced by the directory tree
+	 */
+	libolecf_directory_table_t *directory_table;
+
 	/* A reference to the summary information directory entry
 	 */
 	libolecf_directory_entry_t *summary_information_directory_entry;
@@ -85,6 +106,20 @@ struct libolecf_internal_file
 	/* A reference to the document summary information directory entry
 	 */
 	libolecf_directory_entry_t *document_summary_information_directory_entry;
+
+	/* Value to indicate all the metadata was read
+	 */
+	uint8_t metadata_is_complete;
+
+	/* Value to indicate the metadata is shared with the source file of a clone
+	 */
+	uint8_t metadata_is_shared;
+
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 LIBOLECF_EXTERN \
@@ -137,6 +172,28 @@ int libolecf_file_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libolecf_file_open_memory_map(
+     libolecf_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libolecf_file_open_read_ahead(
+     libolecf_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libolecf_file_read_unallocated_blocks(
+     libolecf_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libolecf_file_read_all_metadata(
+     libolecf_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+LIBOLECF_EXTERN \
+int libolecf_file_clone(
+     libolecf_file_t **destination_file,
+     libolecf_file_t *source_file,
+     libcerror_error_t **error );
+
 LIBOLECF_EXTERN \
 int libolecf_file_get_sector_size(
      libolecf_file_t *file,
@@ -161,6 +218,43 @@ int libolecf_file_set_ascii_codepage(
      int ascii_codepage,
      libcerror_error_t **error );
 
+LIBOLECF_EXTERN \
+int libolecf_file_get_maximum_short_sector_stream_cache_size(
+     libolecf_file_t *file,
+     size_t *maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBOLECF_EXTERN \
+int libolecf_file_set_maximum_short_sector_stream_cache_size(
+     libolecf_file_t *file,
+     size_t maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBOLECF_EXTERN \
+int libolecf_file_get_maximum_block_cache_size(
+     libolecf_file_t *file,
+     size_t *maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBOLECF_EXTERN \
+int libolecf_file_set_maximum_block_cache_size(
+     libolecf_file_t *file,
+     size_t maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBOLECF_EXTERN \
+int libolecf_file_get_block_cache_statistics(
+     libolecf_file_t *file,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+LIBOLECF_EXTERN \
+int libolecf_file_get_allocation_table_memory_size(
+     libolecf_file_t *file,
+     size64_t *memory_size,
+     libcerror_error_t **error );
+
 LIBOLECF_EXTERN \
 int libolecf_file_get_format_version(
      libolecf_file_t *file,
@@ -188,6 +282,13 @@ int libolecf_file_get_root_item(
      libolecf_item_t **root_item,
      libcerror_error_t **error );
 
+int libolecf_internal_file_get_item_by_utf8_path(
+     libolecf_internal_file_t *internal_file,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libolecf_item_t **item,
+     libcerror_error_t **error );
+
 LIBOLECF_EXTERN \
 int libolecf_file_get_item_by_utf8_path(
      libolecf_file_t *file,
@@ -196,6 +297,13 @@ int libolecf_file_get_item_by_utf8_path(
      libolecf_item_t **item,
      libcerror_error_t **error );
 
+int libolecf_internal_file_get_item_by_utf16_path(
+     libolecf_internal_file_t *internal_file,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libolecf_item_t **item,
+     libcerror_error_t **error );
+
 LIBOLECF_EXTERN \
 int libolecf_file_get_item_by_utf16_path(
      libolecf_file_t *file,
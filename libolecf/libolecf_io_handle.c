@@ -25,10 +25,13 @@
 #include <types.h>
 
 #include "libolecf_allocation_table.h"
+#include "libolecf_block_cache.h"
 #include "libolecf_codepage.h"
 #include "libolecf_debug.h"
 #include "libolecf_definitions.h"
 #include "libolecf_directory_entry.h"
+#include "libolecf_directory_table.h"
+#include "libolecf_extent_map.h"
 #include "libolecf_io_handle.h"
 #include "libolecf_libbfio.h"
 #include "libolecf_libcdata.h"
@@ -37,6 +40,8 @@
 #include "libolecf_libfguid.h"
 #include "libolecf_libuna.h"
 #include "libolecf_notify.h"
+#include "libolecf_read_ahead.h"
+#include "libolecf_read_ranges.h"
 
 #include "olecf_directory.h"
 #include "olecf_file_header.h"
@@ -109,8 +114,25 @@ int libolecf_io_handle_initialize(
 
 		return( -1 );
 	}
-	( *io_handle )->ascii_codepage = LIBOLECF_CODEPAGE_WINDOWS_1252;
+	( *io_handle )->ascii_codepage                         = LIBOLECF_CODEPAGE_WINDOWS_1252;
+	( *io_handle )->maximum_short_sector_stream_cache_size = LIBOLECF_DEFAULT_MAXIMUM_SHORT_SECTOR_STREAM_CACHE_SIZE;
+	( *io_handle )->maximum_block_cache_size               = LIBOLECF_DEFAULT_MAXIMUM_BLOCK_CACHE_SIZE;
 
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *io_handle )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	return( 1 );
 
 on_error:
@@ -147,6 +169,58 @@ int libolecf_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+		if( ( *io_handle )->short_sector_stream_extent_map != NULL )
+		{
+			if( libolecf_extent_map_free(
+			     &( ( *io_handle )->short_sector_stream_extent_map ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free short-sector stream extent map.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_handle )->short_sector_stream_data != NULL )
+		{
+			memory_free(
+			 ( *io_handle )->short_sector_stream_data );
+		}
+		if( ( *io_handle )->block_cache != NULL )
+		{
+			if( libolecf_block_cache_free(
+			     &( ( *io_handle )->block_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free block cache.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *io_handle )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 *io_handle );
 
@@ -164,6 +238,10 @@ int libolecf_io_handle_clear(
 {
 	static char *function = "libolecf_io_handle_clear";
 
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_t *read_write_lock = NULL;
+#endif
+
 	if( io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -175,6 +253,48 @@ int libolecf_io_handle_clear(
 
 		return( -1 );
 	}
+	if( io_handle->short_sector_stream_extent_map != NULL )
+	{
+		if( libolecf_extent_map_free(
+		     &( io_handle->short_sector_stream_extent_map ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free short-sector stream extent map.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( io_handle->block_cache != NULL )
+	{
+		if( libolecf_block_cache_free(
+		     &( io_handle->block_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free block cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( io_handle->short_sector_stream_data != NULL )
+	{
+		memory_free(
+		 io_handle->short_sector_stream_data );
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	/* The read/write lock is preserved
+	 */
+	read_write_lock = io_handle->read_write_lock;
+#endif
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -189,7 +309,61 @@ int libolecf_io_handle_clear(
 
 		return( -1 );
 	}
-	io_handle->ascii_codepage = LIBOLECF_CODEPAGE_WINDOWS_1252;
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	io_handle->read_write_lock = read_write_lock;
+#endif
+	io_handle->ascii_codepage                         = LIBOLECF_CODEPAGE_WINDOWS_1252;
+	io_handle->maximum_short_sector_stream_cache_size = LIBOLECF_DEFAULT_MAXIMUM_SHORT_SECTOR_STREAM_CACHE_SIZE;
+	io_handle->maximum_block_cache_size               = LIBOLECF_DEFAULT_MAXIMUM_BLOCK_CACHE_SIZE;
+
+	return( 1 );
+}
+
+/* Copies the format values and cache settings of the source IO handle
+ * The caches are not copied, the memory mapped file data is referenced
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_io_handle_copy_values(
+     libolecf_io_handle_t *destination_io_handle,
+     libolecf_io_handle_t *source_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_io_handle_copy_values";
+
+	if( destination_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	destination_io_handle->major_format_version                        = source_io_handle->major_format_version;
+	destination_io_handle->minor_format_version                        = source_io_handle->minor_format_version;
+	destination_io_handle->sector_size                                 = source_io_handle->sector_size;
+	destination_io_handle->short_sector_size                           = source_io_handle->short_sector_size;
+	destination_io_handle->sector_stream_minimum_data_size             = source_io_handle->sector_stream_minimum_data_size;
+	destination_io_handle->byte_order                                  = source_io_handle->byte_order;
+	destination_io_handle->short_sector_stream_start_sector_identifier = source_io_handle->short_sector_stream_start_sector_identifier;
+	destination_io_handle->maximum_short_sector_stream_cache_size      = source_io_handle->maximum_short_sector_stream_cache_size;
+	destination_io_handle->memory_mapped_data                          = source_io_handle->memory_mapped_data;
+	destination_io_handle->memory_mapped_data_size                     = source_io_handle->memory_mapped_data_size;
+	destination_io_handle->maximum_block_cache_size                    = source_io_handle->maximum_block_cache_size;
+	destination_io_handle->ascii_codepage                              = source_io_handle->ascii_codepage;
 
 	return( 1 );
 }
@@ -720,6 +894,131 @@ on_error:
 	return( 1 );
 }
 
+/* Prepares the SAT to be read on demand
+ * Instead of reading all SAT sectors only their locations are determined,
+ * a SAT sector is read the first time one of its entries is retrieved
+ * This function requires that the MSAT was read
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_io_handle_read_sat_on_demand(
+     libolecf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libolecf_allocation_table_t *msat,
+     libolecf_allocation_table_t *sat,
+     uint32_t number_of_sat_sectors,
+     libcerror_error_t **error )
+{
+	uint32_t *sat_sector_identifiers = NULL;
+	static char *function            = "libolecf_io_handle_read_sat_on_demand";
+	int msat_index                   = 0;
+	int sat_sector_index             = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( msat == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MSAT.",
+		 function );
+
+		return( -1 );
+	}
+	if( sat == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SAT.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sat_sectors > (uint32_t) msat->number_of_sector_identifiers )
+	{
+		number_of_sat_sectors = (uint32_t) msat->number_of_sector_identifiers;
+	}
+	if( number_of_sat_sectors == 0 )
+	{
+		return( 1 );
+	}
+	sat_sector_identifiers = (uint32_t *) memory_allocate(
+	                                       sizeof( uint32_t ) * number_of_sat_sectors );
+
+	if( sat_sector_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create SAT sector identifiers.",
+		 function );
+
+		goto on_error;
+	}
+	/* Empty MSAT entries are skipped in the same way as libolecf_io_handle_read_sat does
+	 */
+	for( msat_index = 0;
+	     msat_index < msat->number_of_sector_identifiers;
+	     msat_index++ )
+	{
+		if( msat->sector_identifiers[ msat_index ] == LIBOLECF_SECTOR_IDENTIFIER_UNUSED )
+		{
+			continue;
+		}
+		if( (uint32_t) sat_sector_index >= number_of_sat_sectors )
+		{
+			break;
+		}
+		sat_sector_identifiers[ sat_sector_index++ ] = msat->sector_identifiers[ msat_index ];
+	}
+	if( sat_sector_index > 0 )
+	{
+		if( libolecf_allocation_table_set_table_sectors(
+		     sat,
+		     file_io_handle,
+		     sat_sector_identifiers,
+		     sat_sector_index,
+		     io_handle->sector_size,
+		     io_handle->byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set SAT sectors.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 sat_sector_identifiers );
+
+	return( 1 );
+
+on_error:
+	if( sat_sector_identifiers != NULL )
+	{
+		memory_free(
+		 sat_sector_identifiers );
+	}
+	return( -1 );
+}
+
 /* Reads the SSAT
  * This function requires that the SAT was read
  * Returns 1 if successful or -1 on error
@@ -1009,7 +1308,7 @@ on_error:
 	return( 1 );
 }
 
-/* Reads the directory entries
+/* Reads the directory entries into the directory table
  * This function requires that the SAT was read
  * Returns 1 if successful or -1 on error
  */
@@ -1017,21 +1316,20 @@ int libolecf_io_handle_read_directory_entries(
      libolecf_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libolecf_allocation_table_t *sat,
-     libcdata_list_t *directory_entry_list,
+     libolecf_directory_table_t *directory_table,
      uint32_t root_directory_sector_identifier,
      libcerror_error_t **error )
 {
 	libcdata_range_list_t *read_directory_sector_list = NULL;
-	libolecf_directory_entry_t *directory_entry       = NULL;
-	uint8_t *directory_entry_data                     = NULL;
+	uint8_t *directory_data                           = NULL;
 	uint8_t *directory_sector                         = NULL;
+	void *reallocation                                = NULL;
 	static char *function                             = "libolecf_io_handle_read_directory_entries";
-	size_t number_of_directory_sector_entries         = 0;
+	size_t allocated_directory_data_size              = 0;
+	size_t directory_data_size                        = 0;
 	ssize_t read_count                                = 0;
 	off64_t directory_sector_offset                   = 0;
 	uint32_t directory_sector_identifier              = 0;
-	int directory_entry_index                         = 0;
-	int directory_sector_index                        = 0;
 	int recursion_depth                               = 0;
 	int result                                        = 0;
 
@@ -1070,13 +1368,13 @@ int libolecf_io_handle_read_directory_entries(
 
 		return( -1 );
 	}
-	if( directory_entry_list == NULL )
+	if( directory_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory entry list.",
+		 "%s: invalid directory table.",
 		 function );
 
 		return( -1 );
@@ -1092,22 +1390,6 @@ int libolecf_io_handle_read_directory_entries(
 
 		return( -1 );
 	}
-	number_of_directory_sector_entries = io_handle->sector_size / sizeof( olecf_directory_entry_t );
-
-	directory_sector = (uint8_t *) memory_allocate(
-	                                sizeof( uint8_t ) * io_handle->sector_size );
-
-	if( directory_sector == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create directory sector.",
-		 function );
-
-		goto on_error;
-	}
 	if( libcdata_range_list_initialize(
 	     &read_directory_sector_list,
 	     error ) != 1 )
@@ -1181,6 +1463,49 @@ int libolecf_io_handle_read_directory_entries(
 			 directory_sector_offset );
 		}
 #endif
+		/* The directory sectors are read into a single buffer so that the directory
+		 * table can be created with a single allocation for all the directory entries
+		 */
+		if( ( directory_data_size + io_handle->sector_size ) > allocated_directory_data_size )
+		{
+			if( allocated_directory_data_size == 0 )
+			{
+				allocated_directory_data_size = io_handle->sector_size;
+			}
+			else
+			{
+				allocated_directory_data_size *= 2;
+			}
+			if( allocated_directory_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid directory data size value exceeds maximum allocation size.",
+				 function );
+
+				goto on_error;
+			}
+			reallocation = memory_reallocate(
+			                directory_data,
+			                sizeof( uint8_t ) * allocated_directory_data_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize directory data.",
+				 function );
+
+				goto on_error;
+			}
+			directory_data = (uint8_t *) reallocation;
+		}
+		directory_sector = &( directory_data[ directory_data_size ] );
+
 		read_count = libbfio_handle_read_buffer_at_offset(
 			      file_io_handle,
 			      directory_sector,
@@ -1213,117 +1538,25 @@ int libolecf_io_handle_read_directory_entries(
 			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 		}
 #endif
-		directory_entry_data = directory_sector;
+		directory_data_size += io_handle->sector_size;
 
-		for( directory_sector_index = 0;
-		     (size_t) directory_sector_index < number_of_directory_sector_entries;
-		     directory_sector_index++ )
-		{
-			if( libolecf_directory_entry_initialize(
-			     &directory_entry,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create directory entry: %d.",
-				 function,
-				 directory_sector_index );
+		result = libcdata_range_list_insert_range(
+		          read_directory_sector_list,
+		          (uint64_t) directory_sector_identifier,
+		          (uint64_t) 1,
+		          NULL,
+		          NULL,
+		          NULL,
+		          error );
 
-				goto on_error;
-			}
-			result = libolecf_directory_entry_read_data(
-			          directory_entry,
-			          directory_entry_index,
-			          directory_entry_data,
-			          sizeof( olecf_directory_entry_t ),
-			          io_handle->byte_order,
-			          error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read directory entry: %d.",
-				 function,
-				 directory_sector_index );
-
-				goto on_error;
-			}
-			if( directory_entry->type == LIBOLECF_ITEM_TYPE_EMPTY )
-			{
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: directory sector entry: %d is empty (type is empty).\n",
-					 function,
-					 directory_sector_index );
-				}
-#endif
-				if( libolecf_directory_entry_free(
-				     &directory_entry,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free directory entry.",
-					 function );
-
-					goto on_error;
-				}
-			}
-			else
-			{
-				if( libcdata_list_append_value(
-				     directory_entry_list,
-				     (intptr_t *) directory_entry,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append directory entry.",
-					 function );
-
-					goto on_error;
-				}
-				directory_entry = NULL;
-			}
-			directory_entry_index++;
-
-			directory_entry_data += sizeof( olecf_directory_entry_t );
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "\n" );
-		}
-#endif
-		result = libcdata_range_list_insert_range(
-		          read_directory_sector_list,
-		          (uint64_t) directory_sector_identifier,
-		          (uint64_t) 1,
-		          NULL,
-		          NULL,
-		          NULL,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to insert directory sector into range list.",
-			 function );
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert directory sector into range list.",
+			 function );
 
 			goto on_error;
 		}
@@ -1372,20 +1605,32 @@ int libolecf_io_handle_read_directory_entries(
 
 		goto on_error;
 	}
-	memory_free(
-	 directory_sector );
+	if( directory_data != NULL )
+	{
+		if( libolecf_directory_table_read_data(
+		     directory_table,
+		     directory_data,
+		     directory_data_size,
+		     io_handle->byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory table.",
+			 function );
 
-	directory_sector = NULL;
+			goto on_error;
+		}
+		memory_free(
+		 directory_data );
 
+		directory_data = NULL;
+	}
 	return( 1 );
 
 on_error:
-	if( directory_entry != NULL )
-	{
-		libolecf_directory_entry_free(
-		 &directory_entry,
-		 NULL );
-	}
 	if( read_directory_sector_list != NULL )
 	{
 		libcdata_range_list_free(
@@ -1393,47 +1638,39 @@ on_error:
 		 NULL,
 		 NULL );
 	}
-	if( directory_sector != NULL )
+	if( directory_data != NULL )
 	{
 		memory_free(
-		 directory_sector );
+		 directory_data );
 	}
-	libcdata_list_empty(
-	 directory_entry_list,
-         (int (*)(intptr_t **, libcerror_error_t **)) &libolecf_directory_entry_free,
-	 NULL );
-
 	return( -1 );
 }
 
-/* Reads a buffer from the stream
- * This function requires that the SAT and SSAT were read
+/* Reads the extents of a sector chain into an extent map
+ * If sector_stream_extent_map is set the sector identifiers refer to short-sectors
+ * within the short-sector stream otherwise they refer to sectors within the file
+ * A maximum size of 0 represents the entire sector chain
  * Returns 1 if successful or -1 on error
  */
-ssize_t libolecf_io_handle_read_stream(
-         libolecf_io_handle_t *io_handle,
-         libbfio_handle_t *file_io_handle,
-         libolecf_allocation_table_t *sat,
-         libolecf_allocation_table_t *ssat,
-         libolecf_directory_entry_t *directory_entry,
-         off64_t *offset,
-         uint8_t *buffer,
-         size_t size,
-         libcerror_error_t **error )
+int libolecf_io_handle_read_sector_chain_extents(
+     libolecf_io_handle_t *io_handle,
+     libolecf_allocation_table_t *allocation_table,
+     uint32_t sector_identifier,
+     size_t sector_size,
+     size64_t maximum_size,
+     libolecf_extent_map_t *short_sector_stream_extent_map,
+     libolecf_extent_map_t *extent_map,
+     libcerror_error_t **error )
 {
-	libolecf_allocation_table_t *allocation_table  = NULL;
-	static char *function                          = "libolecf_io_handle_read_stream";
-	off64_t read_offset                            = 0;
-	off64_t safe_offset                            = 0;
-	off64_t sector_boundary_offset                 = 0;
-	size_t buffer_offset                           = 0;
-	size_t read_size                               = 0;
-	size_t sector_size                             = 0;
-	ssize_t read_count                             = 0;
-	uint32_t sector_identifier                     = 0;
-	uint32_t short_sector_stream_sector_identifier = 0;
-	int sector_identifier_index                    = 0;
-	int sector_identifier_iterator                 = 0;
+	static char *function                          = "libolecf_io_handle_read_sector_chain_extents";
+	off64_t file_offset                            = 0;
+	off64_t short_sector_stream_extent_offset      = 0;
+	off64_t short_sector_stream_extent_file_offset = 0;
+	off64_t short_sector_stream_offset             = 0;
+	size64_t short_sector_stream_extent_size       = 0;
+	int number_of_sectors                          = 0;
+	int result                                     = 0;
+	int short_sector_stream_extent_index           = 0;
 
 	if( io_handle == NULL )
 	{
@@ -1446,141 +1683,170 @@ ssize_t libolecf_io_handle_read_stream(
 
 		return( -1 );
 	}
-	if( directory_entry == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory entry.",
-		 function );
-
-		return( -1 );
-	}
-	if( offset == NULL )
+	if( allocation_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid offset.",
+		 "%s: invalid allocation table.",
 		 function );
 
 		return( -1 );
 	}
-	safe_offset = *offset;
-
-	if( safe_offset < 0 )
+	if( ( sector_size == 0 )
+	 || ( sector_size > (size_t) INT32_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid offset value out of bounds.",
+		 "%s: invalid sector size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-/* TODO offset upper boundary check ? */
-	if( buffer == NULL )
+	if( extent_map == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
-		 function );
-
-		return( -1 );
-	}
-	if( size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid size value exceeds maximum.",
+		 "%s: invalid extent map.",
 		 function );
 
 		return( -1 );
 	}
-	if( directory_entry->size < io_handle->sector_stream_minimum_data_size )
+	while( sector_identifier != LIBOLECF_SECTOR_IDENTIFIER_END_OF_CHAIN )
 	{
-		if( ssat == NULL )
+		if( ( maximum_size != 0 )
+		 && ( extent_map->size >= maximum_size ) )
+		{
+			break;
+		}
+		if( (int64_t) sector_identifier >= (int64_t) allocation_table->number_of_sector_identifiers )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-			 "%s: invalid SSAT.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid sector identifier: 0x%08" PRIx32 " value out of bounds.",
+			 function,
+			 sector_identifier );
 
 			return( -1 );
 		}
-		allocation_table = ssat;
-		sector_size      = io_handle->short_sector_size;
-	}
-	else
-	{
-		if( sat == NULL )
+		/* A sector chain cannot contain more sectors than the allocation table
+		 * otherwise it contains a loop
+		 */
+		if( number_of_sectors >= allocation_table->number_of_sector_identifiers )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-			 "%s: invalid SAT.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of sectors value out of bounds.",
 			 function );
 
 			return( -1 );
 		}
-		allocation_table = sat;
-		sector_size      = io_handle->sector_size;
-	}
-	sector_identifier_index = (int) ( safe_offset / sector_size );
+		number_of_sectors++;
 
-	if( ( sector_identifier_index < 0 )
-	 || ( sector_identifier_index >= allocation_table->number_of_sector_identifiers ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid sector identifier index value out of bounds.",
-		 function );
+		if( short_sector_stream_extent_map != NULL )
+		{
+			short_sector_stream_offset = (off64_t) sector_identifier * sector_size;
 
-		return( -1 );
-	}
-	sector_identifier = directory_entry->sector_identifier;
+			result = libolecf_extent_map_get_extent_index_by_offset(
+			          short_sector_stream_extent_map,
+			          short_sector_stream_offset,
+			          &short_sector_stream_extent_index,
+			          error );
 
-	for( sector_identifier_iterator = sector_identifier_index;
-	     sector_identifier_iterator > 0;
-	     sector_identifier_iterator-- )
-	{
-		if( sector_identifier == LIBOLECF_SECTOR_IDENTIFIER_END_OF_CHAIN )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid sector identifier.",
-			 function );
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve short-sector stream extent index for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 short_sector_stream_offset,
+				 short_sector_stream_offset );
 
-			return( -1 );
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid short-sector: 0x%08" PRIx32 " value out of bounds.",
+				 function,
+				 sector_identifier );
+
+				return( -1 );
+			}
+			if( libolecf_extent_map_get_extent_by_index(
+			     short_sector_stream_extent_map,
+			     short_sector_stream_extent_index,
+			     &short_sector_stream_extent_offset,
+			     &short_sector_stream_extent_file_offset,
+			     &short_sector_stream_extent_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve short-sector stream extent: %d.",
+				 function,
+				 short_sector_stream_extent_index );
+
+				return( -1 );
+			}
+			/* The short-sector stream consists of sectors so a short-sector
+			 * is always stored in a single extent
+			 */
+			if( (size64_t) ( short_sector_stream_offset - short_sector_stream_extent_offset ) > ( short_sector_stream_extent_size - sector_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid short-sector: 0x%08" PRIx32 " value out of bounds.",
+				 function,
+				 sector_identifier );
+
+				return( -1 );
+			}
+			file_offset = short_sector_stream_extent_file_offset
+			            + ( short_sector_stream_offset - short_sector_stream_extent_offset );
 		}
-#if SIZE_OF_INT <= 4
-		if( sector_identifier > (uint32_t) INT_MAX )
+		else
+		{
+			file_offset                = ( (off64_t) sector_identifier + 1 ) * sector_size;
+			short_sector_stream_offset = -1;
+		}
+		if( libolecf_extent_map_append_extent(
+		     extent_map,
+		     file_offset,
+		     short_sector_stream_offset,
+		     (size64_t) sector_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid sector identifier: 0x%08" PRIx32 " value out of bounds.",
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append sector: 0x%08" PRIx32 " to extent map.",
 			 function,
 			 sector_identifier );
 
 			return( -1 );
 		}
-#endif
+		/* The allocation table sectors can be read on demand
+		 */
 		if( libolecf_allocation_table_get_sector_identifier_by_index(
 		     allocation_table,
 		     (int) sector_identifier,
@@ -1591,148 +1857,2168 @@ ssize_t libolecf_io_handle_read_stream(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sector identifier: %" PRIu32 " from allocation table.",
+			 "%s: unable to retrieve sector identifier: 0x%08" PRIx32 " from allocation table.",
 			 function,
 			 sector_identifier );
 
 			return( -1 );
 		}
 	}
-	while( size > 0 )
+	return( 1 );
+}
+
+/* Retrieves the extent map of the short-sector stream
+ * The extent map is created on first access
+ * This function requires that the SAT was read
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_io_handle_get_short_sector_stream_extent_map(
+     libolecf_io_handle_t *io_handle,
+     libolecf_allocation_table_t *sat,
+     libolecf_extent_map_t **extent_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_io_handle_get_short_sector_stream_extent_map";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->short_sector_stream_extent_map == NULL )
 	{
-		if( sector_identifier == LIBOLECF_SECTOR_IDENTIFIER_END_OF_CHAIN )
+		if( libolecf_extent_map_initialize(
+		     &( io_handle->short_sector_stream_extent_map ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid sector identifier.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create short-sector stream extent map.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		sector_boundary_offset = (off64_t) ( sector_identifier_index * sector_size );
-
-		/* Determine start offset and read size
-		 */
-		if( directory_entry->size < io_handle->sector_stream_minimum_data_size )
+		if( libolecf_io_handle_read_sector_chain_extents(
+		     io_handle,
+		     sat,
+		     io_handle->short_sector_stream_start_sector_identifier,
+		     io_handle->sector_size,
+		     0,
+		     NULL,
+		     io_handle->short_sector_stream_extent_map,
+		     error ) != 1 )
 		{
-			read_offset = sector_identifier * sector_size;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read short-sector stream extents.",
+			 function );
 
-			short_sector_stream_sector_identifier = io_handle->short_sector_stream_start_sector_identifier;
+			goto on_error;
+		}
+	}
+	*extent_map = io_handle->short_sector_stream_extent_map;
 
-			while( read_offset >= (off64_t) io_handle->sector_size )
-			{
-#if SIZE_OF_INT <= 4
-				if( short_sector_stream_sector_identifier > (uint32_t) INT_MAX )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid short sector stream sector identifier: 0x%08" PRIx32 " value out of bounds.",
-					 function,
-					 short_sector_stream_sector_identifier );
+	return( 1 );
 
-					return( -1 );
-				}
-#endif
-				if( libolecf_allocation_table_get_sector_identifier_by_index(
-				     sat,
-				     (int) short_sector_stream_sector_identifier,
-				     &short_sector_stream_sector_identifier,
-				     error ) != 1 )
+on_error:
+	if( io_handle->short_sector_stream_extent_map != NULL )
+	{
+		libolecf_extent_map_free(
+		 &( io_handle->short_sector_stream_extent_map ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the short-sector stream data into the short-sector stream cache
+ * The short-sector stream is only cached if its size does not exceed
+ * the maximum short-sector stream cache size
+ * This function requires that the SAT was read
+ * Returns 1 if successful, 0 if the short-sector stream is not cached or -1 on error
+ */
+int libolecf_io_handle_read_short_sector_stream_data(
+     libolecf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libolecf_allocation_table_t *sat,
+     libcerror_error_t **error )
+{
+	libolecf_extent_map_t *extent_map = NULL;
+	libolecf_extent_t *extent         = NULL;
+	uint8_t *data                     = NULL;
+	static char *function             = "libolecf_io_handle_read_short_sector_stream_data";
+	size_t data_offset                = 0;
+	ssize_t read_count                = 0;
+	int extent_index                  = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->short_sector_stream_data != NULL )
+	{
+		return( 1 );
+	}
+	if( libolecf_io_handle_get_short_sector_stream_extent_map(
+	     io_handle,
+	     sat,
+	     &extent_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve short-sector stream extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( extent_map->size == 0 )
+	 || ( extent_map->size > (size64_t) io_handle->maximum_short_sector_stream_cache_size )
+	 || ( extent_map->size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		return( 0 );
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * (size_t) extent_map->size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create short-sector stream data.",
+		 function );
+
+		goto on_error;
+	}
+	for( extent_index = 0;
+	     extent_index < extent_map->number_of_extents;
+	     extent_index++ )
+	{
+		extent = &( extent_map->extents[ extent_index ] );
+
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              &( data[ data_offset ] ),
+		              (size_t) extent->size,
+		              extent->file_offset,
+		              error );
+
+		if( read_count != (ssize_t) extent->size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read short-sector stream data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 extent->file_offset,
+			 extent->file_offset );
+
+			goto on_error;
+		}
+		data_offset += (size_t) extent->size;
+	}
+	io_handle->short_sector_stream_data      = data;
+	io_handle->short_sector_stream_data_size = data_offset;
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Reads the short-sector stream data into the short-sector stream cache
+ * The read/write lock is only grabbed for writing if the short-sector stream data needs to be read
+ * Returns 1 if successful, 0 if the short-sector stream is not cached or -1 on error
+ */
+int libolecf_io_handle_read_short_sector_stream_data_with_lock(
+     libolecf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libolecf_allocation_table_t *sat,
+     libcerror_error_t **error )
+{
+	libolecf_extent_map_t *extent_map = NULL;
+	static char *function             = "libolecf_io_handle_read_short_sector_stream_data_with_lock";
+	int read_data                     = 0;
+	int result                        = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     io_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	extent_map = io_handle->short_sector_stream_extent_map;
+
+	if( io_handle->short_sector_stream_data != NULL )
+	{
+		result = 1;
+	}
+	/* A short-sector stream that exceeds the maximum cache size is not cached
+	 */
+	else if( ( extent_map == NULL )
+	      || ( ( extent_map->size > 0 )
+	        && ( extent_map->size <= (size64_t) io_handle->maximum_short_sector_stream_cache_size )
+	        && ( extent_map->size <= (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) ) )
+	{
+		read_data = 1;
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     io_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( read_data == 0 )
+	{
+		return( result );
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     io_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libolecf_io_handle_read_short_sector_stream_data(
+	          io_handle,
+	          file_io_handle,
+	          sat,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read short-sector stream data.",
+		 function );
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     io_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the extent map of the stream of a directory entry
+ * The extent map is created on first access and kept by the directory entry
+ * This function requires that the SAT and SSAT were read
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_io_handle_get_stream_extent_map(
+     libolecf_io_handle_t *io_handle,
+     libolecf_allocation_table_t *sat,
+     libolecf_allocation_table_t *ssat,
+     libolecf_directory_entry_t *directory_entry,
+     libolecf_extent_map_t **extent_map,
+     libcerror_error_t **error )
+{
+	libolecf_extent_map_t *short_sector_stream_extent_map = NULL;
+	libolecf_extent_map_t *stream_extent_map              = NULL;
+	static char *function                                 = "libolecf_io_handle_get_stream_extent_map";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( sat == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SAT.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry->extent_map != NULL )
+	{
+		*extent_map = directory_entry->extent_map;
+
+		return( 1 );
+	}
+	if( libolecf_extent_map_initialize(
+	     &stream_extent_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extent map.",
+		 function );
+
+		goto on_error;
+	}
+	if( directory_entry->size < io_handle->sector_stream_minimum_data_size )
+	{
+		if( ssat == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid SSAT.",
+			 function );
+
+			goto on_error;
+		}
+		if( libolecf_io_handle_get_short_sector_stream_extent_map(
+		     io_handle,
+		     sat,
+		     &short_sector_stream_extent_map,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve short-sector stream extent map.",
+			 function );
+
+			goto on_error;
+		}
+		if( libolecf_io_handle_read_sector_chain_extents(
+		     io_handle,
+		     ssat,
+		     directory_entry->sector_identifier,
+		     io_handle->short_sector_size,
+		     (size64_t) directory_entry->size,
+		     short_sector_stream_extent_map,
+		     stream_extent_map,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read stream extents.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libolecf_io_handle_read_sector_chain_extents(
+		     io_handle,
+		     sat,
+		     directory_entry->sector_identifier,
+		     io_handle->sector_size,
+		     (size64_t) directory_entry->size,
+		     NULL,
+		     stream_extent_map,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read stream extents.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	directory_entry->extent_map = stream_extent_map;
+
+	*extent_map = stream_extent_map;
+
+	return( 1 );
+
+on_error:
+	if( stream_extent_map != NULL )
+	{
+		libolecf_extent_map_free(
+		 &stream_extent_map,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the extent map of the stream of a directory entry
+ * The read/write lock is only grabbed for writing if the extent map needs to be created
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_io_handle_get_stream_extent_map_with_lock(
+     libolecf_io_handle_t *io_handle,
+     libolecf_allocation_table_t *sat,
+     libolecf_allocation_table_t *ssat,
+     libolecf_directory_entry_t *directory_entry,
+     libolecf_extent_map_t **extent_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_io_handle_get_stream_extent_map_with_lock";
+	int result            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     io_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*extent_map = directory_entry->extent_map;
+
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     io_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( *extent_map != NULL )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     io_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libolecf_io_handle_get_stream_extent_map(
+	          io_handle,
+	          sat,
+	          ssat,
+	          directory_entry,
+	          extent_map,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stream extent map.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     io_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Advises the system to prefetch the stream data that follows a sequential read
+ * The read-ahead window starts at LIBOLECF_MINIMUM_READ_AHEAD_SIZE and doubles,
+ * up to LIBOLECF_MAXIMUM_READ_AHEAD_SIZE, every time the reader consumes half of it.
+ * A non-sequential read resets the window
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_io_handle_read_ahead_stream(
+     libolecf_io_handle_t *io_handle,
+     libolecf_extent_map_t *extent_map,
+     libolecf_directory_entry_t *directory_entry,
+     off64_t read_offset,
+     off64_t next_read_offset,
+     libcerror_error_t **error )
+{
+	libolecf_extent_t *extent  = NULL;
+	static char *function      = "libolecf_io_handle_read_ahead_stream";
+	off64_t advise_offset      = 0;
+	off64_t end_offset         = 0;
+	off64_t extent_data_offset = 0;
+	off64_t file_offset        = 0;
+	size64_t advise_size       = 0;
+	int extent_index           = 0;
+	int result                 = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_offset < 0 )
+	 || ( next_read_offset < read_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_offset != directory_entry->next_read_offset )
+	{
+		directory_entry->next_read_offset  = next_read_offset;
+		directory_entry->read_ahead_offset = 0;
+		directory_entry->read_ahead_size   = 0;
+
+		return( 1 );
+	}
+	directory_entry->next_read_offset = next_read_offset;
+
+	if( ( io_handle->memory_mapped_data == NULL )
+	 && ( io_handle->read_ahead == NULL ) )
+	{
+		return( 1 );
+	}
+	if( directory_entry->read_ahead_offset < next_read_offset )
+	{
+		directory_entry->read_ahead_offset = next_read_offset;
+	}
+	/* Only advise once the reader has consumed half of the read-ahead window
+	 */
+	if( ( directory_entry->read_ahead_size > 0 )
+	 && ( (size64_t) ( directory_entry->read_ahead_offset - next_read_offset ) >= ( directory_entry->read_ahead_size / 2 ) ) )
+	{
+		return( 1 );
+	}
+	if( directory_entry->read_ahead_size == 0 )
+	{
+		directory_entry->read_ahead_size = LIBOLECF_MINIMUM_READ_AHEAD_SIZE;
+	}
+	else if( directory_entry->read_ahead_size < LIBOLECF_MAXIMUM_READ_AHEAD_SIZE )
+	{
+		directory_entry->read_ahead_size *= 2;
+	}
+	if( (size64_t) next_read_offset >= (size64_t) directory_entry->size )
+	{
+		return( 1 );
+	}
+	if( directory_entry->read_ahead_size > ( (size64_t) directory_entry->size - next_read_offset ) )
+	{
+		end_offset = (off64_t) directory_entry->size;
+	}
+	else
+	{
+		end_offset = next_read_offset + (off64_t) directory_entry->read_ahead_size;
+	}
+	advise_offset = directory_entry->read_ahead_offset;
+
+	if( advise_offset >= end_offset )
+	{
+		return( 1 );
+	}
+	result = libolecf_extent_map_get_extent_index_by_offset(
+	          extent_map,
+	          advise_offset,
+	          &extent_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent index for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 advise_offset,
+		 advise_offset );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	/* The extents are not contiguous in the file, hence every extent
+	 * in the read-ahead window is advised separately
+	 */
+	while( ( advise_offset < end_offset )
+	    && ( extent_index < extent_map->number_of_extents ) )
+	{
+		extent = &( extent_map->extents[ extent_index ] );
+
+		extent_data_offset = advise_offset - extent->offset;
+		advise_size        = extent->size - extent_data_offset;
+
+		if( advise_size > (size64_t) ( end_offset - advise_offset ) )
+		{
+			advise_size = (size64_t) ( end_offset - advise_offset );
+		}
+		file_offset = extent->file_offset + extent_data_offset;
+		result      = 0;
+
+		if( io_handle->memory_mapped_data != NULL )
+		{
+			if( ( (size64_t) file_offset < (size64_t) io_handle->memory_mapped_data_size )
+			 && ( advise_size <= ( (size64_t) io_handle->memory_mapped_data_size - (size64_t) file_offset ) ) )
+			{
+				result = libolecf_read_ahead_advise_memory(
+				          &( io_handle->memory_mapped_data[ file_offset ] ),
+				          (size_t) advise_size,
+				          error );
+			}
+		}
+		else
+		{
+			result = libolecf_read_ahead_advise_file(
+			          io_handle->read_ahead,
+			          file_offset,
+			          advise_size,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to advise read-ahead at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+		advise_offset += (off64_t) advise_size;
+
+		extent_index++;
+	}
+	directory_entry->read_ahead_offset = advise_offset;
+
+	return( 1 );
+}
+
+/* Reads data at a specific offset in the file using the block cache
+ * The block cache is created on first use
+ * Blocks that are not cached are read without holding the lock so that
+ * concurrent readers are not blocked by the file IO
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libolecf_io_handle_read_block_cache_data(
+         libolecf_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	uint8_t block_buffer[ LIBOLECF_BLOCK_CACHE_BLOCK_SIZE ];
+
+	const uint8_t *block_data      = NULL;
+	static char *function          = "libolecf_io_handle_read_block_cache_data";
+	off64_t block_offset           = 0;
+	size_t block_data_offset       = 0;
+	size_t block_data_size         = 0;
+	size_t buffer_offset           = 0;
+	size_t number_of_cache_entries = 0;
+	size_t read_size               = 0;
+	ssize_t read_count             = 0;
+	int result                     = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < size )
+	{
+		block_data_offset = (size_t) ( (size64_t) offset % LIBOLECF_BLOCK_CACHE_BLOCK_SIZE );
+		block_offset      = offset - (off64_t) block_data_offset;
+
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     io_handle->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( io_handle->block_cache == NULL )
+		{
+			number_of_cache_entries = io_handle->maximum_block_cache_size / LIBOLECF_BLOCK_CACHE_BLOCK_SIZE;
+
+			if( number_of_cache_entries > (size_t) INT_MAX )
+			{
+				number_of_cache_entries = (size_t) INT_MAX;
+			}
+			if( libolecf_block_cache_initialize(
+			     &( io_handle->block_cache ),
+			     (int) number_of_cache_entries,
+			     LIBOLECF_BLOCK_CACHE_BLOCK_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create block cache.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		result = libolecf_block_cache_get_cached_block(
+		          io_handle->block_cache,
+		          block_offset,
+		          &block_data,
+		          &block_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cached block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 block_offset,
+			 block_offset );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			/* The cached block data is only valid while the lock is held
+			 */
+			if( block_data_offset < block_data_size )
+			{
+				read_size = block_data_size - block_data_offset;
+
+				if( read_size > ( size - buffer_offset ) )
+				{
+					read_size = size - buffer_offset;
+				}
+				if( memory_copy(
+				     &( buffer[ buffer_offset ] ),
+				     &( block_data[ block_data_offset ] ),
+				     read_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy block data.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     io_handle->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( result == 0 )
+		{
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              block_buffer,
+			              LIBOLECF_BLOCK_CACHE_BLOCK_SIZE,
+			              block_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 block_offset,
+				 block_offset );
+
+				return( -1 );
+			}
+			block_data_size = (size_t) read_count;
+
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+			if( libcthreads_read_write_lock_grab_for_write(
+			     io_handle->read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab read/write lock for writing.",
+				 function );
+
+				return( -1 );
+			}
+#endif
+			result = libolecf_block_cache_set_block(
+			          io_handle->block_cache,
+			          block_offset,
+			          block_buffer,
+			          block_data_size,
+			          error );
+
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+			if( libcthreads_read_write_lock_release_for_write(
+			     io_handle->read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release read/write lock for writing.",
+				 function );
+
+				return( -1 );
+			}
+#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 block_offset,
+				 block_offset );
+
+				return( -1 );
+			}
+			if( block_data_offset < block_data_size )
+			{
+				read_size = block_data_size - block_data_offset;
+
+				if( read_size > ( size - buffer_offset ) )
+				{
+					read_size = size - buffer_offset;
+				}
+				if( memory_copy(
+				     &( buffer[ buffer_offset ] ),
+				     &( block_buffer[ block_data_offset ] ),
+				     read_size ) == NULL )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve sector identifier: %" PRIu32 " from SAT.",
-					 function,
-					 short_sector_stream_sector_identifier );
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy block data.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+		/* A block that is smaller than the block size is at the end of the file
+		 */
+		if( block_data_offset >= block_data_size )
+		{
+			break;
+		}
+		buffer_offset += read_size;
+		offset        += (off64_t) read_size;
+
+		if( block_data_size < LIBOLECF_BLOCK_CACHE_BLOCK_SIZE )
+		{
+			break;
+		}
+	}
+	return( (ssize_t) buffer_offset );
+
+on_error:
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 io_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Reads a buffer from the stream
+ * This function requires that the SAT and SSAT were read
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libolecf_io_handle_read_stream(
+         libolecf_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         libolecf_allocation_table_t *sat,
+         libolecf_allocation_table_t *ssat,
+         libolecf_directory_entry_t *directory_entry,
+         off64_t *offset,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	libolecf_extent_map_t *extent_map = NULL;
+	libolecf_extent_t *extent         = NULL;
+	static char *function             = "libolecf_io_handle_read_stream";
+	off64_t extent_data_offset        = 0;
+	off64_t read_offset               = 0;
+	off64_t safe_offset               = 0;
+	off64_t stream_offset             = 0;
+	size_t buffer_offset              = 0;
+	size_t read_size                  = 0;
+	ssize_t read_count                = 0;
+	int extent_index                  = 0;
+	int result                        = 0;
+	int use_short_sector_stream_data  = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_offset = *offset;
+
+	if( safe_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	stream_offset = safe_offset;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 0 );
+	}
+	result = libolecf_io_handle_get_stream_extent_map_with_lock(
+	          io_handle,
+	          sat,
+	          ssat,
+	          directory_entry,
+	          &extent_map,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stream extent map.",
+		 function );
+
+		return( -1 );
+	}
+	result = libolecf_extent_map_get_extent_index_by_offset(
+	          extent_map,
+	          safe_offset,
+	          &extent_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent index for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 safe_offset,
+		 safe_offset );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset: %" PRIi64 " (0x%08" PRIx64 ") value out of bounds.",
+		 function,
+		 safe_offset,
+		 safe_offset );
+
+		return( -1 );
+	}
+	if( ( directory_entry->size < io_handle->sector_stream_minimum_data_size )
+	 && ( io_handle->memory_mapped_data == NULL )
+	 && ( io_handle->maximum_short_sector_stream_cache_size > 0 ) )
+	{
+		result = libolecf_io_handle_read_short_sector_stream_data_with_lock(
+		          io_handle,
+		          file_io_handle,
+		          sat,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read short-sector stream data.",
+			 function );
+
+			return( -1 );
+		}
+		use_short_sector_stream_data = result;
+	}
+	while( size > 0 )
+	{
+		if( extent_index >= extent_map->number_of_extents )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid extent index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		extent = &( extent_map->extents[ extent_index ] );
+
+		extent_data_offset = safe_offset - extent->offset;
+
+		if( (size64_t) size > ( extent->size - extent_data_offset ) )
+		{
+			read_size = (size_t) ( extent->size - extent_data_offset );
+		}
+		else
+		{
+			read_size = size;
+		}
+		if( use_short_sector_stream_data != 0 )
+		{
+			/* Copy the extent data from the short-sector stream cache
+			 */
+			read_offset = extent->short_sector_stream_offset + extent_data_offset;
+
+			if( ( read_offset < 0 )
+			 || ( (size_t) read_offset > io_handle->short_sector_stream_data_size )
+			 || ( read_size > ( io_handle->short_sector_stream_data_size - (size_t) read_offset ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid short-sector stream offset value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     &( io_handle->short_sector_stream_data[ read_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy short-sector stream data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else if( ( io_handle->memory_mapped_data != NULL )
+		      && ( (size64_t) ( extent->file_offset + extent_data_offset ) <= (size64_t) io_handle->memory_mapped_data_size )
+		      && ( (size64_t) read_size <= ( (size64_t) io_handle->memory_mapped_data_size - (size64_t) ( extent->file_offset + extent_data_offset ) ) ) )
+		{
+			/* Copy the extent data from the memory mapped file
+			 */
+			read_offset = extent->file_offset + extent_data_offset;
+
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     &( io_handle->memory_mapped_data[ read_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy memory mapped data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else if( ( read_size < LIBOLECF_BLOCK_CACHE_BLOCK_SIZE )
+		      && ( io_handle->maximum_block_cache_size >= LIBOLECF_BLOCK_CACHE_BLOCK_SIZE ) )
+		{
+			/* Small reads are served from the block cache
+			 */
+			read_offset = extent->file_offset + extent_data_offset;
+
+			read_count = libolecf_io_handle_read_block_cache_data(
+				      io_handle,
+				      file_io_handle,
+				      read_offset,
+				      &( buffer[ buffer_offset ] ),
+				      read_size,
+				      error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read stream data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 read_offset,
+				 read_offset );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			/* The sectors in an extent are contiguous in the file
+			 * so the extent data is read directly into the buffer at once
+			 */
+			read_offset = extent->file_offset + extent_data_offset;
+
+			read_count = libbfio_handle_read_buffer_at_offset(
+				      file_io_handle,
+				      &( buffer[ buffer_offset ] ),
+				      read_size,
+				      read_offset,
+				      error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read stream data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 read_offset,
+				 read_offset );
+
+				return( -1 );
+			}
+		}
+		buffer_offset += read_size;
+		safe_offset   += read_size;
+		size          -= read_size;
+
+		if( (size64_t) ( extent_data_offset + read_size ) >= extent->size )
+		{
+			extent_index++;
+		}
+	}
+	/* Stream data read from the short-sector stream cache is already in memory
+	 * and the read-ahead state of shared directory entries is not updated
+	 */
+	if( ( use_short_sector_stream_data == 0 )
+	 && ( io_handle->uses_shared_directory_entries == 0 )
+	 && ( ( io_handle->memory_mapped_data != NULL )
+	  || ( io_handle->read_ahead != NULL ) ) )
+	{
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     io_handle->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		result = libolecf_io_handle_read_ahead_stream(
+		          io_handle,
+		          extent_map,
+		          directory_entry,
+		          stream_offset,
+		          safe_offset,
+		          error );
+
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     io_handle->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to read-ahead stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*offset = safe_offset;
+
+	return( (ssize_t) buffer_offset );
+}
+
+/* Reads ranges of stream data into their buffers
+ * The ranges are mapped onto the file and sorted by file offset, ranges that
+ * are near each other in the file are read at once
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_io_handle_read_stream_ranges(
+     libolecf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libolecf_allocation_table_t *sat,
+     libolecf_allocation_table_t *ssat,
+     libolecf_directory_entry_t *directory_entry,
+     uint8_t **buffers,
+     const size_t *buffer_sizes,
+     const off64_t *offsets,
+     int number_of_ranges,
+     libcerror_error_t **error )
+{
+	libolecf_extent_map_t *extent_map   = NULL;
+	libolecf_extent_t *extent           = NULL;
+	libolecf_read_range_t *read_range   = NULL;
+	libolecf_read_ranges_t *read_ranges = NULL;
+	uint8_t *read_buffer                = NULL;
+	void *reallocation                  = NULL;
+	static char *function               = "libolecf_io_handle_read_stream_ranges";
+	off64_t extent_data_offset          = 0;
+	off64_t range_end_offset            = 0;
+	off64_t read_end_offset             = 0;
+	off64_t read_offset                 = 0;
+	off64_t safe_offset                 = 0;
+	size_t buffer_offset                = 0;
+	size_t read_buffer_size             = 0;
+	size_t read_size                    = 0;
+	size_t size                         = 0;
+	ssize_t read_count                  = 0;
+	int extent_index                    = 0;
+	int first_range_index               = 0;
+	int range_index                     = 0;
+	int result                          = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_ranges < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of ranges value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( ( offsets[ range_index ] < 0 )
+		 || ( buffer_sizes[ range_index ] > (size_t) SSIZE_MAX )
+		 || ( (size64_t) buffer_sizes[ range_index ] > (size64_t) directory_entry->size )
+		 || ( (size64_t) offsets[ range_index ] > ( (size64_t) directory_entry->size - buffer_sizes[ range_index ] ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid range: %d value out of bounds.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+		if( ( buffer_sizes[ range_index ] > 0 )
+		 && ( buffers[ range_index ] == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid range: %d - missing buffer.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+	}
+	if( ( directory_entry->size < io_handle->sector_stream_minimum_data_size )
+	 && ( io_handle->memory_mapped_data == NULL )
+	 && ( io_handle->maximum_short_sector_stream_cache_size > 0 ) )
+	{
+		result = libolecf_io_handle_read_short_sector_stream_data_with_lock(
+		          io_handle,
+		          file_io_handle,
+		          sat,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read short-sector stream data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Stream data that is already in memory is copied per range
+	 */
+	if( ( result != 0 )
+	 || ( io_handle->memory_mapped_data != NULL ) )
+	{
+		for( range_index = 0;
+		     range_index < number_of_ranges;
+		     range_index++ )
+		{
+			if( buffer_sizes[ range_index ] == 0 )
+			{
+				continue;
+			}
+			safe_offset = offsets[ range_index ];
+
+			read_count = libolecf_io_handle_read_stream(
+			              io_handle,
+			              file_io_handle,
+			              sat,
+			              ssat,
+			              directory_entry,
+			              &safe_offset,
+			              buffers[ range_index ],
+			              buffer_sizes[ range_index ],
+			              error );
+
+			if( read_count != (ssize_t) buffer_sizes[ range_index ] )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read range: %d.",
+				 function,
+				 range_index );
+
+				return( -1 );
+			}
+		}
+		return( 1 );
+	}
+	result = libolecf_io_handle_get_stream_extent_map_with_lock(
+	          io_handle,
+	          sat,
+	          ssat,
+	          directory_entry,
+	          &extent_map,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stream extent map.",
+		 function );
 
-					return( -1 );
-				}
-				read_offset -= io_handle->sector_size;
-			}
-			read_offset += ( short_sector_stream_sector_identifier + 1 ) * io_handle->sector_size;
+		return( -1 );
+	}
+	if( libolecf_read_ranges_initialize(
+	     &read_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read ranges.",
+		 function );
+
+		goto on_error;
+	}
+	/* Map the ranges of stream data onto the file
+	 */
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		safe_offset   = offsets[ range_index ];
+		size          = buffer_sizes[ range_index ];
+		buffer_offset = 0;
+
+		if( size == 0 )
+		{
+			continue;
 		}
-		else
+		if( libolecf_extent_map_get_extent_index_by_offset(
+		     extent_map,
+		     safe_offset,
+		     &extent_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent index for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 safe_offset,
+			 safe_offset );
+
+			goto on_error;
+		}
+		while( size > 0 )
 		{
-			read_offset = ( sector_identifier + 1 ) * sector_size;
+			if( extent_index >= extent_map->number_of_extents )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid extent index value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			extent = &( extent_map->extents[ extent_index ] );
+
+			extent_data_offset = safe_offset - extent->offset;
+
+			if( (size64_t) size > ( extent->size - extent_data_offset ) )
+			{
+				read_size = (size_t) ( extent->size - extent_data_offset );
+			}
+			else
+			{
+				read_size = size;
+			}
+			if( libolecf_read_ranges_append_range(
+			     read_ranges,
+			     extent->file_offset + extent_data_offset,
+			     &( ( buffers[ range_index ] )[ buffer_offset ] ),
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append read range.",
+				 function );
+
+				goto on_error;
+			}
+			buffer_offset += read_size;
+			safe_offset   += read_size;
+			size          -= read_size;
+
+			extent_index++;
 		}
-		read_size = sector_size;
+	}
+	if( libolecf_read_ranges_sort(
+	     read_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort read ranges.",
+		 function );
+
+		goto on_error;
+	}
+	range_index = 0;
+
+	while( range_index < read_ranges->number_of_ranges )
+	{
+		first_range_index = range_index;
+
+		read_range = &( read_ranges->ranges[ range_index ] );
 
-		if( safe_offset > sector_boundary_offset )
+		read_offset     = read_range->file_offset;
+		read_end_offset = read_offset + (off64_t) read_range->size;
+
+		range_index++;
+
+		/* Subsequent ranges that overlap or are near the current read
+		 * are read at once as long as the read does not become too large
+		 */
+		while( range_index < read_ranges->number_of_ranges )
 		{
-			read_offset += safe_offset - sector_boundary_offset;
-			read_size   -= (size_t) ( safe_offset - sector_boundary_offset );
+			read_range = &( read_ranges->ranges[ range_index ] );
+
+			if( read_range->file_offset > ( read_end_offset + LIBOLECF_MAXIMUM_READ_RANGES_GAP_SIZE ) )
+			{
+				break;
+			}
+			range_end_offset = read_range->file_offset + (off64_t) read_range->size;
+
+			if( range_end_offset < read_end_offset )
+			{
+				range_end_offset = read_end_offset;
+			}
+			if( ( range_end_offset - read_offset ) > (off64_t) LIBOLECF_MAXIMUM_READ_RANGES_READ_SIZE )
+			{
+				break;
+			}
+			read_end_offset = range_end_offset;
+
+			range_index++;
 		}
-		if( read_size > size )
+		read_size = (size_t) ( read_end_offset - read_offset );
+
+		if( ( range_index - first_range_index ) == 1 )
 		{
-			read_size = size;
+			read_range = &( read_ranges->ranges[ first_range_index ] );
+
+			if( ( read_size < LIBOLECF_BLOCK_CACHE_BLOCK_SIZE )
+			 && ( io_handle->maximum_block_cache_size >= LIBOLECF_BLOCK_CACHE_BLOCK_SIZE ) )
+			{
+				read_count = libolecf_io_handle_read_block_cache_data(
+				              io_handle,
+				              file_io_handle,
+				              read_offset,
+				              read_range->buffer,
+				              read_size,
+				              error );
+			}
+			else
+			{
+				read_count = libbfio_handle_read_buffer_at_offset(
+				              file_io_handle,
+				              read_range->buffer,
+				              read_size,
+				              read_offset,
+				              error );
+			}
 		}
-		/* Read sector data into the buffer
-		 */
-		read_count = libbfio_handle_read_buffer_at_offset(
-			      file_io_handle,
-			      &( buffer[ buffer_offset ] ),
-			      read_size,
-			      read_offset,
-			      error );
+		else
+		{
+			if( read_size > read_buffer_size )
+			{
+				reallocation = memory_reallocate(
+				                read_buffer,
+				                sizeof( uint8_t ) * read_size );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize read buffer.",
+					 function );
 
+					goto on_error;
+				}
+				read_buffer      = (uint8_t *) reallocation;
+				read_buffer_size = read_size;
+			}
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              read_buffer,
+			              read_size,
+			              read_offset,
+			              error );
+		}
 		if( read_count != (ssize_t) read_size )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read sector: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 "%s: unable to read stream data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 			 function,
-			 sector_identifier,
 			 read_offset,
 			 read_offset );
 
-			return( -1 );
+			goto on_error;
 		}
-		buffer_offset += read_size;
-		safe_offset   += read_size;
-		size          -= read_size;
-
-#if SIZE_OF_INT <= 4
-		if( sector_identifier > (uint32_t) INT_MAX )
+		if( ( range_index - first_range_index ) > 1 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid sector identifier: 0x%08" PRIx32 " value out of bounds.",
-			 function,
-			 sector_identifier );
+			while( first_range_index < range_index )
+			{
+				read_range = &( read_ranges->ranges[ first_range_index ] );
 
-			return( -1 );
-		}
-#endif
-		if( libolecf_allocation_table_get_sector_identifier_by_index(
-		     allocation_table,
-		     (int) sector_identifier,
-		     &sector_identifier,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sector identifier: %" PRIu32 " from allocation table.",
-			 function,
-			 sector_identifier );
+				if( memory_copy(
+				     read_range->buffer,
+				     &( read_buffer[ read_range->file_offset - read_offset ] ),
+				     read_range->size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy read range data.",
+					 function );
 
-			return( -1 );
+					goto on_error;
+				}
+				first_range_index++;
+			}
 		}
-		sector_identifier_index++;
 	}
-	*offset = safe_offset;
+	if( read_buffer != NULL )
+	{
+		memory_free(
+		 read_buffer );
+	}
+	if( libolecf_read_ranges_free(
+	     &read_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free read ranges.",
+		 function );
 
-	return( (ssize_t) buffer_offset );
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( read_buffer != NULL )
+	{
+		memory_free(
+		 read_buffer );
+	}
+	if( read_ranges != NULL )
+	{
+		libolecf_read_ranges_free(
+		 &read_ranges,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a view of the stream data at a specific offset
+ * The view references the memory mapped file data of the contiguous part of the stream that contains the offset
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libolecf_io_handle_get_stream_data_view(
+     libolecf_io_handle_t *io_handle,
+     libolecf_allocation_table_t *sat,
+     libolecf_allocation_table_t *ssat,
+     libolecf_directory_entry_t *directory_entry,
+     off64_t offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libolecf_extent_map_t *extent_map = NULL;
+	libolecf_extent_t *extent         = NULL;
+	static char *function             = "libolecf_io_handle_get_stream_data_view";
+	off64_t extent_data_offset        = 0;
+	off64_t view_offset               = 0;
+	size64_t view_size                = 0;
+	int extent_index                  = 0;
+	int result                        = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->memory_mapped_data == NULL )
+	 || ( (size64_t) offset >= (size64_t) directory_entry->size ) )
+	{
+		return( 0 );
+	}
+	result = libolecf_io_handle_get_stream_extent_map_with_lock(
+	          io_handle,
+	          sat,
+	          ssat,
+	          directory_entry,
+	          &extent_map,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stream extent map.",
+		 function );
+
+		return( -1 );
+	}
+	result = libolecf_extent_map_get_extent_index_by_offset(
+	          extent_map,
+	          offset,
+	          &extent_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent index for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	extent = &( extent_map->extents[ extent_index ] );
+
+	extent_data_offset = offset - extent->offset;
+	view_offset        = extent->file_offset + extent_data_offset;
+	view_size          = extent->size - extent_data_offset;
+
+	if( view_size > ( (size64_t) directory_entry->size - (size64_t) offset ) )
+	{
+		view_size = (size64_t) directory_entry->size - (size64_t) offset;
+	}
+	/* The stream data can be stored beyond the end of a truncated file
+	 */
+	if( (size64_t) view_offset >= (size64_t) io_handle->memory_mapped_data_size )
+	{
+		return( 0 );
+	}
+	if( view_size > ( (size64_t) io_handle->memory_mapped_data_size - (size64_t) view_offset ) )
+	{
+		view_size = (size64_t) io_handle->memory_mapped_data_size - (size64_t) view_offset;
+	}
+	*data      = &( io_handle->memory_mapped_data[ view_offset ] );
+	*data_size = (size_t) view_size;
+
+	return( 1 );
 }
 
@@ -26,10 +26,15 @@
 #include <types.h>
 
 #include "libolecf_allocation_table.h"
+#include "libolecf_block_cache.h"
 #include "libolecf_directory_entry.h"
+#include "libolecf_directory_table.h"
+#include "libolecf_extent_map.h"
 #include "libolecf_libbfio.h"
 #include "libolecf_libcdata.h"
 #include "libolecf_libcerror.h"
+#include "libolecf_libcthreads.h"
+#include "libolecf_read_ahead.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -70,6 +75,47 @@ struct libolecf_io_handle
 	 */
 	uint32_t short_sector_stream_start_sector_identifier;
 
+	/* The short sector stream extent map
+	 */
+	libolecf_extent_map_t *short_sector_stream_extent_map;
+
+	/* The short sector stream data
+	 */
+	uint8_t *short_sector_stream_data;
+
+	/* The short sector stream data size
+	 */
+	size_t short_sector_stream_data_size;
+
+	/* The maximum short sector stream cache size
+	 */
+	size_t maximum_short_sector_stream_cache_size;
+
+	/* The memory mapped file data
+	 */
+	const uint8_t *memory_mapped_data;
+
+	/* The memory mapped file data size
+	 */
+	size_t memory_mapped_data_size;
+
+	/* The block cache
+	 */
+	libolecf_block_cache_t *block_cache;
+
+	/* The maximum block cache size
+	 */
+	size_t maximum_block_cache_size;
+
+	/* The read-ahead
+	 */
+	libolecf_read_ahead_t *read_ahead;
+
+	/* Value to indicate the directory entries are owned by another file
+	 * in which case the read-ahead state of the directory entries is not updated
+	 */
+	uint8_t uses_shared_directory_entries;
+
 	/* The codepage of the extended ASCII strings
 	 */
 	int ascii_codepage;
@@ -77,6 +123,13 @@ struct libolecf_io_handle
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
+
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	/* The read/write lock that protects the caches and the lazily read extents
+	 * that are shared by the streams
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libolecf_io_handle_initialize(
@@ -91,6 +144,11 @@ int libolecf_io_handle_clear(
      libolecf_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libolecf_io_handle_copy_values(
+     libolecf_io_handle_t *destination_io_handle,
+     libolecf_io_handle_t *source_io_handle,
+     libcerror_error_t **error );
+
 int libolecf_io_handle_read_msat(
      libolecf_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
@@ -107,6 +165,14 @@ int libolecf_io_handle_read_sat(
      uint32_t number_of_sat_sectors,
      libcerror_error_t **error );
 
+int libolecf_io_handle_read_sat_on_demand(
+     libolecf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libolecf_allocation_table_t *msat,
+     libolecf_allocation_table_t *sat,
+     uint32_t number_of_sat_sectors,
+     libcerror_error_t **error );
+
 int libolecf_io_handle_read_ssat(
      libolecf_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
@@ -120,10 +186,70 @@ int libolecf_io_handle_read_directory_entries(
      libolecf_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libolecf_allocation_table_t *sat,
-     libcdata_list_t *directory_entry_list,
+     libolecf_directory_table_t *directory_table,
      uint32_t root_directory_sector_identifier,
      libcerror_error_t **error );
 
+int libolecf_io_handle_read_sector_chain_extents(
+     libolecf_io_handle_t *io_handle,
+     libolecf_allocation_table_t *allocation_table,
+     uint32_t sector_identifier,
+     size_t sector_size,
+     size64_t maximum_size,
+     libolecf_extent_map_t *short_sector_stream_extent_map,
+     libolecf_extent_map_t *extent_map,
+     libcerror_error_t **error );
+
+int libolecf_io_handle_get_short_sector_stream_extent_map(
+     libolecf_io_handle_t *io_handle,
+     libolecf_allocation_table_t *sat,
+     libolecf_extent_map_t **extent_map,
+     libcerror_error_t **error );
+
+int libolecf_io_handle_read_short_sector_stream_data(
+     libolecf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libolecf_allocation_table_t *sat,
+     libcerror_error_t **error );
+
+int libolecf_io_handle_read_short_sector_stream_data_with_lock(
+     libolecf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libolecf_allocation_table_t *sat,
+     libcerror_error_t **error );
+
+int libolecf_io_handle_get_stream_extent_map(
+     libolecf_io_handle_t *io_handle,
+     libolecf_allocation_table_t *sat,
+     libolecf_allocation_table_t *ssat,
+     libolecf_directory_entry_t *directory_entry,
+     libolecf_extent_map_t **extent_map,
+     libcerror_error_t **error );
+
+int libolecf_io_handle_get_stream_extent_map_with_lock(
+     libolecf_io_handle_t *io_handle,
+     libolecf_allocation_table_t *sat,
+     libolecf_allocation_table_t *ssat,
+     libolecf_directory_entry_t *directory_entry,
+     libolecf_extent_map_t **extent_map,
+     libcerror_error_t **error );
+
+int libolecf_io_handle_read_ahead_stream(
+     libolecf_io_handle_t *io_handle,
+     libolecf_extent_map_t *extent_map,
+     libolecf_directory_entry_t *directory_entry,
+     off64_t read_offset,
+     off64_t next_read_offset,
+     libcerror_error_t **error );
+
+ssize_t libolecf_io_handle_read_block_cache_data(
+         libolecf_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
 ssize_t libolecf_io_handle_read_stream(
          libolecf_io_handle_t *io_handle,
          libbfio_handle_t *file_io_handle,
@@ -135,6 +261,28 @@ ssize_t libolecf_io_handle_read_stream(
          size_t size,
          libcerror_error_t **error );
 
+int libolecf_io_handle_read_stream_ranges(
+     libolecf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libolecf_allocation_table_t *sat,
+     libolecf_allocation_table_t *ssat,
+     libolecf_directory_entry_t *directory_entry,
+     uint8_t **buffers,
+     const size_t *buffer_sizes,
+     const off64_t *offsets,
+     int number_of_ranges,
+     libcerror_error_t **error );
+
+int libolecf_io_handle_get_stream_data_view(
+     libolecf_io_handle_t *io_handle,
+     libolecf_allocation_table_t *sat,
+     libolecf_allocation_table_t *ssat,
+     libolecf_directory_entry_t *directory_entry,
+     off64_t offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
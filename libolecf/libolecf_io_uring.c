@@ -0,0 +1,840 @@
+/*
+ * io_uring functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if !defined( WINAPI ) && defined( HAVE_LINUX_IO_URING_H ) && defined( HAVE_SYS_SYSCALL_H ) && defined( HAVE_SYSCALL ) && defined( HAVE_MMAP )
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_SYS_TYPES_H )
+#include <sys/types.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+
+/* Reads at an explicit file offset use IORING_OP_READ, which is supported
+ * by the same kernel versions that report IORING_FEAT_RW_CUR_POS
+ */
+#if defined( __NR_io_uring_setup ) && defined( __NR_io_uring_enter ) && defined( IORING_FEAT_RW_CUR_POS )
+#define HAVE_LIBOLECF_IO_URING_SUPPORT
+#endif
+
+#endif /* !defined( WINAPI ) && defined( HAVE_LINUX_IO_URING_H ) && defined( HAVE_SYS_SYSCALL_H ) && defined( HAVE_SYSCALL ) && defined( HAVE_MMAP ) */
+
+#include "libolecf_definitions.h"
+#include "libolecf_io_uring.h"
+#include "libolecf_libcerror.h"
+
+/* Creates an io_uring
+ * Make sure the value io_uring is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_io_uring_initialize(
+     libolecf_io_uring_t **io_uring,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_io_uring_initialize";
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_uring != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid io_uring value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*io_uring = memory_allocate_structure(
+	             libolecf_io_uring_t );
+
+	if( *io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create io_uring.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *io_uring,
+	     0,
+	     sizeof( libolecf_io_uring_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear io_uring.",
+		 function );
+
+		memory_free(
+		 *io_uring );
+
+		*io_uring = NULL;
+
+		return( -1 );
+	}
+	( *io_uring )->file_descriptor = -1;
+
+	return( 1 );
+
+on_error:
+	if( *io_uring != NULL )
+	{
+		memory_free(
+		 *io_uring );
+
+		*io_uring = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an io_uring
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_io_uring_free(
+     libolecf_io_uring_t **io_uring,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_io_uring_free";
+	int result            = 1;
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_uring != NULL )
+	{
+		if( libolecf_io_uring_close(
+		     *io_uring,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close io_uring.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *io_uring );
+
+		*io_uring = NULL;
+	}
+	return( result );
+}
+
+/* Sets up the submission and completion queues
+ * The queues are not available if the system does not support io_uring,
+ * it was disabled or the queues cannot be mapped, e.g. due to memory limits
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libolecf_io_uring_open(
+     libolecf_io_uring_t *io_uring,
+     uint32_t number_of_entries,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBOLECF_IO_URING_SUPPORT )
+	struct io_uring_params parameters;
+
+	void *mapped_data     = NULL;
+	long file_descriptor  = 0;
+#endif
+	static char *function = "libolecf_io_uring_open";
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_uring->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid io_uring - file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries == 0 )
+	 || ( number_of_entries > (uint32_t) LIBOLECF_MAXIMUM_NUMBER_OF_READ_QUEUE_REQUESTS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBOLECF_IO_URING_SUPPORT )
+	if( memory_set(
+	     &parameters,
+	     0,
+	     sizeof( struct io_uring_params ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parameters.",
+		 function );
+
+		return( -1 );
+	}
+	file_descriptor = syscall(
+	                   __NR_io_uring_setup,
+	                   number_of_entries,
+	                   &parameters );
+
+	if( file_descriptor < 0 )
+	{
+		return( 0 );
+	}
+	io_uring->file_descriptor = (int) file_descriptor;
+
+	if( ( parameters.features & IORING_FEAT_RW_CUR_POS ) == 0 )
+	{
+		goto on_not_available;
+	}
+	io_uring->submission_queue_ring_size = (size_t) parameters.sq_off.array
+	                                     + ( (size_t) parameters.sq_entries * sizeof( uint32_t ) );
+
+	io_uring->completion_queue_ring_size = (size_t) parameters.cq_off.cqes
+	                                     + ( (size_t) parameters.cq_entries * sizeof( struct io_uring_cqe ) );
+
+	/* Newer systems map the submission and completion queue rings at once
+	 */
+	if( ( parameters.features & IORING_FEAT_SINGLE_MMAP ) != 0 )
+	{
+		if( io_uring->completion_queue_ring_size > io_uring->submission_queue_ring_size )
+		{
+			io_uring->submission_queue_ring_size = io_uring->completion_queue_ring_size;
+		}
+		io_uring->completion_queue_ring_size = 0;
+	}
+	mapped_data = mmap(
+	               NULL,
+	               io_uring->submission_queue_ring_size,
+	               PROT_READ | PROT_WRITE,
+	               MAP_SHARED | MAP_POPULATE,
+	               io_uring->file_descriptor,
+	               (off_t) IORING_OFF_SQ_RING );
+
+	if( mapped_data == MAP_FAILED )
+	{
+		goto on_not_available;
+	}
+	io_uring->submission_queue_ring = (uint8_t *) mapped_data;
+
+	if( io_uring->completion_queue_ring_size == 0 )
+	{
+		io_uring->completion_queue_ring = io_uring->submission_queue_ring;
+	}
+	else
+	{
+		mapped_data = mmap(
+		               NULL,
+		               io_uring->completion_queue_ring_size,
+		               PROT_READ | PROT_WRITE,
+		               MAP_SHARED | MAP_POPULATE,
+		               io_uring->file_descriptor,
+		               (off_t) IORING_OFF_CQ_RING );
+
+		if( mapped_data == MAP_FAILED )
+		{
+			goto on_not_available;
+		}
+		io_uring->completion_queue_ring = (uint8_t *) mapped_data;
+	}
+	io_uring->submission_queue_entries_size = (size_t) parameters.sq_entries * sizeof( struct io_uring_sqe );
+
+	mapped_data = mmap(
+	               NULL,
+	               io_uring->submission_queue_entries_size,
+	               PROT_READ | PROT_WRITE,
+	               MAP_SHARED | MAP_POPULATE,
+	               io_uring->file_descriptor,
+	               (off_t) IORING_OFF_SQES );
+
+	if( mapped_data == MAP_FAILED )
+	{
+		goto on_not_available;
+	}
+	io_uring->submission_queue_entries = (uint8_t *) mapped_data;
+
+	io_uring->submission_queue_head              = (uint32_t *) &( io_uring->submission_queue_ring[ parameters.sq_off.head ] );
+	io_uring->submission_queue_tail              = (uint32_t *) &( io_uring->submission_queue_ring[ parameters.sq_off.tail ] );
+	io_uring->submission_queue_array             = (uint32_t *) &( io_uring->submission_queue_ring[ parameters.sq_off.array ] );
+	io_uring->submission_queue_mask              = *( (uint32_t *) &( io_uring->submission_queue_ring[ parameters.sq_off.ring_mask ] ) );
+	io_uring->number_of_submission_queue_entries = parameters.sq_entries;
+
+	io_uring->completion_queue_entries           = &( io_uring->completion_queue_ring[ parameters.cq_off.cqes ] );
+	io_uring->completion_queue_head              = (uint32_t *) &( io_uring->completion_queue_ring[ parameters.cq_off.head ] );
+	io_uring->completion_queue_tail              = (uint32_t *) &( io_uring->completion_queue_ring[ parameters.cq_off.tail ] );
+	io_uring->completion_queue_mask              = *( (uint32_t *) &( io_uring->completion_queue_ring[ parameters.cq_off.ring_mask ] ) );
+	io_uring->number_of_completion_queue_entries = parameters.cq_entries;
+
+	return( 1 );
+
+on_not_available:
+	libolecf_io_uring_close(
+	 io_uring,
+	 NULL );
+
+	return( 0 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Tears down the submission and completion queues
+ * Waits for submitted reads to complete so that the system no longer writes into their buffers
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_io_uring_close(
+     libolecf_io_uring_t *io_uring,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBOLECF_IO_URING_SUPPORT )
+	intptr_t *user_data   = NULL;
+	int32_t read_result   = 0;
+#endif
+	static char *function = "libolecf_io_uring_close";
+	int result            = 1;
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_uring->file_descriptor == -1 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBOLECF_IO_URING_SUPPORT )
+	if( io_uring->submission_queue_entries != NULL )
+	{
+		while( ( io_uring->number_of_prepared_reads > 0 )
+		    || ( io_uring->number_of_submitted_reads > 0 ) )
+		{
+			if( libolecf_io_uring_get_completion(
+			     io_uring,
+			     &user_data,
+			     &read_result,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to retrieve completion.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+		if( munmap(
+		     (void *) io_uring->submission_queue_entries,
+		     io_uring->submission_queue_entries_size ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to unmap submission queue entries.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( ( io_uring->completion_queue_ring != NULL )
+	 && ( io_uring->completion_queue_ring != io_uring->submission_queue_ring ) )
+	{
+		if( munmap(
+		     (void *) io_uring->completion_queue_ring,
+		     io_uring->completion_queue_ring_size ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to unmap completion queue ring.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( io_uring->submission_queue_ring != NULL )
+	{
+		if( munmap(
+		     (void *) io_uring->submission_queue_ring,
+		     io_uring->submission_queue_ring_size ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to unmap submission queue ring.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( close(
+	     io_uring->file_descriptor ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file descriptor.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( memory_set(
+	     io_uring,
+	     0,
+	     sizeof( libolecf_io_uring_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear io_uring.",
+		 function );
+
+		result = -1;
+	}
+	io_uring->file_descriptor = -1;
+
+	return( result );
+}
+
+/* Prepares a read of file data into a buffer
+ * The read is started by libolecf_io_uring_submit or libolecf_io_uring_get_completion
+ * Returns 1 if successful, 0 if the queues are full or -1 on error
+ */
+int libolecf_io_uring_prepare_read(
+     libolecf_io_uring_t *io_uring,
+     int file_descriptor,
+     uint8_t *buffer,
+     size_t size,
+     off64_t file_offset,
+     intptr_t *user_data,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBOLECF_IO_URING_SUPPORT )
+	struct io_uring_sqe *submission_queue_entry = NULL;
+	uint32_t submission_queue_head              = 0;
+	uint32_t submission_queue_index             = 0;
+	uint32_t submission_queue_tail              = 0;
+#endif
+	static char *function                       = "libolecf_io_uring_prepare_read";
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_uring->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid io_uring - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file descriptor value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) LIBOLECF_MAXIMUM_ASYNCHRONOUS_READ_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBOLECF_IO_URING_SUPPORT )
+	/* Every read that was not retrieved yet needs a completion queue entry
+	 */
+	if( ( io_uring->number_of_prepared_reads + io_uring->number_of_submitted_reads ) >= io_uring->number_of_completion_queue_entries )
+	{
+		return( 0 );
+	}
+	submission_queue_tail = *( io_uring->submission_queue_tail );
+	submission_queue_head = __atomic_load_n(
+	                         io_uring->submission_queue_head,
+	                         __ATOMIC_ACQUIRE );
+
+	if( ( submission_queue_tail - submission_queue_head ) >= io_uring->number_of_submission_queue_entries )
+	{
+		return( 0 );
+	}
+	submission_queue_index = submission_queue_tail & io_uring->submission_queue_mask;
+	submission_queue_entry = &( ( (struct io_uring_sqe *) io_uring->submission_queue_entries )[ submission_queue_index ] );
+
+	if( memory_set(
+	     submission_queue_entry,
+	     0,
+	     sizeof( struct io_uring_sqe ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear submission queue entry.",
+		 function );
+
+		return( -1 );
+	}
+	submission_queue_entry->opcode    = IORING_OP_READ;
+	submission_queue_entry->fd        = file_descriptor;
+	submission_queue_entry->off       = (uint64_t) file_offset;
+	submission_queue_entry->addr      = (uint64_t) (uintptr_t) buffer;
+	submission_queue_entry->len       = (uint32_t) size;
+	submission_queue_entry->user_data = (uint64_t) (uintptr_t) user_data;
+
+	io_uring->submission_queue_array[ submission_queue_index ] = submission_queue_index;
+
+	__atomic_store_n(
+	 io_uring->submission_queue_tail,
+	 submission_queue_tail + 1,
+	 __ATOMIC_RELEASE );
+
+	io_uring->number_of_prepared_reads += 1;
+
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Submits the prepared reads to the system
+ * Reads the system cannot accept yet remain prepared and are submitted
+ * by a subsequent call to libolecf_io_uring_get_completion
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_io_uring_submit(
+     libolecf_io_uring_t *io_uring,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBOLECF_IO_URING_SUPPORT )
+	long number_of_submitted_reads = 0;
+#endif
+	static char *function          = "libolecf_io_uring_submit";
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_uring->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid io_uring - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBOLECF_IO_URING_SUPPORT )
+	while( io_uring->number_of_prepared_reads > 0 )
+	{
+		number_of_submitted_reads = syscall(
+		                             __NR_io_uring_enter,
+		                             io_uring->file_descriptor,
+		                             io_uring->number_of_prepared_reads,
+		                             0,
+		                             0,
+		                             NULL,
+		                             0 );
+
+		if( number_of_submitted_reads < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			if( ( errno == EAGAIN )
+			 || ( errno == EBUSY ) )
+			{
+				break;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 (uint32_t) errno,
+			 "%s: unable to submit reads.",
+			 function );
+
+			return( -1 );
+		}
+		if( number_of_submitted_reads == 0 )
+		{
+			break;
+		}
+		io_uring->number_of_prepared_reads  -= (uint32_t) number_of_submitted_reads;
+		io_uring->number_of_submitted_reads += (uint32_t) number_of_submitted_reads;
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the next completed read
+ * Submits the prepared reads and waits if no read has completed yet
+ * The result contains the number of bytes read or a negative system error code
+ * Returns 1 if successful, 0 if no reads are outstanding or -1 on error
+ */
+int libolecf_io_uring_get_completion(
+     libolecf_io_uring_t *io_uring,
+     intptr_t **user_data,
+     int32_t *result,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBOLECF_IO_URING_SUPPORT )
+	struct io_uring_cqe *completion_queue_entry = NULL;
+	long number_of_submitted_reads              = 0;
+	uint32_t completion_queue_head              = 0;
+	uint32_t completion_queue_tail              = 0;
+#endif
+	static char *function                       = "libolecf_io_uring_get_completion";
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_uring->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid io_uring - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( user_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid user data.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid result.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBOLECF_IO_URING_SUPPORT )
+	completion_queue_head = *( io_uring->completion_queue_head );
+
+	do
+	{
+		completion_queue_tail = __atomic_load_n(
+		                         io_uring->completion_queue_tail,
+		                         __ATOMIC_ACQUIRE );
+
+		if( completion_queue_tail != completion_queue_head )
+		{
+			break;
+		}
+		if( ( io_uring->number_of_prepared_reads == 0 )
+		 && ( io_uring->number_of_submitted_reads == 0 ) )
+		{
+			return( 0 );
+		}
+		number_of_submitted_reads = syscall(
+		                             __NR_io_uring_enter,
+		                             io_uring->file_descriptor,
+		                             io_uring->number_of_prepared_reads,
+		                             1,
+		                             IORING_ENTER_GETEVENTS,
+		                             NULL,
+		                             0 );
+
+		if( number_of_submitted_reads < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 (uint32_t) errno,
+			 "%s: unable to wait for completion.",
+			 function );
+
+			return( -1 );
+		}
+		io_uring->number_of_prepared_reads  -= (uint32_t) number_of_submitted_reads;
+		io_uring->number_of_submitted_reads += (uint32_t) number_of_submitted_reads;
+	}
+	while( completion_queue_tail == completion_queue_head );
+
+	completion_queue_entry = &( ( (struct io_uring_cqe *) io_uring->completion_queue_entries )[ completion_queue_head & io_uring->completion_queue_mask ] );
+
+	*user_data = (intptr_t *) (uintptr_t) completion_queue_entry->user_data;
+	*result    = (int32_t) completion_queue_entry->res;
+
+	__atomic_store_n(
+	 io_uring->completion_queue_head,
+	 completion_queue_head + 1,
+	 __ATOMIC_RELEASE );
+
+	io_uring->number_of_submitted_reads -= 1;
+
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
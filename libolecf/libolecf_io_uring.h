@@ -0,0 +1,149 @@
+/*
+ * io_uring functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBOLECF_IO_URING_H )
+#define _LIBOLECF_IO_URING_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libolecf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libolecf_io_uring libolecf_io_uring_t;
+
+struct libolecf_io_uring
+{
+	/* The ring file descriptor
+	 * or -1 if not available
+	 */
+	int file_descriptor;
+
+	/* The submission queue ring
+	 */
+	uint8_t *submission_queue_ring;
+
+	/* The submission queue ring size
+	 */
+	size_t submission_queue_ring_size;
+
+	/* The submission queue entries
+	 */
+	uint8_t *submission_queue_entries;
+
+	/* The submission queue entries size
+	 */
+	size_t submission_queue_entries_size;
+
+	/* The submission queue head, tail and index array
+	 */
+	uint32_t *submission_queue_head;
+	uint32_t *submission_queue_tail;
+	uint32_t *submission_queue_array;
+
+	/* The submission queue mask
+	 */
+	uint32_t submission_queue_mask;
+
+	/* The number of submission queue entries
+	 */
+	uint32_t number_of_submission_queue_entries;
+
+	/* The completion queue ring
+	 * which is the submission queue ring if the system maps both at once
+	 */
+	uint8_t *completion_queue_ring;
+
+	/* The completion queue ring size
+	 */
+	size_t completion_queue_ring_size;
+
+	/* The completion queue entries
+	 */
+	uint8_t *completion_queue_entries;
+
+	/* The completion queue head and tail
+	 */
+	uint32_t *completion_queue_head;
+	uint32_t *completion_queue_tail;
+
+	/* The completion queue mask
+	 */
+	uint32_t completion_queue_mask;
+
+	/* The number of completion queue entries
+	 */
+	uint32_t number_of_completion_queue_entries;
+
+	/* The number of reads that were prepared but not yet submitted
+	 */
+	uint32_t number_of_prepared_reads;
+
+	/* The number of reads that were submitted but not yet completed
+	 */
+	uint32_t number_of_submitted_reads;
+};
+
+int libolecf_io_uring_initialize(
+     libolecf_io_uring_t **io_uring,
+     libcerror_error_t **error );
+
+int libolecf_io_uring_free(
+     libolecf_io_uring_t **io_uring,
+     libcerror_error_t **error );
+
+int libolecf_io_uring_open(
+     libolecf_io_uring_t *io_uring,
+     uint32_t number_of_entries,
+     libcerror_error_t **error );
+
+int libolecf_io_uring_close(
+     libolecf_io_uring_t *io_uring,
+     libcerror_error_t **error );
+
+int libolecf_io_uring_prepare_read(
+     libolecf_io_uring_t *io_uring,
+     int file_descriptor,
+     uint8_t *buffer,
+     size_t size,
+     off64_t file_offset,
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
+int libolecf_io_uring_submit(
+     libolecf_io_uring_t *io_uring,
+     libcerror_error_t **error );
+
+int libolecf_io_uring_get_completion(
+     libolecf_io_uring_t *io_uring,
+     intptr_t **user_data,
+     int32_t *result,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBOLECF_IO_URING_H ) */
+
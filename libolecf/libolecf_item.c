@@ -26,6 +26,7 @@
 #include "libolecf_definitions.h"
 #include "libolecf_directory_entry.h"
 #include "libolecf_directory_tree.h"
+#include "libolecf_extent_map.h"
 #include "libolecf_io_handle.h"
 #include "libolecf_file.h"
 #include "libolecf_item.h"
@@ -93,6 +94,17 @@ int libolecf_item_initialize(
 
 		return( -1 );
 	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
 	if( directory_tree_node == NULL )
 	{
 		libcerror_error_set(
@@ -137,6 +149,10 @@ int libolecf_item_initialize(
 	internal_item->file                = file;
 	internal_item->directory_tree_node = directory_tree_node;
 
+	if( file != NULL )
+	{
+		internal_item->directory_table = file->directory_table;
+	}
 	if( libcdata_tree_node_get_value(
 	     directory_tree_node,
 	     (intptr_t **) &( internal_item->directory_entry ),
@@ -151,6 +167,21 @@ int libolecf_item_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_item->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	*item = (libolecf_item_t *) internal_item;
 
 	return( 1 );
@@ -173,6 +204,7 @@ int libolecf_item_free(
 {
 	libolecf_internal_item_t *internal_item = NULL;
 	static char *function                   = "libolecf_item_free";
+	int result                              = 1;
 
 	if( item == NULL )
 	{
@@ -190,10 +222,25 @@ int libolecf_item_free(
 		internal_item = (libolecf_internal_item_t *) *item;
 		*item         = NULL;
 
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_item->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 internal_item );
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Retrieves the type
@@ -247,6 +294,303 @@ int libolecf_item_get_type(
 	return( 1 );
 }
 
+/* Retrieves the UTF-8 encoded name of the directory entry of the referenced item
+ * The name is cached by the directory entry, the read/write lock is only grabbed
+ * for writing if the name needs to be determined
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_internal_item_get_utf8_name(
+     libolecf_internal_item_t *internal_item,
+     const uint8_t **utf8_name,
+     size_t *utf8_name_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_internal_item_get_utf8_name";
+	int result            = 0;
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 name.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_name_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 name size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_item->file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*utf8_name      = internal_item->directory_entry->utf8_name;
+	*utf8_name_size = internal_item->directory_entry->utf8_name_size;
+
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_item->file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( *utf8_name != NULL )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_item->file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libolecf_directory_entry_get_utf8_name(
+	          internal_item->directory_entry,
+	          internal_item->io_handle->byte_order,
+	          utf8_name,
+	          utf8_name_size,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name as UTF-8 string.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_item->file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the array of the sub nodes of the directory tree node of the referenced item
+ * The array is kept by the directory entry, the read/write lock is only grabbed
+ * for writing if the sub nodes need to be read
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_internal_item_get_sub_nodes_array(
+     libolecf_internal_item_t *internal_item,
+     libcdata_array_t **sub_nodes_array,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_internal_item_get_sub_nodes_array";
+	int result            = 0;
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_nodes_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub nodes array.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_item->file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*sub_nodes_array = internal_item->directory_entry->sub_nodes_array;
+
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_item->file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( *sub_nodes_array != NULL )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_item->file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libolecf_directory_tree_read_sub_nodes(
+	          internal_item->directory_tree_node,
+	          internal_item->directory_table,
+	          internal_item->io_handle->byte_order,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read sub nodes.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		result = libolecf_directory_tree_get_sub_nodes_array(
+		          internal_item->directory_tree_node,
+		          sub_nodes_array,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub nodes array.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_item->file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
 /* Retrieves the size of the UTF-8 encoded name of the referenced item
  * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
@@ -257,7 +601,9 @@ int libolecf_item_get_utf8_name_size(
      libcerror_error_t **error )
 {
 	libolecf_internal_item_t *internal_item = NULL;
+	const uint8_t *utf8_name                = NULL;
 	static char *function                   = "libolecf_item_get_utf8_name_size";
+	int result                              = 0;
 
 	if( item == NULL )
 	{
@@ -294,12 +640,24 @@ int libolecf_item_get_utf8_name_size(
 
 		return( -1 );
 	}
-	if( libuna_utf8_string_size_from_utf16_stream(
-	     internal_item->directory_entry->name,
-	     internal_item->directory_entry->name_size,
-	     internal_item->io_handle->byte_order,
-	     utf8_string_size,
-	     error ) != 1 )
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libolecf_internal_item_get_utf8_name(
+	          internal_item,
+	          &utf8_name,
+	          utf8_string_size,
+	          error );
+
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -323,10 +681,385 @@ int libolecf_item_get_utf8_name(
      size_t utf8_string_size,
      libcerror_error_t **error )
 {
-	libolecf_internal_item_t *internal_item = NULL;
-	static char *function                   = "libolecf_item_get_utf8_name";
+	libolecf_internal_item_t *internal_item = NULL;
+	const uint8_t *utf8_name                = NULL;
+	static char *function                   = "libolecf_item_get_utf8_name";
+	size_t utf8_name_size                   = 0;
+	int result                              = 0;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libolecf_internal_item_t *) item;
+
+	if( internal_item->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libolecf_internal_item_get_utf8_name(
+	          internal_item,
+	          &utf8_name,
+	          &utf8_name_size,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name as UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size < utf8_name_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string is too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     utf8_string,
+	     utf8_name,
+	     utf8_name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a pointer to the UTF-8 encoded name of the referenced item
+ * The UTF-8 string is owned by the file and remains valid until the file is closed
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_item_get_utf8_name_pointer(
+     libolecf_item_t *item,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libolecf_internal_item_t *internal_item = NULL;
+	static char *function                   = "libolecf_item_get_utf8_name_pointer";
+	int result                              = 0;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libolecf_internal_item_t *) item;
+
+	if( internal_item->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	result = libolecf_internal_item_get_utf8_name(
+	          internal_item,
+	          utf8_string,
+	          utf8_string_size,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name as UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 encoded name of the referenced item
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_item_get_utf16_name_size(
+     libolecf_item_t *item,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libolecf_internal_item_t *internal_item = NULL;
+	static char *function                   = "libolecf_item_get_utf16_name_size";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libolecf_internal_item_t *) item;
+
+	if( internal_item->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_utf16_string_size_from_utf16_stream(
+	     internal_item->directory_entry->name,
+	     internal_item->directory_entry->name_size,
+	     internal_item->io_handle->byte_order,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of name as UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 encoded name of the referenced item
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_item_get_utf16_name(
+     libolecf_item_t *item,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libolecf_internal_item_t *internal_item = NULL;
+	static char *function                   = "libolecf_item_get_utf16_name";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libolecf_internal_item_t *) item;
+
+	if( internal_item->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_utf16_string_copy_from_utf16_stream(
+	     utf16_string,
+	     utf16_string_size,
+	     internal_item->directory_entry->name,
+	     internal_item->directory_entry->name_size,
+	     internal_item->io_handle->byte_order,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to opy name to UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the referenced item
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_item_get_size(
+     libolecf_item_t *item,
+     uint32_t *size,
+     libcerror_error_t **error )
+{
+	libolecf_internal_item_t *internal_item = NULL;
+	static char *function                   = "libolecf_item_get_size";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libolecf_internal_item_t *) item;
+
+	if( internal_item->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = internal_item->directory_entry->size;
+
+	return( 1 );
+}
+
+/* Retrieves the extent map and the number of extents of the referenced item
+ * The extents that are beyond the size of the item are ignored
+ * Returns 1 if successful, 0 if the item has no extents or -1 on error
+ */
+int libolecf_internal_item_get_extent_map(
+     libolecf_internal_item_t *internal_item,
+     libolecf_extent_map_t **extent_map,
+     int *number_of_extents,
+     libcerror_error_t **error )
+{
+	libolecf_extent_map_t *safe_extent_map = NULL;
+	static char *function                  = "libolecf_internal_item_get_extent_map";
+	int extent_index                       = 0;
+	int result                             = 0;
 
-	if( item == NULL )
+	if( internal_item == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -337,15 +1070,13 @@ int libolecf_item_get_utf8_name(
 
 		return( -1 );
 	}
-	internal_item = (libolecf_internal_item_t *) item;
-
-	if( internal_item->io_handle == NULL )
+	if( internal_item->file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid item - missing IO handle.",
+		 "%s: invalid item - missing file.",
 		 function );
 
 		return( -1 );
@@ -361,59 +1092,101 @@ int libolecf_item_get_utf8_name(
 
 		return( -1 );
 	}
-	if( utf8_string == NULL )
+	if( extent_map == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string.",
+		 "%s: invalid extent map.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_size > (size_t) SSIZE_MAX )
+	if( number_of_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_item->directory_entry->type != LIBOLECF_ITEM_TYPE_STREAM )
+	 || ( internal_item->directory_entry->size == 0 ) )
+	{
+		return( 0 );
+	}
+	result = libolecf_io_handle_get_stream_extent_map_with_lock(
+	          internal_item->io_handle,
+	          internal_item->file->sat,
+	          internal_item->file->ssat,
+	          internal_item->directory_entry,
+	          &safe_extent_map,
+	          error );
+
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stream extent map.",
 		 function );
 
 		return( -1 );
 	}
-	if( libuna_utf8_string_copy_from_utf16_stream(
-	     utf8_string,
-	     utf8_string_size,
-	     internal_item->directory_entry->name,
-	     internal_item->directory_entry->name_size,
-	     internal_item->io_handle->byte_order,
-	     error ) != 1 )
+	/* The last sector of the stream is not necessarily fully used
+	 */
+	result = libolecf_extent_map_get_extent_index_by_offset(
+	          safe_extent_map,
+	          (off64_t) internal_item->directory_entry->size - 1,
+	          &extent_index,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to opy name to UTF-8 string.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent index of last stream offset.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stream - size value exceeds sector chain.",
 		 function );
 
 		return( -1 );
 	}
+	*extent_map        = safe_extent_map;
+	*number_of_extents = extent_index + 1;
+
 	return( 1 );
 }
 
-/* Retrieves the size of the UTF-16 encoded name of the referenced item
- * The returned size includes the end of string character
+/* Retrieves the number of extents of the referenced item
+ * An extent is a contiguous part of the stream data in the file
  * Returns 1 if successful or -1 on error
  */
-int libolecf_item_get_utf16_name_size(
+int libolecf_item_get_number_of_extents(
      libolecf_item_t *item,
-     size_t *utf16_string_size,
+     int *number_of_extents,
      libcerror_error_t **error )
 {
-	libolecf_internal_item_t *internal_item = NULL;
-	static char *function                   = "libolecf_item_get_utf16_name_size";
+	libolecf_extent_map_t *extent_map = NULL;
+	static char *function             = "libolecf_item_get_number_of_extents";
+	int result                        = 0;
+	int safe_number_of_extents        = 0;
 
 	if( item == NULL )
 	{
@@ -426,61 +1199,58 @@ int libolecf_item_get_utf16_name_size(
 
 		return( -1 );
 	}
-	internal_item = (libolecf_internal_item_t *) item;
-
-	if( internal_item->io_handle == NULL )
+	if( number_of_extents == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid item - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extents.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_item->directory_entry == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid item - missing directory entry.",
-		 function );
+	result = libolecf_internal_item_get_extent_map(
+	          (libolecf_internal_item_t *) item,
+	          &extent_map,
+	          &safe_number_of_extents,
+	          error );
 
-		return( -1 );
-	}
-	if( libuna_utf16_string_size_from_utf16_stream(
-	     internal_item->directory_entry->name,
-	     internal_item->directory_entry->name_size,
-	     internal_item->io_handle->byte_order,
-	     utf16_string_size,
-	     error ) != 1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine size of name as UTF-16 string.",
+		 "%s: unable to retrieve extent map.",
 		 function );
 
 		return( -1 );
 	}
+	*number_of_extents = safe_number_of_extents;
+
 	return( 1 );
 }
 
-/* Retrieves the UTF-16 encoded name of the referenced item
- * The size should include the end of string character
+/* Retrieves a specific extent of the referenced item
+ * The offset is relative to the start of the file
  * Returns 1 if successful or -1 on error
  */
-int libolecf_item_get_utf16_name(
+int libolecf_item_get_extent_by_index(
      libolecf_item_t *item,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     int extent_index,
+     off64_t *offset,
+     size64_t *size,
      libcerror_error_t **error )
 {
+	libolecf_extent_map_t *extent_map       = NULL;
 	libolecf_internal_item_t *internal_item = NULL;
-	static char *function                   = "libolecf_item_get_utf16_name";
+	static char *function                   = "libolecf_item_get_extent_by_index";
+	off64_t extent_file_offset              = 0;
+	off64_t extent_offset                   = 0;
+	size64_t extent_size                    = 0;
+	int number_of_extents                   = 0;
+	int result                              = 0;
 
 	if( item == NULL )
 	{
@@ -495,95 +1265,81 @@ int libolecf_item_get_utf16_name(
 	}
 	internal_item = (libolecf_internal_item_t *) item;
 
-	if( internal_item->io_handle == NULL )
+	if( offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid item - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_item->directory_entry == NULL )
+	if( size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid item - missing directory entry.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
 		 function );
 
 		return( -1 );
 	}
-	if( libuna_utf16_string_copy_from_utf16_stream(
-	     utf16_string,
-	     utf16_string_size,
-	     internal_item->directory_entry->name,
-	     internal_item->directory_entry->name_size,
-	     internal_item->io_handle->byte_order,
-	     error ) != 1 )
+	result = libolecf_internal_item_get_extent_map(
+	          internal_item,
+	          &extent_map,
+	          &number_of_extents,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to opy name to UTF-16 string.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent map.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves the size of the referenced item
- * Returns 1 if successful or -1 on error
- */
-int libolecf_item_get_size(
-     libolecf_item_t *item,
-     uint32_t *size,
-     libcerror_error_t **error )
-{
-	libolecf_internal_item_t *internal_item = NULL;
-	static char *function                   = "libolecf_item_get_size";
-
-	if( item == NULL )
+	if( ( extent_index < 0 )
+	 || ( extent_index >= number_of_extents ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid item.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid extent index value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	internal_item = (libolecf_internal_item_t *) item;
-
-	if( internal_item->directory_entry == NULL )
+	if( libolecf_extent_map_get_extent_by_index(
+	     extent_map,
+	     extent_index,
+	     &extent_offset,
+	     &extent_file_offset,
+	     &extent_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid item - missing directory entry.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent: %d.",
+		 function,
+		 extent_index );
 
 		return( -1 );
 	}
-	if( size == NULL )
+	if( extent_size > ( (size64_t) internal_item->directory_entry->size - (size64_t) extent_offset ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid size.",
-		 function );
-
-		return( -1 );
+		extent_size = (size64_t) internal_item->directory_entry->size - (size64_t) extent_offset;
 	}
-	*size = internal_item->directory_entry->size;
+	*offset = extent_file_offset;
+	*size   = extent_size;
 
 	return( 1 );
 }
@@ -701,7 +1457,9 @@ int libolecf_item_get_number_of_sub_items(
      libcerror_error_t **error )
 {
 	libolecf_internal_item_t *internal_item = NULL;
+	libcdata_array_t *sub_nodes_array       = NULL;
 	static char *function                   = "libolecf_item_get_number_of_sub_items";
+	int result                              = 0;
 
 	if( item == NULL )
 	{
@@ -716,10 +1474,30 @@ int libolecf_item_get_number_of_sub_items(
 	}
 	internal_item = (libolecf_internal_item_t *) item;
 
-	if( libcdata_tree_node_get_number_of_sub_nodes(
-	     internal_item->directory_tree_node,
-	     number_of_sub_items,
-	     error ) != 1 )
+	if( internal_item->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libolecf_internal_item_get_sub_nodes_array(
+	          internal_item,
+	          &sub_nodes_array,
+	          error );
+
+	if( result == 1 )
+	{
+		result = libcdata_array_get_number_of_entries(
+		          sub_nodes_array,
+		          number_of_sub_items,
+		          error );
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -743,8 +1521,10 @@ int libolecf_item_get_sub_item(
      libcerror_error_t **error )
 {
 	libolecf_internal_item_t *internal_item       = NULL;
+	libcdata_array_t *sub_nodes_array             = NULL;
 	libcdata_tree_node_t *sub_directory_tree_node = NULL;
 	static char *function                         = "libolecf_item_get_sub_item";
+	int result                                    = 0;
 
 	if( item == NULL )
 	{
@@ -759,6 +1539,17 @@ int libolecf_item_get_sub_item(
 	}
 	internal_item = (libolecf_internal_item_t *) item;
 
+	if( internal_item->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_item->directory_tree_node == NULL )
 	{
 		libcerror_error_set(
@@ -792,11 +1583,20 @@ int libolecf_item_get_sub_item(
 
 		return( -1 );
 	}
-	if( libcdata_tree_node_get_sub_node_by_index(
-	     internal_item->directory_tree_node,
-             sub_item_index,
-             &sub_directory_tree_node,
-	     error ) != 1 )
+	result = libolecf_internal_item_get_sub_nodes_array(
+	          internal_item,
+	          &sub_nodes_array,
+	          error );
+
+	if( result == 1 )
+	{
+		result = libcdata_array_get_entry_by_index(
+		          sub_nodes_array,
+		          sub_item_index,
+		          (intptr_t **) &sub_directory_tree_node,
+		          error );
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -901,14 +1701,45 @@ int libolecf_item_get_sub_item_by_utf8_name(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_item->file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	result = libolecf_directory_tree_get_sub_node_by_utf8_name(
 	          internal_item->directory_tree_node,
+	          internal_item->directory_table,
 	          utf8_string,
 	          utf8_string_length,
 	          internal_item->io_handle->byte_order,
 	          &sub_directory_tree_node,
 	          error );
 
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_item->file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( result == -1 )
 	{
 		libcerror_error_set(
@@ -1015,14 +1846,45 @@ int libolecf_item_get_sub_item_by_utf16_name(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_item->file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	result = libolecf_directory_tree_get_sub_node_by_utf16_name(
 	          internal_item->directory_tree_node,
+	          internal_item->directory_table,
 	          utf16_string,
 	          utf16_string_length,
 	          internal_item->io_handle->byte_order,
 	          &sub_directory_tree_node,
 	          error );
 
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_item->file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( result == -1 )
 	{
 		libcerror_error_set(
@@ -1190,13 +2052,45 @@ int libolecf_item_get_sub_item_by_utf8_path(
 		}
 		else
 		{
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+			if( libcthreads_read_write_lock_grab_for_write(
+			     internal_item->file->read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab read/write lock for writing.",
+				 function );
+
+				return( -1 );
+			}
+#endif
 			result = libolecf_directory_tree_get_sub_node_by_utf8_name(
 				  directory_tree_node,
+				  internal_item->directory_table,
 				  utf8_string_segment,
 				  utf8_string_segment_length,
 				  internal_item->io_handle->byte_order,
 				  &sub_directory_tree_node,
 				  error );
+
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+			if( libcthreads_read_write_lock_release_for_write(
+			     internal_item->file->read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release read/write lock for writing.",
+				 function );
+
+				return( -1 );
+			}
+#endif
 		}
 		if( result == -1 )
 		{
@@ -1360,13 +2254,45 @@ int libolecf_item_get_sub_item_by_utf16_path(
 		}
 		else
 		{
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+			if( libcthreads_read_write_lock_grab_for_write(
+			     internal_item->file->read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab read/write lock for writing.",
+				 function );
+
+				return( -1 );
+			}
+#endif
 			result = libolecf_directory_tree_get_sub_node_by_utf16_name(
 				  directory_tree_node,
+				  internal_item->directory_table,
 				  utf16_string_segment,
 				  utf16_string_segment_length,
 				  internal_item->io_handle->byte_order,
 				  &sub_directory_tree_node,
 				  error );
+
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+			if( libcthreads_read_write_lock_release_for_write(
+			     internal_item->file->read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release read/write lock for writing.",
+				 function );
+
+				return( -1 );
+			}
+#endif
 		}
 		if( result == -1 )
 		{
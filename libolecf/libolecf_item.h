@@ -26,12 +26,15 @@
 #include <types.h>
 
 #include "libolecf_directory_entry.h"
+#include "libolecf_directory_table.h"
+#include "libolecf_extent_map.h"
 #include "libolecf_extern.h"
 #include "libolecf_file.h"
 #include "libolecf_io_handle.h"
 #include "libolecf_libbfio.h"
 #include "libolecf_libcdata.h"
 #include "libolecf_libcerror.h"
+#include "libolecf_libcthreads.h"
 #include "libolecf_types.h"
 
 #if defined( __cplusplus )
@@ -58,6 +61,10 @@ struct libolecf_internal_item
 	 */
 	libcdata_tree_node_t *directory_tree_node;
 
+	/* The directory table
+	 */
+	libolecf_directory_table_t *directory_table;
+
 	/* The directory entry
 	 */
 	libolecf_directory_entry_t *directory_entry;
@@ -65,6 +72,12 @@ struct libolecf_internal_item
 	/* The current stream offset
 	 */
 	off64_t current_offset;
+
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libolecf_item_initialize(
@@ -86,6 +99,17 @@ int libolecf_item_get_type(
      uint8_t *type,
      libcerror_error_t **error );
 
+int libolecf_internal_item_get_utf8_name(
+     libolecf_internal_item_t *internal_item,
+     const uint8_t **utf8_name,
+     size_t *utf8_name_size,
+     libcerror_error_t **error );
+
+int libolecf_internal_item_get_sub_nodes_array(
+     libolecf_internal_item_t *internal_item,
+     libcdata_array_t **sub_nodes_array,
+     libcerror_error_t **error );
+
 LIBOLECF_EXTERN \
 int libolecf_item_get_utf8_name_size(
      libolecf_item_t *item,
@@ -99,6 +123,13 @@ int libolecf_item_get_utf8_name(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBOLECF_EXTERN \
+int libolecf_item_get_utf8_name_pointer(
+     libolecf_item_t *item,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 LIBOLECF_EXTERN \
 int libolecf_item_get_utf16_name_size(
      libolecf_item_t *item,
@@ -118,6 +149,26 @@ int libolecf_item_get_size(
      uint32_t *size,
      libcerror_error_t **error );
 
+int libolecf_internal_item_get_extent_map(
+     libolecf_internal_item_t *internal_item,
+     libolecf_extent_map_t **extent_map,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
+LIBOLECF_EXTERN \
+int libolecf_item_get_number_of_extents(
+     libolecf_item_t *item,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
+LIBOLECF_EXTERN \
+int libolecf_item_get_extent_by_index(
+     libolecf_item_t *item,
+     int extent_index,
+     off64_t *offset,
+     size64_t *size,
+     libcerror_error_t **error );
+
 LIBOLECF_EXTERN \
 int libolecf_item_get_creation_time(
      libolecf_item_t *item,
@@ -0,0 +1,618 @@
+/*
+ * Memory map functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <windows.h>
+
+#elif defined( HAVE_MMAP )
+#if defined( HAVE_SYS_TYPES_H )
+#include <sys/types.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#endif /* defined( WINAPI ) */
+
+#include "libolecf_definitions.h"
+#include "libolecf_libbfio.h"
+#include "libolecf_libcerror.h"
+#include "libolecf_memory_map.h"
+
+/* Creates a memory map
+ * Make sure the value memory_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_memory_map_initialize(
+     libolecf_memory_map_t **memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_memory_map_initialize";
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*memory_map = memory_allocate_structure(
+	               libolecf_memory_map_t );
+
+	if( *memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create memory map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *memory_map,
+	     0,
+	     sizeof( libolecf_memory_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear memory map.",
+		 function );
+
+		memory_free(
+		 *memory_map );
+
+		*memory_map = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *memory_map != NULL )
+	{
+		memory_free(
+		 *memory_map );
+
+		*memory_map = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a memory map
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_memory_map_free(
+     libolecf_memory_map_t **memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_memory_map_free";
+	int result            = 1;
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_map != NULL )
+	{
+		if( libolecf_memory_map_close(
+		     *memory_map,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close memory map.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *memory_map );
+
+		*memory_map = NULL;
+	}
+	return( result );
+}
+
+/* Maps a file into memory for reading
+ * Returns 1 if successful, 0 if the file cannot be mapped or -1 on error
+ */
+int libolecf_memory_map_open(
+     libolecf_memory_map_t *memory_map,
+     const char *filename,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER large_integer_size;
+
+	HANDLE file_handle    = INVALID_HANDLE_VALUE;
+	HANDLE mapping_handle = NULL;
+	LPVOID data           = NULL;
+
+#elif defined( HAVE_MMAP )
+	struct stat file_statistics;
+
+	void *data            = NULL;
+	int file_descriptor   = -1;
+#endif
+	static char *function = "libolecf_memory_map_open";
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_map->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory map - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	file_handle = CreateFileA(
+	               (LPCSTR) filename,
+	               GENERIC_READ,
+	               FILE_SHARE_READ,
+	               NULL,
+	               OPEN_EXISTING,
+	               FILE_ATTRIBUTE_NORMAL,
+	               NULL );
+
+	if( file_handle == INVALID_HANDLE_VALUE )
+	{
+		return( 0 );
+	}
+	if( ( GetFileSizeEx(
+	       file_handle,
+	       &large_integer_size ) == 0 )
+	 || ( large_integer_size.QuadPart <= 0 )
+	 || ( (uint64_t) large_integer_size.QuadPart > (uint64_t) SSIZE_MAX ) )
+	{
+		CloseHandle(
+		 file_handle );
+
+		return( 0 );
+	}
+	mapping_handle = CreateFileMappingA(
+	                  file_handle,
+	                  NULL,
+	                  PAGE_READONLY,
+	                  0,
+	                  0,
+	                  NULL );
+
+	CloseHandle(
+	 file_handle );
+
+	if( mapping_handle == NULL )
+	{
+		return( 0 );
+	}
+	data = MapViewOfFile(
+	        mapping_handle,
+	        FILE_MAP_READ,
+	        0,
+	        0,
+	        0 );
+
+	/* The mapped view retains a reference to the file mapping
+	 */
+	CloseHandle(
+	 mapping_handle );
+
+	if( data == NULL )
+	{
+		return( 0 );
+	}
+	memory_map->data      = (uint8_t *) data;
+	memory_map->data_size = (size_t) large_integer_size.QuadPart;
+
+	return( 1 );
+
+#elif defined( HAVE_MMAP )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	/* Only regular files can be mapped, other inputs are read using libbfio
+	 */
+	if( ( fstat(
+	       file_descriptor,
+	       &file_statistics ) != 0 )
+	 || ( S_ISREG( file_statistics.st_mode ) == 0 )
+	 || ( file_statistics.st_size <= 0 )
+	 || ( (uint64_t) file_statistics.st_size > (uint64_t) SSIZE_MAX ) )
+	{
+		close(
+		 file_descriptor );
+
+		return( 0 );
+	}
+	data = mmap(
+	        NULL,
+	        (size_t) file_statistics.st_size,
+	        PROT_READ,
+	        MAP_PRIVATE,
+	        file_descriptor,
+	        0 );
+
+	/* The mapping retains a reference to the file
+	 */
+	close(
+	 file_descriptor );
+
+	if( data == MAP_FAILED )
+	{
+		return( 0 );
+	}
+	memory_map->data      = (uint8_t *) data;
+	memory_map->data_size = (size_t) file_statistics.st_size;
+
+	return( 1 );
+
+#else
+	return( 0 );
+
+#endif /* defined( WINAPI ) */
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Maps a file into memory for reading
+ * Returns 1 if successful, 0 if the file cannot be mapped or -1 on error
+ */
+int libolecf_memory_map_open_wide(
+     libolecf_memory_map_t *memory_map,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER large_integer_size;
+
+	HANDLE file_handle    = INVALID_HANDLE_VALUE;
+	HANDLE mapping_handle = NULL;
+	LPVOID data           = NULL;
+#endif
+	static char *function = "libolecf_memory_map_open_wide";
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_map->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory map - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	file_handle = CreateFileW(
+	               (LPCWSTR) filename,
+	               GENERIC_READ,
+	               FILE_SHARE_READ,
+	               NULL,
+	               OPEN_EXISTING,
+	               FILE_ATTRIBUTE_NORMAL,
+	               NULL );
+
+	if( file_handle == INVALID_HANDLE_VALUE )
+	{
+		return( 0 );
+	}
+	if( ( GetFileSizeEx(
+	       file_handle,
+	       &large_integer_size ) == 0 )
+	 || ( large_integer_size.QuadPart <= 0 )
+	 || ( (uint64_t) large_integer_size.QuadPart > (uint64_t) SSIZE_MAX ) )
+	{
+		CloseHandle(
+		 file_handle );
+
+		return( 0 );
+	}
+	mapping_handle = CreateFileMappingW(
+	                  file_handle,
+	                  NULL,
+	                  PAGE_READONLY,
+	                  0,
+	                  0,
+	                  NULL );
+
+	CloseHandle(
+	 file_handle );
+
+	if( mapping_handle == NULL )
+	{
+		return( 0 );
+	}
+	data = MapViewOfFile(
+	        mapping_handle,
+	        FILE_MAP_READ,
+	        0,
+	        0,
+	        0 );
+
+	/* The mapped view retains a reference to the file mapping
+	 */
+	CloseHandle(
+	 mapping_handle );
+
+	if( data == NULL )
+	{
+		return( 0 );
+	}
+	memory_map->data      = (uint8_t *) data;
+	memory_map->data_size = (size_t) large_integer_size.QuadPart;
+
+	return( 1 );
+#else
+	/* Wide character filenames are only mapped on Windows, on other platforms
+	 * libolecf_file_open_wide maps the file using the narrow name of the file IO handle
+	 */
+	return( 0 );
+
+#endif /* defined( WINAPI ) */
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Determines if the memory mapped file is the same file as the file IO handle
+ * The filename can be replaced between opening the file IO handle and mapping the file
+ * hence the size and the header of both are compared
+ * Returns 1 if the same, 0 if not or -1 on error
+ */
+int libolecf_memory_map_verify_file_io_handle(
+     libolecf_memory_map_t *memory_map,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t file_io_handle_data[ LIBOLECF_MEMORY_MAP_VERIFY_DATA_SIZE ];
+
+	static char *function = "libolecf_memory_map_verify_file_io_handle";
+	size64_t file_size    = 0;
+	size_t read_size      = LIBOLECF_MEMORY_MAP_VERIFY_DATA_SIZE;
+	ssize_t read_count    = 0;
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_map->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid memory map - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) memory_map->data_size != file_size )
+	{
+		return( 0 );
+	}
+	if( file_size < (size64_t) read_size )
+	{
+		read_size = (size_t) file_size;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              file_io_handle_data,
+	              read_size,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data from file IO handle at offset: 0 (0x00000000).",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     memory_map->data,
+	     file_io_handle_data,
+	     read_size ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Unmaps the file
+ * Returns 0 if successful or -1 on error
+ */
+int libolecf_memory_map_close(
+     libolecf_memory_map_t *memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_memory_map_close";
+	int result            = 0;
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_map->data == NULL )
+	{
+		return( 0 );
+	}
+#if defined( WINAPI )
+	if( UnmapViewOfFile(
+	     (LPCVOID) memory_map->data ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to unmap view of file.",
+		 function );
+
+		result = -1;
+	}
+#elif defined( HAVE_MMAP )
+	if( munmap(
+	     (void *) memory_map->data,
+	     memory_map->data_size ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to unmap file.",
+		 function );
+
+		result = -1;
+	}
+#endif /* defined( WINAPI ) */
+
+	memory_map->data      = NULL;
+	memory_map->data_size = 0;
+
+	return( result );
+}
+
@@ -0,0 +1,84 @@
+/*
+ * Memory map functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBOLECF_MEMORY_MAP_H )
+#define _LIBOLECF_MEMORY_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libolecf_libbfio.h"
+#include "libolecf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libolecf_memory_map libolecf_memory_map_t;
+
+struct libolecf_memory_map
+{
+	/* The mapped data
+	 */
+	uint8_t *data;
+
+	/* The mapped data size
+	 */
+	size_t data_size;
+};
+
+int libolecf_memory_map_initialize(
+     libolecf_memory_map_t **memory_map,
+     libcerror_error_t **error );
+
+int libolecf_memory_map_free(
+     libolecf_memory_map_t **memory_map,
+     libcerror_error_t **error );
+
+int libolecf_memory_map_open(
+     libolecf_memory_map_t *memory_map,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+int libolecf_memory_map_open_wide(
+     libolecf_memory_map_t *memory_map,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+int libolecf_memory_map_verify_file_io_handle(
+     libolecf_memory_map_t *memory_map,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libolecf_memory_map_close(
+     libolecf_memory_map_t *memory_map,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBOLECF_MEMORY_MAP_H ) */
+
@@ -0,0 +1,674 @@
+/*
+ * Name index functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libolecf_definitions.h"
+#include "libolecf_libcerror.h"
+#include "libolecf_libuna.h"
+#include "libolecf_name_index.h"
+
+/* Creates a name index
+ * Make sure the value name_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_name_index_initialize(
+     libolecf_name_index_t **name_index,
+     int maximum_number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_name_index_initialize";
+	size_t hashes_size    = 0;
+	size_t values_size    = 0;
+	int number_of_slots   = 0;
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid name index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_values < 0 )
+	 || ( maximum_number_of_values > ( INT_MAX / 4 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the load factor of the index at or below 0.5 so that a lookup
+	 * always terminates on an empty slot
+	 */
+	number_of_slots = 8;
+
+	while( number_of_slots < ( maximum_number_of_values * 2 ) )
+	{
+		number_of_slots *= 2;
+	}
+	hashes_size = sizeof( uint32_t ) * (size_t) number_of_slots;
+	values_size = sizeof( intptr_t * ) * (size_t) number_of_slots;
+
+	if( ( hashes_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	 || ( values_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of slots value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	*name_index = memory_allocate_structure(
+	               libolecf_name_index_t );
+
+	if( *name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *name_index,
+	     0,
+	     sizeof( libolecf_name_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear name index.",
+		 function );
+
+		memory_free(
+		 *name_index );
+
+		*name_index = NULL;
+
+		return( -1 );
+	}
+	( *name_index )->hashes = (uint32_t *) memory_allocate(
+	                                        hashes_size );
+
+	if( ( *name_index )->hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hashes.",
+		 function );
+
+		goto on_error;
+	}
+	( *name_index )->values = (intptr_t **) memory_allocate(
+	                                         values_size );
+
+	if( ( *name_index )->values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create values.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *name_index )->hashes,
+	     0,
+	     hashes_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hashes.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *name_index )->values,
+	     0,
+	     values_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear values.",
+		 function );
+
+		goto on_error;
+	}
+	( *name_index )->number_of_slots = number_of_slots;
+
+	return( 1 );
+
+on_error:
+	if( *name_index != NULL )
+	{
+		if( ( *name_index )->values != NULL )
+		{
+			memory_free(
+			 ( *name_index )->values );
+		}
+		if( ( *name_index )->hashes != NULL )
+		{
+			memory_free(
+			 ( *name_index )->hashes );
+		}
+		memory_free(
+		 *name_index );
+
+		*name_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a name index
+ * The values are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_name_index_free(
+     libolecf_name_index_t **name_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_name_index_free";
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_index != NULL )
+	{
+		if( ( *name_index )->values != NULL )
+		{
+			memory_free(
+			 ( *name_index )->values );
+		}
+		if( ( *name_index )->hashes != NULL )
+		{
+			memory_free(
+			 ( *name_index )->hashes );
+		}
+		memory_free(
+		 *name_index );
+
+		*name_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Inserts a value into the name index
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_name_index_insert_value(
+     libolecf_name_index_t *name_index,
+     uint32_t name_hash,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_name_index_insert_value";
+	int slot_index        = 0;
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_index->number_of_values + 1 ) > ( name_index->number_of_slots / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name index - number of values exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	slot_index = (int) ( name_hash & (uint32_t) ( name_index->number_of_slots - 1 ) );
+
+	while( name_index->values[ slot_index ] != NULL )
+	{
+		slot_index = ( slot_index + 1 ) & ( name_index->number_of_slots - 1 );
+	}
+	name_index->hashes[ slot_index ] = name_hash;
+	name_index->values[ slot_index ] = value;
+
+	name_index->number_of_values += 1;
+
+	return( 1 );
+}
+
+/* Retrieves a value with a specific name hash from the name index
+ * Different names can have the same hash, hence the caller must compare the name of the value
+ * The slot index is used to continue the search and should be -1 for the first call
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libolecf_name_index_get_value_by_hash(
+     libolecf_name_index_t *name_index,
+     uint32_t name_hash,
+     int *slot_index,
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_name_index_get_value_by_hash";
+	int safe_slot_index   = 0;
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *slot_index < -1 )
+	 || ( *slot_index >= name_index->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *slot_index == -1 )
+	{
+		safe_slot_index = (int) ( name_hash & (uint32_t) ( name_index->number_of_slots - 1 ) );
+	}
+	else
+	{
+		safe_slot_index = ( *slot_index + 1 ) & ( name_index->number_of_slots - 1 );
+	}
+	/* The index always contains empty slots, hence the search ends on an empty slot
+	 */
+	while( name_index->values[ safe_slot_index ] != NULL )
+	{
+		if( name_index->hashes[ safe_slot_index ] == name_hash )
+		{
+			*slot_index = safe_slot_index;
+			*value      = name_index->values[ safe_slot_index ];
+
+			return( 1 );
+		}
+		safe_slot_index = ( safe_slot_index + 1 ) & ( name_index->number_of_slots - 1 );
+	}
+	return( 0 );
+}
+
+/* Updates the name hash with a UTF-16 character
+ * The character is converted to upper case, as used by the compound file to order names,
+ * so that names that differ in case only have the same hash
+ * Returns the updated name hash
+ */
+uint32_t libolecf_name_index_update_hash(
+          uint32_t name_hash,
+          uint16_t character )
+{
+	if( ( character >= (uint16_t) 'a' )
+	 && ( character <= (uint16_t) 'z' ) )
+	{
+		character -= (uint16_t) 'a' - (uint16_t) 'A';
+	}
+	else if( ( character >= 0x00e0 )
+	      && ( character <= 0x00fe )
+	      && ( character != 0x00f7 ) )
+	{
+		character -= 0x0020;
+	}
+	/* 32-bit FNV-1a
+	 */
+	name_hash ^= (uint32_t) ( character & 0x00ff );
+	name_hash *= 0x01000193UL;
+	name_hash ^= (uint32_t) ( character >> 8 );
+	name_hash *= 0x01000193UL;
+
+	return( name_hash );
+}
+
+/* Calculates the name hash of an UTF-16 stream
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_name_index_calculate_hash_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint8_t byte_order,
+     uint32_t *name_hash,
+     libcerror_error_t **error )
+{
+	static char *function   = "libolecf_name_index_calculate_hash_from_utf16_stream";
+	size_t stream_index     = 0;
+	uint32_t safe_name_hash = LIBOLECF_NAME_INDEX_INITIAL_HASH;
+	uint16_t character      = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_order != LIBOLECF_ENDIAN_BIG )
+	 && ( byte_order != LIBOLECF_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( stream_index + 1 ) < utf16_stream_size )
+	{
+		if( byte_order == LIBOLECF_ENDIAN_LITTLE )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( utf16_stream[ stream_index ] ),
+			 character );
+		}
+		else
+		{
+			byte_stream_copy_to_uint16_big_endian(
+			 &( utf16_stream[ stream_index ] ),
+			 character );
+		}
+		if( character == 0 )
+		{
+			break;
+		}
+		safe_name_hash = libolecf_name_index_update_hash(
+		                  safe_name_hash,
+		                  character );
+
+		stream_index += 2;
+	}
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
+/* Calculates the name hash of an UTF-8 string
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_name_index_calculate_hash_from_utf8_string(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libolecf_name_index_calculate_hash_from_utf8_string";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf8_string_index                     = 0;
+	uint32_t safe_name_hash                      = LIBOLECF_NAME_INDEX_INITIAL_HASH;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf8_string_index < utf8_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf8(
+		     &unicode_character,
+		     utf8_string,
+		     utf8_string_length,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 string to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		/* Characters outside the basic multilingual plane are stored as surrogate pairs
+		 */
+		if( unicode_character > 0x0000ffffUL )
+		{
+			unicode_character -= 0x00010000UL;
+
+			safe_name_hash = libolecf_name_index_update_hash(
+			                  safe_name_hash,
+			                  (uint16_t) ( 0xd800 + ( unicode_character >> 10 ) ) );
+
+			unicode_character = 0xdc00 + ( unicode_character & 0x000003ffUL );
+		}
+		safe_name_hash = libolecf_name_index_update_hash(
+		                  safe_name_hash,
+		                  (uint16_t) unicode_character );
+	}
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
+/* Calculates the name hash of an UTF-16 string
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_name_index_calculate_hash_from_utf16_string(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error )
+{
+	static char *function     = "libolecf_name_index_calculate_hash_from_utf16_string";
+	size_t utf16_string_index = 0;
+	uint32_t safe_name_hash   = LIBOLECF_NAME_INDEX_INITIAL_HASH;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	for( utf16_string_index = 0;
+	     utf16_string_index < utf16_string_length;
+	     utf16_string_index++ )
+	{
+		if( utf16_string[ utf16_string_index ] == 0 )
+		{
+			break;
+		}
+		safe_name_hash = libolecf_name_index_update_hash(
+		                  safe_name_hash,
+		                  utf16_string[ utf16_string_index ] );
+	}
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
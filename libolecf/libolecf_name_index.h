@@ -0,0 +1,107 @@
+/*
+ * Name index functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBOLECF_NAME_INDEX_H )
+#define _LIBOLECF_NAME_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libolecf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libolecf_name_index libolecf_name_index_t;
+
+struct libolecf_name_index
+{
+	/* The number of slots
+	 * this is a power of 2
+	 */
+	int number_of_slots;
+
+	/* The number of values
+	 */
+	int number_of_values;
+
+	/* The name hashes
+	 */
+	uint32_t *hashes;
+
+	/* The values
+	 */
+	intptr_t **values;
+};
+
+int libolecf_name_index_initialize(
+     libolecf_name_index_t **name_index,
+     int maximum_number_of_values,
+     libcerror_error_t **error );
+
+int libolecf_name_index_free(
+     libolecf_name_index_t **name_index,
+     libcerror_error_t **error );
+
+int libolecf_name_index_insert_value(
+     libolecf_name_index_t *name_index,
+     uint32_t name_hash,
+     intptr_t *value,
+     libcerror_error_t **error );
+
+int libolecf_name_index_get_value_by_hash(
+     libolecf_name_index_t *name_index,
+     uint32_t name_hash,
+     int *slot_index,
+     intptr_t **value,
+     libcerror_error_t **error );
+
+uint32_t libolecf_name_index_update_hash(
+          uint32_t name_hash,
+          uint16_t character );
+
+int libolecf_name_index_calculate_hash_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint8_t byte_order,
+     uint32_t *name_hash,
+     libcerror_error_t **error );
+
+int libolecf_name_index_calculate_hash_from_utf8_string(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error );
+
+int libolecf_name_index_calculate_hash_from_utf16_string(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBOLECF_NAME_INDEX_H ) */
+
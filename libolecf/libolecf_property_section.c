@@ -35,7 +35,6 @@
 #include "libolecf_libfwps.h"
 #include "libolecf_property_section.h"
 #include "libolecf_property_value.h"
-#include "libolecf_stream.h"
 #include "libolecf_types.h"
 
 #include "olecf_property_set.h"
@@ -202,69 +201,6 @@ int libolecf_internal_property_section_free(
         return( result );
 }
 
-/* Reads the property section list entry
- * Returns 1 if successful or -1 on error
- */
-int libolecf_property_section_read_list_entry(
-     libolecf_internal_property_section_t *internal_property_section,
-     libolecf_item_t *property_set_stream,
-     uint8_t byte_order,
-     uint32_t *section_header_offset,
-     libcerror_error_t **error )
-{
-	uint8_t property_section_list_entry_data[ sizeof( olecf_property_section_list_entry_t ) ];
-
-	static char *function = "libolecf_property_section_read_list_entry";
-	ssize_t read_count    = 0;
-
-	if( internal_property_section == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid property section.",
-		 function );
-
-		return( -1 );
-	}
-	read_count = libolecf_stream_read_buffer(
-		      property_set_stream,
-		      property_section_list_entry_data,
-		      sizeof( olecf_property_section_list_entry_t ),
-		      error );
-
-	if( read_count != (ssize_t) sizeof( olecf_property_section_list_entry_t ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read list entry.",
-		 function );
-
-		return( -1 );
-	}
-	if( libolecf_property_section_read_list_entry_data(
-	     internal_property_section,
-	     property_section_list_entry_data,
-	     sizeof( olecf_property_section_list_entry_t ),
-	     byte_order,
-	     section_header_offset,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read list entry.",
-		 function );
-
-		return( -1 );
-	}
-	return( 1 );
-}
-
 /* Reads the property section list entry
  * Returns 1 if successful or -1 on error
  */
@@ -429,22 +365,21 @@ int libolecf_property_section_read_list_entry_data(
 }
 
 /* Reads the property section
+ * The data starts with the section header and is bounded by the end of the property set stream data
+ * Only the property list entries are read, the property values reference the data and are read on demand
  * Returns 1 if successful or -1 on error
  */
-int libolecf_property_section_read(
+int libolecf_property_section_read_data(
      libolecf_internal_property_section_t *internal_property_section,
      libolecf_io_handle_t *io_handle,
-     libolecf_item_t *property_set_stream,
-     uint32_t section_header_offset,
+     const uint8_t *data,
+     size_t data_size,
      uint8_t byte_order,
      libcerror_error_t **error )
 {
-	olecf_property_section_header_t property_section_header;
-
 	libolecf_property_value_t *property_value = NULL;
-	static char *function                     = "libolecf_property_section_read";
-	ssize_t read_count                        = 0;
-	off64_t property_values_list_entry_offset = 0;
+	static char *function                     = "libolecf_property_section_read_data";
+	size_t list_entry_data_offset             = 0;
 	uint32_t number_of_properties             = 0;
 	uint32_t property_index                   = 0;
 	uint32_t property_value_data_offset       = 0;
@@ -467,51 +402,62 @@ int libolecf_property_section_read(
 
 		return( -1 );
 	}
-	if( ( byte_order != LIBOLECF_ENDIAN_BIG )
-	 && ( byte_order != LIBOLECF_ENDIAN_LITTLE ) )
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported byte order: 0x%02" PRIx8 ".",
-		 function,
-		 byte_order );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
 
 		return( -1 );
 	}
-	if( libolecf_stream_seek_offset(
-	     property_set_stream,
-	     (off64_t) section_header_offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek header at offset: %" PRIu32 ".",
-		 function,
-		 section_header_offset );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	read_count = libolecf_stream_read_buffer(
-		      property_set_stream,
-		      (uint8_t *) &property_section_header,
-		      sizeof( olecf_property_section_header_t ),
-		      error );
+	if( data_size < sizeof( olecf_property_section_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
 
-	if( read_count != (ssize_t) sizeof( olecf_property_section_header_t ) )
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read header.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
+	}
+	if( ( byte_order != LIBOLECF_ENDIAN_BIG )
+	 && ( byte_order != LIBOLECF_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order: 0x%02" PRIx8 ".",
+		 function,
+		 byte_order );
+
+		return( -1 );
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -520,7 +466,7 @@ int libolecf_property_section_read(
 		 "%s: header data:\n",
 		 function );
 		libcnotify_print_data(
-		 (uint8_t *) &property_section_header,
+		 data,
 		 sizeof( olecf_property_section_header_t ),
 		 0 );
 	}
@@ -529,22 +475,22 @@ int libolecf_property_section_read(
 	{
 #if defined( HAVE_DEBUG_OUTPUT )
 		byte_stream_copy_to_uint32_little_endian(
-		 property_section_header.data_size,
+		 ( (olecf_property_section_header_t *) data )->data_size,
 		 section_data_size );
 #endif
 		byte_stream_copy_to_uint32_little_endian(
-		 property_section_header.number_of_properties,
+		 ( (olecf_property_section_header_t *) data )->number_of_properties,
 		 number_of_properties );
 	}
 	else if( byte_order == LIBOLECF_ENDIAN_BIG )
 	{
 #if defined( HAVE_DEBUG_OUTPUT )
 		byte_stream_copy_to_uint32_big_endian(
-		 property_section_header.data_size,
+		 ( (olecf_property_section_header_t *) data )->data_size,
 		 section_data_size );
 #endif
 		byte_stream_copy_to_uint32_big_endian(
-		 property_section_header.number_of_properties,
+		 ( (olecf_property_section_header_t *) data )->number_of_properties,
 		 number_of_properties );
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -564,30 +510,23 @@ int libolecf_property_section_read(
 		 "\n" );
 	}
 #endif
-	property_values_list_entry_offset = section_header_offset
-	                                  + sizeof( olecf_property_section_header_t );
+	if( (size_t) number_of_properties > ( ( data_size - sizeof( olecf_property_section_header_t ) ) / sizeof( olecf_property_set_property_list_entry_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of properties value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	list_entry_data_offset = sizeof( olecf_property_section_header_t );
 
 	for( property_index = 0;
 	     property_index < number_of_properties;
 	     property_index++ )
 	{
-		if( libolecf_stream_seek_offset(
-		     property_set_stream,
-		     property_values_list_entry_offset,
-		     SEEK_SET,
-		     error ) == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_SEEK_FAILED,
-			 "%s: unable to seek property values list entry: %d offset: %" PRIi64 ".",
-			 function,
-			 property_index,
-			 property_values_list_entry_offset );
-
-			goto on_error;
-		}
 		if( libolecf_property_value_initialize(
 		     &property_value,
 		     error ) != 1 )
@@ -602,9 +541,10 @@ int libolecf_property_section_read(
 
 			goto on_error;
 		}
-		if( libolecf_property_value_read_list_entry(
+		if( libolecf_property_value_read_list_entry_data(
 		     (libolecf_internal_property_value_t *) property_value,
-		     property_set_stream,
+		     &( data[ list_entry_data_offset ] ),
+		     sizeof( olecf_property_set_property_list_entry_t ),
 		     byte_order,
 		     &property_value_data_offset,
 		     error ) != 1 )
@@ -619,8 +559,10 @@ int libolecf_property_section_read(
 
 			goto on_error;
 		}
-/* TODO check upper bound with stream size, section_data_size is not the right upper bound ? */
-		if( property_value_data_offset <= sizeof( olecf_property_section_header_t ) )
+		list_entry_data_offset += sizeof( olecf_property_set_property_list_entry_t );
+
+		if( ( property_value_data_offset <= sizeof( olecf_property_section_header_t ) )
+		 || ( (size_t) property_value_data_offset >= data_size ) )
 		{
 			libcerror_error_set(
 			 error,
@@ -631,39 +573,13 @@ int libolecf_property_section_read(
 
 			goto on_error;
 		}
-		if( libolecf_stream_get_offset(
-		     property_set_stream,
-		     &property_values_list_entry_offset,
-		     error ) == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_SEEK_FAILED,
-			 "%s: unable to retrieve property values list entry offset.",
-			 function );
-
-			goto on_error;
-		}
-		if( libolecf_property_value_read_data(
-		     (libolecf_internal_property_value_t *) property_value,
-		     property_set_stream,
-		     io_handle,
-		     section_header_offset + property_value_data_offset,
-		     byte_order,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read property value: %d at offset: %" PRIu32 ".",
-			 function,
-			 property_index,
-			 section_header_offset + property_value_data_offset );
+		/* The property value data is read on demand
+		 */
+		( (libolecf_internal_property_value_t *) property_value )->data           = &( data[ property_value_data_offset ] );
+		( (libolecf_internal_property_value_t *) property_value )->data_size      = data_size - (size_t) property_value_data_offset;
+		( (libolecf_internal_property_value_t *) property_value )->byte_order     = byte_order;
+		( (libolecf_internal_property_value_t *) property_value )->ascii_codepage = io_handle->ascii_codepage;
 
-			goto on_error;
-		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -61,13 +61,6 @@ int libolecf_internal_property_section_free(
      libolecf_internal_property_section_t **internal_property_section,
      libcerror_error_t **error );
 
-int libolecf_property_section_read_list_entry(
-     libolecf_internal_property_section_t *internal_property_section,
-     libolecf_item_t *property_set_stream,
-     uint8_t byte_order,
-     uint32_t *section_header_offset,
-     libcerror_error_t **error );
-
 int libolecf_property_section_read_list_entry_data(
      libolecf_internal_property_section_t *internal_property_section,
      const uint8_t *data,
@@ -76,11 +69,11 @@ int libolecf_property_section_read_list_entry_data(
      uint32_t *section_header_offset,
      libcerror_error_t **error );
 
-int libolecf_property_section_read(
+int libolecf_property_section_read_data(
      libolecf_internal_property_section_t *internal_property_section,
      libolecf_io_handle_t *io_handle,
-     libolecf_item_t *property_set_stream,
-     uint32_t section_header_offset,
+     const uint8_t *data,
+     size_t data_size,
      uint8_t byte_order,
      libcerror_error_t **error );
 
@@ -27,6 +27,7 @@
 #include "libolecf_debug.h"
 #include "libolecf_definitions.h"
 #include "libolecf_io_handle.h"
+#include "libolecf_item.h"
 #include "libolecf_libcdata.h"
 #include "libolecf_libcerror.h"
 #include "libolecf_libcnotify.h"
@@ -168,6 +169,11 @@ int libolecf_property_set_free(
 
 			result = -1;
 		}
+		if( internal_property_set->stream_data != NULL )
+		{
+			memory_free(
+			 internal_property_set->stream_data );
+		}
 		memory_free(
 		 internal_property_set );
 	}
@@ -366,27 +372,25 @@ int libolecf_property_set_read_header_data(
 	return( 1 );
 }
 
-/* Reads the property set from the property set stream
+/* Reads the property set
+ * The property values reference the data, which must remain available for the lifetime of the property set
  * Returns 1 if successful or -1 on error
  */
-int libolecf_property_set_read(
-     libolecf_property_set_t *property_set,
+int libolecf_property_set_read_data(
+     libolecf_internal_property_set_t *internal_property_set,
      libolecf_io_handle_t *io_handle,
-     libolecf_item_t *property_set_stream,
+     const uint8_t *data,
+     size_t data_size,
      libcerror_error_t **error )
 {
-	uint8_t property_set_header_data[ sizeof( olecf_property_set_header_t ) ];
-
-	libolecf_internal_property_set_t *internal_property_set = NULL;
-	libolecf_property_section_t *property_section           = NULL;
-	static char *function                                   = "libolecf_property_set_read";
-	off64_t section_list_entry_offset                       = 0;
-	ssize_t read_count                                      = 0;
-	uint32_t section_header_offset                          = 0;
-	uint16_t section_index                                  = 0;
-	int sections_entry                                      = 0;
+	libolecf_property_section_t *property_section = NULL;
+	static char *function                         = "libolecf_property_set_read_data";
+	size_t list_entry_data_offset                 = 0;
+	uint32_t section_header_offset                = 0;
+	uint16_t section_index                        = 0;
+	int sections_entry                            = 0;
 
-	if( property_set == NULL )
+	if( internal_property_set == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -397,43 +401,42 @@ int libolecf_property_set_read(
 
 		return( -1 );
 	}
-	internal_property_set = (libolecf_internal_property_set_t *) property_set;
-
-	if( libolecf_stream_seek_offset(
-	     property_set_stream,
-	     0,
-	     SEEK_SET,
-	     error ) == -1 )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek property set header offset: 0 (0x00000000).",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	read_count = libolecf_stream_read_buffer(
-	              property_set_stream,
-	              property_set_header_data,
-	              sizeof( olecf_property_set_header_t ),
-	              error );
+	if( data_size < sizeof( olecf_property_set_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
 
-	if( read_count != (ssize_t) sizeof( olecf_property_set_header_t ) )
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read property set header.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( libolecf_property_set_read_header_data(
 	     internal_property_set,
-	     property_set_header_data,
+	     data,
 	     sizeof( olecf_property_set_header_t ),
 	     error ) != 1 )
 	{
@@ -446,10 +449,21 @@ int libolecf_property_set_read(
 
 		goto on_error;
 	}
-	section_list_entry_offset = sizeof( olecf_property_set_header_t );
+	if( (size_t) internal_property_set->number_of_sections > ( ( data_size - sizeof( olecf_property_set_header_t ) ) / sizeof( olecf_property_section_list_entry_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of sections value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	list_entry_data_offset = sizeof( olecf_property_set_header_t );
 
 	for( section_index = 0;
-	     section_index < (int) internal_property_set->number_of_sections;
+	     section_index < internal_property_set->number_of_sections;
 	     section_index++ )
 	{
 		if( libolecf_property_section_initialize(
@@ -460,32 +474,16 @@ int libolecf_property_set_read(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create property section: %d.",
+			 "%s: unable to create property section: %" PRIu16 ".",
 			 function,
 			 section_index );
 
 			goto on_error;
 		}
-		if( libolecf_stream_seek_offset(
-		     property_set_stream,
-		     section_list_entry_offset,
-		     SEEK_SET,
-		     error ) == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_SEEK_FAILED,
-			 "%s: unable to seek property section list entry: %d offset: %" PRIi64 ".",
-			 function,
-			 section_index,
-			 section_list_entry_offset );
-
-			goto on_error;
-		}
-		if( libolecf_property_section_read_list_entry(
+		if( libolecf_property_section_read_list_entry_data(
 		     (libolecf_internal_property_section_t *) property_section,
-		     property_set_stream,
+		     &( data[ list_entry_data_offset ] ),
+		     sizeof( olecf_property_section_list_entry_t ),
 		     internal_property_set->byte_order,
 		     &section_header_offset,
 		     error ) != 1 )
@@ -494,31 +492,30 @@ int libolecf_property_set_read(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read property section list entry: %d.",
+			 "%s: unable to read property section list entry: %" PRIu16 ".",
 			 function,
 			 section_index );
 
 			goto on_error;
 		}
-		if( libolecf_stream_get_offset(
-		     property_set_stream,
-		     &section_list_entry_offset,
-		     error ) == -1 )
+		list_entry_data_offset += sizeof( olecf_property_section_list_entry_t );
+
+		if( (size_t) section_header_offset >= data_size )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_SEEK_FAILED,
-			 "%s: unable to retrieve property section list entry offset.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid section header offset value out of bounds.",
 			 function );
 
 			goto on_error;
 		}
-		if( libolecf_property_section_read(
+		if( libolecf_property_section_read_data(
 		     (libolecf_internal_property_section_t *) property_section,
 		     io_handle,
-		     property_set_stream,
-		     section_header_offset,
+		     &( data[ section_header_offset ] ),
+		     data_size - (size_t) section_header_offset,
 		     internal_property_set->byte_order,
 		     error ) != 1 )
 		{
@@ -526,7 +523,7 @@ int libolecf_property_set_read(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read property section: %d at offset: %" PRIu32 ".",
+			 "%s: unable to read property section: %" PRIu16 " at offset: %" PRIu32 ".",
 			 function,
 			 section_index,
 			 section_header_offset );
@@ -543,7 +540,7 @@ int libolecf_property_set_read(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append property section: %d to sections array.",
+			 "%s: unable to append property section: %" PRIu16 " to sections array.",
 			 function,
 			 section_index );
 
@@ -556,13 +553,174 @@ int libolecf_property_set_read(
 on_error:
 	if( property_section != NULL )
 	{
-		libolecf_property_section_free(
-		 &property_section,
+		libolecf_internal_property_section_free(
+		 (libolecf_internal_property_section_t **) &property_section,
 		 NULL );
 	}
 	return( -1 );
 }
 
+/* Reads the property set from the property set stream
+ * The property set references a view of the stream data in the memory mapped file
+ * if available, otherwise the stream data is read in a single read into a buffer
+ * The property set retains the stream data since the property values are read on demand,
+ * hence when the file is memory mapped the property set must be freed before the file is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_property_set_read(
+     libolecf_property_set_t *property_set,
+     libolecf_io_handle_t *io_handle,
+     libolecf_item_t *property_set_stream,
+     libcerror_error_t **error )
+{
+	libolecf_internal_property_set_t *internal_property_set = NULL;
+	const uint8_t *data                                     = NULL;
+	uint8_t *stream_data                                    = NULL;
+	static char *function                                   = "libolecf_property_set_read";
+	size_t data_view_size                                   = 0;
+	ssize_t read_count                                      = 0;
+	uint32_t stream_size                                    = 0;
+	int result                                              = 0;
+
+	if( property_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property_set = (libolecf_internal_property_set_t *) property_set;
+
+	if( internal_property_set->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid property set - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libolecf_item_get_size(
+	     property_set_stream,
+	     &stream_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property set stream size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( (size_t) stream_size < sizeof( olecf_property_set_header_t ) )
+	 || ( (size_t) stream_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid property set stream size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	result = libolecf_stream_get_data_view_at_offset(
+	          property_set_stream,
+	          0,
+	          &data,
+	          &data_view_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property set stream data view.",
+		 function );
+
+		goto on_error;
+	}
+	else if( ( result == 0 )
+	      || ( data_view_size < (size_t) stream_size ) )
+	{
+		stream_data = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * (size_t) stream_size );
+
+		if( stream_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create property set stream data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libolecf_stream_read_buffer_at_offset_without_seek(
+		              property_set_stream,
+		              stream_data,
+		              (size_t) stream_size,
+		              0,
+		              error );
+
+		if( read_count != (ssize_t) stream_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read property set stream data.",
+			 function );
+
+			goto on_error;
+		}
+		data = stream_data;
+
+		internal_property_set->stream_data = stream_data;
+
+		stream_data = NULL;
+	}
+	internal_property_set->data      = data;
+	internal_property_set->data_size = (size_t) stream_size;
+
+	if( libolecf_property_set_read_data(
+	     internal_property_set,
+	     io_handle,
+	     internal_property_set->data,
+	     internal_property_set->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property set.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( stream_data != NULL )
+	{
+		memory_free(
+		 stream_data );
+	}
+	return( -1 );
+}
+
 /* Retrieves the class identifier
  * The identifier is a GUID and is 16 bytes of size
  * Returns 1 if successful or -1 on error
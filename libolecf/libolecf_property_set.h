@@ -62,6 +62,20 @@ struct libolecf_internal_property_set
 	/* The sections array
 	 */
 	libcdata_array_t *sections;
+
+	/* The property set stream data, which references either the memory mapped file
+	 * or the stream data buffer
+	 */
+	const uint8_t *data;
+
+	/* The property set stream data size
+	 */
+	size_t data_size;
+
+	/* The property set stream data buffer, which is only used when no view
+	 * of the stream data in the memory mapped file is available
+	 */
+	uint8_t *stream_data;
 };
 
 int libolecf_property_set_initialize(
@@ -79,6 +93,13 @@ int libolecf_property_set_read_header_data(
      size_t data_size,
      libcerror_error_t **error );
 
+int libolecf_property_set_read_data(
+     libolecf_internal_property_set_t *internal_property_set,
+     libolecf_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int libolecf_property_set_read(
      libolecf_property_set_t *property_set,
      libolecf_io_handle_t *io_handle,
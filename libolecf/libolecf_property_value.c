@@ -25,13 +25,12 @@
 #include <types.h>
 
 #include "libolecf_definitions.h"
-#include "libolecf_io_handle.h"
 #include "libolecf_libcerror.h"
 #include "libolecf_libcnotify.h"
+#include "libolecf_libcthreads.h"
 #include "libolecf_libfvalue.h"
 #include "libolecf_ole.h"
 #include "libolecf_property_value.h"
-#include "libolecf_stream.h"
 #include "libolecf_types.h"
 
 #include "olecf_property_set.h"
@@ -97,6 +96,21 @@ int libolecf_property_value_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_property_value->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	*property_value = (libolecf_property_value_t *) internal_property_value;
 
 	return( 1 );
@@ -178,6 +192,21 @@ int libolecf_internal_property_value_free(
 				result = -1;
 			}
 		}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *internal_property_value )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 *internal_property_value );
 
@@ -186,22 +215,21 @@ int libolecf_internal_property_value_free(
         return( result );
 }
 
-/* Reads the property value data from the property set stream
+/* Reads the property value data
+ * The data starts with the value type and is bounded by the end of the property set stream data
  * Returns 1 if successful or -1 on error
  */
 int libolecf_property_value_read_data(
      libolecf_internal_property_value_t *internal_property_value,
-     libolecf_item_t *property_set_stream,
-     libolecf_io_handle_t *io_handle,
-     uint32_t property_data_offset,
+     const uint8_t *data,
+     size_t data_size,
      uint8_t byte_order,
+     int ascii_codepage,
      libcerror_error_t **error )
 {
-	uint8_t property_value_buffer[ 4 ];
-
-	uint8_t *data                  = NULL;
+	uint8_t *value_data            = NULL;
 	static char *function          = "libolecf_property_value_read_data";
-	ssize_t read_count             = 0;
+	size_t data_offset             = 0;
 	uint32_t aligment_padding_size = 0;
 	uint32_t number_of_values      = 0;
 	uint32_t read_size             = 0;
@@ -227,87 +255,52 @@ int libolecf_property_value_read_data(
 
 		return( -1 );
 	}
-	if( property_set_stream == NULL )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid property set stream.",
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
-	if( io_handle == NULL )
+	if( data_size < 4 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( byte_order != LIBOLECF_ENDIAN_BIG )
-	 && ( byte_order != LIBOLECF_ENDIAN_LITTLE ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported byte order: 0x%02" PRIx8 ".",
-		 function,
-		 byte_order );
-
-		return( -1 );
-	}
-	if( property_data_offset >= (uint32_t) ( UINT32_MAX - 4 ) )
+	if( data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid property data offset value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( libolecf_stream_seek_offset(
-	     property_set_stream,
-	     (off64_t) property_data_offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	if( ( byte_order != LIBOLECF_ENDIAN_BIG )
+	 && ( byte_order != LIBOLECF_ENDIAN_LITTLE ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek data at offset: %" PRIu32 ".",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order: 0x%02" PRIx8 ".",
 		 function,
-		 property_data_offset );
-
-		goto on_error;
-	}
-	read_count = libolecf_stream_read_buffer(
-		      property_set_stream,
-		      property_value_buffer,
-		      4,
-		      error );
-
-	if( read_count != (ssize_t) 4 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read type.",
-		 function );
+		 byte_order );
 
-		goto on_error;
+		return( -1 );
 	}
-	property_data_offset += 4;
-
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -315,7 +308,7 @@ int libolecf_property_value_read_data(
 		 "%s: type data:\n",
 		 function );
 		libcnotify_print_data(
-		 property_value_buffer,
+		 data,
 		 4,
 		 0 );
 	}
@@ -323,15 +316,17 @@ int libolecf_property_value_read_data(
 	if( byte_order == LIBOLECF_ENDIAN_LITTLE )
 	{
 		byte_stream_copy_to_uint32_little_endian(
-		 property_value_buffer,
+		 data,
 		 internal_property_value->value_type );
 	}
 	else if( byte_order == LIBOLECF_ENDIAN_BIG )
 	{
 		byte_stream_copy_to_uint32_big_endian(
-		 property_value_buffer,
+		 data,
 		 internal_property_value->value_type );
 	}
+	data_offset = 4;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -416,7 +411,7 @@ int libolecf_property_value_read_data(
 
 		case LIBOLECF_VALUE_TYPE_STRING_ASCII:
 			value_type       = LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM;
-			value_encoding   = io_handle->ascii_codepage;
+			value_encoding   = ascii_codepage;
 			is_variable_size = 1;
 			break;
 
@@ -478,36 +473,17 @@ int libolecf_property_value_read_data(
 /* TODO handle multi values */
 	if( is_multi_value != 0 )
 	{
-		if( property_data_offset >= (uint32_t) ( UINT32_MAX - 4 ) )
+		if( data_offset > ( data_size - 4 ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid property data offset value out of bounds.",
+			 "%s: invalid data offset value out of bounds.",
 			 function );
 
 			goto on_error;
 		}
-		read_count = libolecf_stream_read_buffer(
-			      property_set_stream,
-			      property_value_buffer,
-			      4,
-			      error );
-
-		if( read_count != (ssize_t) 4 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read data size.",
-			 function );
-
-			goto on_error;
-		}
-		property_data_offset += 4;
-
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -515,7 +491,7 @@ int libolecf_property_value_read_data(
 			 "%s: number of values data:\n",
 			 function );
 			libcnotify_print_data(
-			 property_value_buffer,
+			 &( data[ data_offset ] ),
 			 4,
 			 0 );
 		}
@@ -523,15 +499,17 @@ int libolecf_property_value_read_data(
 		if( byte_order == LIBOLECF_ENDIAN_LITTLE )
 		{
 			byte_stream_copy_to_uint32_little_endian(
-			 property_value_buffer,
+			 &( data[ data_offset ] ),
 			 number_of_values );
 		}
 		else if( byte_order == LIBOLECF_ENDIAN_BIG )
 		{
 			byte_stream_copy_to_uint32_big_endian(
-			 property_value_buffer,
+			 &( data[ data_offset ] ),
 			 number_of_values );
 		}
+		data_offset += 4;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -546,36 +524,17 @@ int libolecf_property_value_read_data(
 		     value_index++ )
 		{
 /* TODO handle different types of multi values differently */
-			if( property_data_offset >= (uint32_t) ( UINT32_MAX - 4 ) )
+			if( data_offset > ( data_size - 4 ) )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid property data offset value out of bounds.",
-				 function );
-
-				goto on_error;
-			}
-			read_count = libolecf_stream_read_buffer(
-				      property_set_stream,
-				      property_value_buffer,
-				      4,
-				      error );
-
-			if( read_count != (ssize_t) 4 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read data size.",
+				 "%s: invalid data offset value out of bounds.",
 				 function );
 
 				goto on_error;
 			}
-			property_data_offset += 4;
-
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
@@ -584,7 +543,7 @@ int libolecf_property_value_read_data(
 				 function,
 				 value_index );
 				libcnotify_print_data(
-				 property_value_buffer,
+				 &( data[ data_offset ] ),
 				 4,
 				 0 );
 			}
@@ -592,15 +551,17 @@ int libolecf_property_value_read_data(
 			if( byte_order == LIBOLECF_ENDIAN_LITTLE )
 			{
 				byte_stream_copy_to_uint32_little_endian(
-				 property_value_buffer,
+				 &( data[ data_offset ] ),
 				 value_data_size );
 			}
 			else if( byte_order == LIBOLECF_ENDIAN_BIG )
 			{
 				byte_stream_copy_to_uint32_big_endian(
-				 property_value_buffer,
+				 &( data[ data_offset ] ),
 				 value_data_size );
 			}
+			data_offset += 4;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
@@ -611,22 +572,11 @@ int libolecf_property_value_read_data(
 				 value_data_size );
 			}
 #endif
-			if( property_data_offset >= (uint32_t) ( UINT32_MAX - value_data_size ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid property data offset value out of bounds.",
-				 function );
-
-				goto on_error;
-			}
 /* TODO
 			if( ( internal_property_value->value_type == LIBOLECF_VALUE_TYPE_MULTI_VALUE_STRING_ASCII )
 			 || ( internal_property_value->value_type == LIBOLECF_VALUE_TYPE_MULTI_VALUE_STRING_UNICODE ) )
 			{
-				value_data_end_offset = property_data_offset + value_data_size;
+				value_data_end_offset = data_offset + value_data_size;
 				aligment_padding_size = value_data_end_offset % 16;
 
 				if( aligment_padding_size != 0 )
@@ -642,7 +592,7 @@ int libolecf_property_value_read_data(
 			read_size = value_data_size + aligment_padding_size;
 
 			if( ( read_size == 0 )
-			 || ( read_size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+			 || ( (size_t) read_size > ( data_size - data_offset ) ) )
 			{
 				libcerror_error_set(
 				 error,
@@ -653,37 +603,6 @@ int libolecf_property_value_read_data(
 
 				goto on_error;
 			}
-			data = (uint8_t *) memory_allocate(
-			                    sizeof( uint8_t ) * read_size );
-
-			if( data == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create data.",
-				 function );
-
-				goto on_error;
-			}
-			read_count = libolecf_stream_read_buffer(
-				      property_set_stream,
-				      data,
-				      (size_t) read_size,
-				      error );
-
-			if( read_count != (ssize_t) read_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read data.",
-				 function );
-
-				goto on_error;
-			}
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
@@ -692,7 +611,7 @@ int libolecf_property_value_read_data(
 				 function,
 				 value_index );
 				libcnotify_print_data(
-				 data,
+				 &( data[ data_offset ] ),
 				 (size_t) value_data_size,
 				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 
@@ -703,36 +622,27 @@ int libolecf_property_value_read_data(
 					 function,
 					 value_index );
 					libcnotify_print_data(
-					 &( data[ value_data_size ] ),
+					 &( data[ data_offset + value_data_size ] ),
 					 (size_t) aligment_padding_size,
 					 0 );
 				}
 			}
 #endif
 /* TODO set up multi value */
-			memory_free(
-			 data );
-
-			data = NULL;
+			data_offset += read_size;
 		}
 	}
 	else if( value_type != LIBFVALUE_VALUE_TYPE_UNDEFINED )
 	{
 		if( is_variable_size != 0 )
 		{
-			read_count = libolecf_stream_read_buffer(
-				      property_set_stream,
-				      property_value_buffer,
-				      4,
-				      error );
-
-			if( read_count != (ssize_t) 4 )
+			if( data_offset > ( data_size - 4 ) )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read data size.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid data offset value out of bounds.",
 				 function );
 
 				goto on_error;
@@ -744,7 +654,7 @@ int libolecf_property_value_read_data(
 				 "%s: data size data:\n",
 				 function );
 				libcnotify_print_data(
-				 property_value_buffer,
+				 &( data[ data_offset ] ),
 				 4,
 				 0 );
 			}
@@ -752,15 +662,16 @@ int libolecf_property_value_read_data(
 			if( byte_order == LIBOLECF_ENDIAN_LITTLE )
 			{
 				byte_stream_copy_to_uint32_little_endian(
-				 property_value_buffer,
+				 &( data[ data_offset ] ),
 				 value_data_size );
 			}
 			else if( byte_order == LIBOLECF_ENDIAN_BIG )
 			{
 				byte_stream_copy_to_uint32_big_endian(
-				 property_value_buffer,
+				 &( data[ data_offset ] ),
 				 value_data_size );
 			}
+			data_offset += 4;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -775,9 +686,20 @@ int libolecf_property_value_read_data(
 		{
 			if( internal_property_value->value_type == LIBOLECF_VALUE_TYPE_STRING_UNICODE )
 			{
+				if( value_data_size > ( (uint32_t) UINT32_MAX / 2 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid value data size value out of bounds.",
+					 function );
+
+					goto on_error;
+				}
 				value_data_size *= 2;
 			}
-			if( ( value_data_size == 0 )
+			if( ( (size_t) value_data_size > ( data_size - data_offset ) )
 			 || ( value_data_size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 			{
 				libcerror_error_set(
@@ -789,37 +711,6 @@ int libolecf_property_value_read_data(
 
 				goto on_error;
 			}
-			data = (uint8_t *) memory_allocate(
-			                    sizeof( uint8_t ) * value_data_size );
-
-			if( data == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create data.",
-				 function );
-
-				goto on_error;
-			}
-			read_count = libolecf_stream_read_buffer(
-				      property_set_stream,
-				      data,
-				      (size_t) value_data_size,
-				      error );
-
-			if( read_count != (ssize_t) value_data_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read data.",
-				 function );
-
-				goto on_error;
-			}
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
@@ -827,7 +718,7 @@ int libolecf_property_value_read_data(
 				 "%s: data:\n",
 				 function );
 				libcnotify_print_data(
-				 data,
+				 &( data[ data_offset ] ),
 				 (size_t) value_data_size,
 				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 			}
@@ -840,7 +731,7 @@ int libolecf_property_value_read_data(
 				     string_size < value_data_size;
 				     string_size++ )
 				{
-					if( data[ string_size ] == 0 )
+					if( data[ data_offset + string_size ] == 0 )
 					{
 						string_size++;
 
@@ -855,8 +746,8 @@ int libolecf_property_value_read_data(
 				     string_size < value_data_size;
 				     string_size += 2 )
 				{
-					if( ( data[ string_size ] == 0 )
-					 && ( data[ string_size + 1 ] == 0 ) )
+					if( ( data[ data_offset + string_size ] == 0 )
+					 && ( data[ data_offset + string_size + 1 ] == 0 ) )
 					{
 						string_size += 2;
 
@@ -865,6 +756,34 @@ int libolecf_property_value_read_data(
 				}
 				value_data_size = string_size;
 			}
+			value_data = (uint8_t *) memory_allocate(
+			                          sizeof( uint8_t ) * value_data_size );
+
+			if( value_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create value data.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     value_data,
+			     &( data[ data_offset ] ),
+			     (size_t) value_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy value data.",
+				 function );
+
+				goto on_error;
+			}
 		}
 		if( libfvalue_value_type_initialize(
 		     &( internal_property_value->data_value ),
@@ -884,7 +803,7 @@ int libolecf_property_value_read_data(
 		{
 			if( libfvalue_value_set_data(
 			     internal_property_value->data_value,
-			     data,
+			     value_data,
 			     (size_t) value_data_size,
 			     value_encoding,
 			     LIBFVALUE_VALUE_DATA_FLAG_MANAGED | LIBFVALUE_VALUE_DATA_FLAG_CLONE_BY_REFERENCE,
@@ -899,7 +818,7 @@ int libolecf_property_value_read_data(
 
 				goto on_error;
 			}
-			data = NULL;
+			value_data = NULL;
 		}
 	}
 	return( 1 );
@@ -911,28 +830,107 @@ on_error:
 		 &( internal_property_value->data_value ),
 		 NULL );
 	}
-	if( data != NULL )
+	if( value_data != NULL )
 	{
 		memory_free(
-		 data );
+		 value_data );
 	}
 	return( -1 );
 }
 
-/* Reads the property value list entry from the property set stream
+/* Reads the property value data if it was not read before
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_internal_property_value_read_value(
+     libolecf_internal_property_value_t *internal_property_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_internal_property_value_read_value";
+	int result            = 1;
+
+	if( internal_property_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_property_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_property_value->data_is_read == 0 )
+	 && ( internal_property_value->data != NULL ) )
+	{
+		result = libolecf_property_value_read_data(
+		          internal_property_value,
+		          internal_property_value->data,
+		          internal_property_value->data_size,
+		          internal_property_value->byte_order,
+		          internal_property_value->ascii_codepage,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read property value data.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			internal_property_value->data_is_read = 1;
+		}
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_property_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads the property value list entry
  * Returns 1 if successful or -1 on error
  */
-int libolecf_property_value_read_list_entry(
+int libolecf_property_value_read_list_entry_data(
      libolecf_internal_property_value_t *internal_property_value,
-     libolecf_item_t *property_set_stream,
+     const uint8_t *data,
+     size_t data_size,
      uint8_t byte_order,
      uint32_t *property_data_offset,
      libcerror_error_t **error )
 {
-	olecf_property_set_property_list_entry_t property_list_entry;
-
-	static char *function = "libolecf_property_value_read_list_entry";
-	ssize_t read_count    = 0;
+	static char *function = "libolecf_property_value_read_list_entry_data";
 
 	if( internal_property_value == NULL )
 	{
@@ -945,6 +943,39 @@ int libolecf_property_value_read_list_entry(
 
 		return( -1 );
 	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < sizeof( olecf_property_set_property_list_entry_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( byte_order != LIBOLECF_ENDIAN_BIG )
 	 && ( byte_order != LIBOLECF_ENDIAN_LITTLE ) )
 	{
@@ -969,23 +1000,6 @@ int libolecf_property_value_read_list_entry(
 
 		return( -1 );
 	}
-	read_count = libolecf_stream_read_buffer(
-		      property_set_stream,
-		      (uint8_t *) &property_list_entry,
-		      sizeof( olecf_property_set_property_list_entry_t ),
-		      error );
-
-	if( read_count != (ssize_t) sizeof( olecf_property_set_property_list_entry_t ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read list entry.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -993,7 +1007,7 @@ int libolecf_property_value_read_list_entry(
 		 "%s: list entry data:\n",
 		 function );
 		libcnotify_print_data(
-		 (uint8_t *) &property_list_entry,
+		 data,
 		 sizeof( olecf_property_set_property_list_entry_t ),
 		 0 );
 	}
@@ -1001,21 +1015,21 @@ int libolecf_property_value_read_list_entry(
 	if( byte_order == LIBOLECF_ENDIAN_LITTLE )
 	{
 		byte_stream_copy_to_uint32_little_endian(
-		 property_list_entry.identifier,
+		 ( (olecf_property_set_property_list_entry_t *) data )->identifier,
 		 internal_property_value->identifier );
 
 		byte_stream_copy_to_uint32_little_endian(
-		 property_list_entry.offset,
+		 ( (olecf_property_set_property_list_entry_t *) data )->offset,
 		 *property_data_offset );
 	}
 	else if( byte_order == LIBOLECF_ENDIAN_BIG )
 	{
 		byte_stream_copy_to_uint32_big_endian(
-		 property_list_entry.identifier,
+		 ( (olecf_property_set_property_list_entry_t *) data )->identifier,
 		 internal_property_value->identifier );
 
 		byte_stream_copy_to_uint32_big_endian(
-		 property_list_entry.offset,
+		 ( (olecf_property_set_property_list_entry_t *) data )->offset,
 		 *property_data_offset );
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -1079,6 +1093,8 @@ int libolecf_property_value_get_identifier(
 }
 
 /* Retrieves the value type
+ * The value type is read from the 4-byte header of the property value data
+ * without reading the rest of the property value data
  * Returns 1 if successful or -1 on error
  */
 int libolecf_property_value_get_value_type(
@@ -1113,8 +1129,50 @@ int libolecf_property_value_get_value_type(
 
 		return( -1 );
 	}
-	*value_type = internal_property_value->value_type;
+	/* The property value data and byte order are not changed after the property value
+	 * was created, hence the read/write lock is not needed
+	 */
+	if( internal_property_value->data == NULL )
+	{
+		*value_type = internal_property_value->value_type;
 
+		return( 1 );
+	}
+	if( internal_property_value->data_size < 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid property value - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_property_value->byte_order == LIBOLECF_ENDIAN_LITTLE )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 internal_property_value->data,
+		 *value_type );
+	}
+	else if( internal_property_value->byte_order == LIBOLECF_ENDIAN_BIG )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 internal_property_value->data,
+		 *value_type );
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid property value - unsupported byte order: 0x%02" PRIx8 ".",
+		 function,
+		 internal_property_value->byte_order );
+
+		return( -1 );
+	}
 	return( 1 );
 }
 
@@ -1142,6 +1200,19 @@ int libolecf_property_value_get_data_size(
 	}
 	internal_property_value = (libolecf_internal_property_value_t *) property_value;
 
+	if( libolecf_internal_property_value_read_value(
+	     internal_property_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property value.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfvalue_value_get_data_size(
 	     internal_property_value->data_value,
 	     data_size,
@@ -1184,6 +1255,19 @@ int libolecf_property_value_get_data(
 	}
 	internal_property_value = (libolecf_internal_property_value_t *) property_value;
 
+	if( libolecf_internal_property_value_read_value(
+	     internal_property_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property value.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfvalue_value_copy_data(
 	     internal_property_value->data_value,
 	     data,
@@ -1226,6 +1310,19 @@ int libolecf_property_value_get_data_as_boolean(
 	}
 	internal_property_value = (libolecf_internal_property_value_t *) property_value;
 
+	if( libolecf_internal_property_value_read_value(
+	     internal_property_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property value.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_BOOLEAN )
 	{
 		libcerror_error_set(
@@ -1282,6 +1379,19 @@ int libolecf_property_value_get_data_as_16bit_integer(
 	}
 	internal_property_value = (libolecf_internal_property_value_t *) property_value;
 
+	if( libolecf_internal_property_value_read_value(
+	     internal_property_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property value.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_INTEGER_16BIT_SIGNED )
 	 && ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_INTEGER_16BIT_UNSIGNED ) )
 	{
@@ -1337,6 +1447,19 @@ int libolecf_property_value_get_data_as_32bit_integer(
 	}
 	internal_property_value = (libolecf_internal_property_value_t *) property_value;
 
+	if( libolecf_internal_property_value_read_value(
+	     internal_property_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property value.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_INTEGER_32BIT_SIGNED )
 	 && ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_INTEGER_32BIT_UNSIGNED ) )
 	{
@@ -1392,6 +1515,19 @@ int libolecf_property_value_get_data_as_64bit_integer(
 	}
 	internal_property_value = (libolecf_internal_property_value_t *) property_value;
 
+	if( libolecf_internal_property_value_read_value(
+	     internal_property_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property value.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_INTEGER_64BIT_SIGNED )
 	 && ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_INTEGER_64BIT_UNSIGNED ) )
 	{
@@ -1447,6 +1583,19 @@ int libolecf_property_value_get_data_as_filetime(
 	}
 	internal_property_value = (libolecf_internal_property_value_t *) property_value;
 
+	if( libolecf_internal_property_value_read_value(
+	     internal_property_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property value.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_FILETIME )
 	{
 		libcerror_error_set(
@@ -1502,6 +1651,19 @@ int libolecf_property_value_get_data_as_utf8_string_size(
 	}
 	internal_property_value = (libolecf_internal_property_value_t *) property_value;
 
+	if( libolecf_internal_property_value_read_value(
+	     internal_property_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property value.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_STRING_ASCII )
 	 && ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_STRING_UNICODE ) )
 	{
@@ -1560,6 +1722,19 @@ int libolecf_property_value_get_data_as_utf8_string(
 	}
 	internal_property_value = (libolecf_internal_property_value_t *) property_value;
 
+	if( libolecf_internal_property_value_read_value(
+	     internal_property_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property value.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_STRING_ASCII )
 	 && ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_STRING_UNICODE ) )
 	{
@@ -1617,6 +1792,19 @@ int libolecf_property_value_get_data_as_utf16_string_size(
 	}
 	internal_property_value = (libolecf_internal_property_value_t *) property_value;
 
+	if( libolecf_internal_property_value_read_value(
+	     internal_property_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property value.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_STRING_ASCII )
 	 && ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_STRING_UNICODE ) )
 	{
@@ -1675,6 +1863,19 @@ int libolecf_property_value_get_data_as_utf16_string(
 	}
 	internal_property_value = (libolecf_internal_property_value_t *) property_value;
 
+	if( libolecf_internal_property_value_read_value(
+	     internal_property_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property value.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_STRING_ASCII )
 	 && ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_STRING_UNICODE ) )
 	{
@@ -1735,6 +1936,19 @@ int libolecf_property_value_get_value_data_size(
 	}
 	internal_property_value = (libolecf_internal_property_value_t *) property_value;
 
+	if( libolecf_internal_property_value_read_value(
+	     internal_property_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property value.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfvalue_value_get_data_size(
 	     internal_property_value->data_value,
 	     data_size,
@@ -1777,6 +1991,19 @@ int libolecf_property_value_get_value_data(
 	}
 	internal_property_value = (libolecf_internal_property_value_t *) property_value;
 
+	if( libolecf_internal_property_value_read_value(
+	     internal_property_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property value.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfvalue_value_copy_data(
 	     internal_property_value->data_value,
 	     value_data,
@@ -1819,6 +2046,19 @@ int libolecf_property_value_get_value_boolean(
 	}
 	internal_property_value = (libolecf_internal_property_value_t *) property_value;
 
+	if( libolecf_internal_property_value_read_value(
+	     internal_property_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property value.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_BOOLEAN )
 	{
 		libcerror_error_set(
@@ -1875,6 +2115,19 @@ int libolecf_property_value_get_value_16bit(
 	}
 	internal_property_value = (libolecf_internal_property_value_t *) property_value;
 
+	if( libolecf_internal_property_value_read_value(
+	     internal_property_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property value.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_INTEGER_16BIT_SIGNED )
 	 && ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_INTEGER_16BIT_UNSIGNED ) )
 	{
@@ -1930,6 +2183,19 @@ int libolecf_property_value_get_value_32bit(
 	}
 	internal_property_value = (libolecf_internal_property_value_t *) property_value;
 
+	if( libolecf_internal_property_value_read_value(
+	     internal_property_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property value.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_INTEGER_32BIT_SIGNED )
 	 && ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_INTEGER_32BIT_UNSIGNED ) )
 	{
@@ -1985,6 +2251,19 @@ int libolecf_property_value_get_value_64bit(
 	}
 	internal_property_value = (libolecf_internal_property_value_t *) property_value;
 
+	if( libolecf_internal_property_value_read_value(
+	     internal_property_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property value.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_INTEGER_64BIT_SIGNED )
 	 && ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_INTEGER_64BIT_UNSIGNED ) )
 	{
@@ -2040,6 +2319,19 @@ int libolecf_property_value_get_value_filetime(
 	}
 	internal_property_value = (libolecf_internal_property_value_t *) property_value;
 
+	if( libolecf_internal_property_value_read_value(
+	     internal_property_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property value.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_FILETIME )
 	{
 		libcerror_error_set(
@@ -2095,6 +2387,19 @@ int libolecf_property_value_get_value_utf8_string_size(
 	}
 	internal_property_value = (libolecf_internal_property_value_t *) property_value;
 
+	if( libolecf_internal_property_value_read_value(
+	     internal_property_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property value.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_STRING_ASCII )
 	 && ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_STRING_UNICODE ) )
 	{
@@ -2153,6 +2458,19 @@ int libolecf_property_value_get_value_utf8_string(
 	}
 	internal_property_value = (libolecf_internal_property_value_t *) property_value;
 
+	if( libolecf_internal_property_value_read_value(
+	     internal_property_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property value.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_STRING_ASCII )
 	 && ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_STRING_UNICODE ) )
 	{
@@ -2210,6 +2528,19 @@ int libolecf_property_value_get_value_utf16_string_size(
 	}
 	internal_property_value = (libolecf_internal_property_value_t *) property_value;
 
+	if( libolecf_internal_property_value_read_value(
+	     internal_property_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property value.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_STRING_ASCII )
 	 && ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_STRING_UNICODE ) )
 	{
@@ -2268,6 +2599,19 @@ int libolecf_property_value_get_value_utf16_string(
 	}
 	internal_property_value = (libolecf_internal_property_value_t *) property_value;
 
+	if( libolecf_internal_property_value_read_value(
+	     internal_property_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property value.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_STRING_ASCII )
 	 && ( internal_property_value->value_type != LIBOLECF_VALUE_TYPE_STRING_UNICODE ) )
 	{
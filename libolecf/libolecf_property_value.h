@@ -26,8 +26,8 @@
 #include <types.h>
 
 #include "libolecf_extern.h"
-#include "libolecf_io_handle.h"
 #include "libolecf_libcerror.h"
+#include "libolecf_libcthreads.h"
 #include "libolecf_libfvalue.h"
 #include "libolecf_types.h"
 
@@ -50,6 +50,33 @@ struct libolecf_internal_property_value
 	/* The data value
 	 */
 	libfvalue_value_t *data_value;
+
+	/* The property value data, which starts with the value type
+	 * and references the property set stream data
+	 */
+	const uint8_t *data;
+
+	/* The property value data size
+	 */
+	size_t data_size;
+
+	/* The byte order
+	 */
+	uint8_t byte_order;
+
+	/* The ASCII codepage
+	 */
+	int ascii_codepage;
+
+	/* Value to indicate the property value data was read
+	 */
+	uint8_t data_is_read;
+
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libolecf_property_value_initialize(
@@ -67,15 +94,20 @@ int libolecf_internal_property_value_free(
 
 int libolecf_property_value_read_data(
      libolecf_internal_property_value_t *internal_property_value,
-     libolecf_item_t *property_set_stream,
-     libolecf_io_handle_t *io_handle,
-     uint32_t property_data_offset,
+     const uint8_t *data,
+     size_t data_size,
      uint8_t byte_order,
+     int ascii_codepage,
      libcerror_error_t **error );
 
-int libolecf_property_value_read_list_entry(
+int libolecf_internal_property_value_read_value(
      libolecf_internal_property_value_t *internal_property_value,
-     libolecf_item_t *property_set_stream,
+     libcerror_error_t **error );
+
+int libolecf_property_value_read_list_entry_data(
+     libolecf_internal_property_value_t *internal_property_value,
+     const uint8_t *data,
+     size_t data_size,
      uint8_t byte_order,
      uint32_t *property_data_offset,
      libcerror_error_t **error );
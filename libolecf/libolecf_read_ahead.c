@@ -0,0 +1,571 @@
+/*
+ * Read-ahead functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if !defined( WINAPI )
+#if defined( HAVE_SYS_TYPES_H )
+#include <sys/types.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#endif /* !defined( WINAPI ) */
+
+#include "libolecf_definitions.h"
+#include "libolecf_libbfio.h"
+#include "libolecf_libcerror.h"
+#include "libolecf_read_ahead.h"
+
+/* Creates a read-ahead
+ * Make sure the value read_ahead is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_read_ahead_initialize(
+     libolecf_read_ahead_t **read_ahead,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_read_ahead_initialize";
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_ahead != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read-ahead value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*read_ahead = memory_allocate_structure(
+	               libolecf_read_ahead_t );
+
+	if( *read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read-ahead.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_ahead,
+	     0,
+	     sizeof( libolecf_read_ahead_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read-ahead.",
+		 function );
+
+		memory_free(
+		 *read_ahead );
+
+		*read_ahead = NULL;
+
+		return( -1 );
+	}
+	( *read_ahead )->file_descriptor = -1;
+
+	return( 1 );
+
+on_error:
+	if( *read_ahead != NULL )
+	{
+		memory_free(
+		 *read_ahead );
+
+		*read_ahead = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a read-ahead
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_read_ahead_free(
+     libolecf_read_ahead_t **read_ahead,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_read_ahead_free";
+	int result            = 1;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_ahead != NULL )
+	{
+		if( libolecf_read_ahead_close(
+		     *read_ahead,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close read-ahead.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *read_ahead );
+
+		*read_ahead = NULL;
+	}
+	return( result );
+}
+
+#if !defined( WINAPI ) && defined( HAVE_POSIX_FADVISE )
+
+/* Determines if a file descriptor refers to the same file as the file IO handle
+ * The filename can be replaced between opening the file IO handle and the file descriptor
+ * hence the size and the header of both are compared
+ * Returns 1 if the same, 0 if not or -1 on error
+ */
+int libolecf_read_ahead_verify_file_descriptor(
+     int file_descriptor,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t descriptor_data[ LIBOLECF_READ_AHEAD_VERIFY_DATA_SIZE ];
+	uint8_t file_io_handle_data[ LIBOLECF_READ_AHEAD_VERIFY_DATA_SIZE ];
+
+	struct stat file_statistics;
+
+	static char *function = "libolecf_read_ahead_verify_file_descriptor";
+	size64_t file_size    = 0;
+	size_t read_size      = LIBOLECF_READ_AHEAD_VERIFY_DATA_SIZE;
+	ssize_t read_count    = 0;
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( fstat(
+	       file_descriptor,
+	       &file_statistics ) != 0 )
+	 || ( S_ISREG( file_statistics.st_mode ) == 0 )
+	 || ( file_statistics.st_size < 0 )
+	 || ( (size64_t) file_statistics.st_size != file_size ) )
+	{
+		return( 0 );
+	}
+	if( file_size < (size64_t) read_size )
+	{
+		read_size = (size_t) file_size;
+	}
+	if( read_size == 0 )
+	{
+		return( 1 );
+	}
+	read_count = pread(
+	              file_descriptor,
+	              descriptor_data,
+	              read_size,
+	              0 );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		return( 0 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              file_io_handle_data,
+	              read_size,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data from file IO handle at offset: 0 (0x00000000).",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     descriptor_data,
+	     file_io_handle_data,
+	     read_size ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+#endif /* !defined( WINAPI ) && defined( HAVE_POSIX_FADVISE ) */
+
+/* Opens a file descriptor used to advise the system about upcoming reads
+ * The descriptor shares the page cache with the file IO handle so data
+ * prefetched through it is available to subsequent reads
+ * The descriptor is only used if it refers to the same file as the open file IO handle
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libolecf_read_ahead_open(
+     libolecf_read_ahead_t *read_ahead,
+     const char *filename,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_read_ahead_open";
+
+#if !defined( WINAPI ) && defined( HAVE_POSIX_FADVISE )
+	int file_descriptor   = -1;
+	int open_flags        = O_RDONLY;
+	int result            = 0;
+#endif
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_ahead->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read-ahead - file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( WINAPI ) && defined( HAVE_POSIX_FADVISE )
+#if defined( O_CLOEXEC )
+	/* The descriptor is not inherited by child processes
+	 */
+	open_flags |= O_CLOEXEC;
+#endif
+	file_descriptor = open(
+	                   filename,
+	                   open_flags );
+
+	if( file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	result = libolecf_read_ahead_verify_file_descriptor(
+	          file_descriptor,
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify file descriptor.",
+		 function );
+
+		close(
+		 file_descriptor );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		close(
+		 file_descriptor );
+
+		return( 0 );
+	}
+	read_ahead->file_descriptor = file_descriptor;
+
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Closes the file descriptor
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_read_ahead_close(
+     libolecf_read_ahead_t *read_ahead,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_read_ahead_close";
+	int result            = 1;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_ahead->file_descriptor == -1 )
+	{
+		return( 1 );
+	}
+#if !defined( WINAPI ) && defined( HAVE_POSIX_FADVISE )
+	if( close(
+	     read_ahead->file_descriptor ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file descriptor.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	read_ahead->file_descriptor = -1;
+
+	return( result );
+}
+
+/* Advises the system that a range of the file will be read soon
+ * The system reads the range in the background
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libolecf_read_ahead_advise_file(
+     libolecf_read_ahead_t *read_ahead,
+     off64_t file_offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_read_ahead_advise_file";
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_ahead->file_descriptor == -1 )
+	 || ( size == 0 ) )
+	{
+		return( 0 );
+	}
+#if !defined( WINAPI ) && defined( HAVE_POSIX_FADVISE )
+	/* The advice is a hint, if the system rejects it the data is read on demand
+	 */
+	if( posix_fadvise(
+	     read_ahead->file_descriptor,
+	     (off_t) file_offset,
+	     (off_t) size,
+	     POSIX_FADV_WILLNEED ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Advises the system that a range of memory mapped data will be read soon
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libolecf_read_ahead_advise_memory(
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+#if !defined( WINAPI ) && defined( HAVE_MADVISE )
+	uint8_t *page_data    = NULL;
+	size_t page_offset    = 0;
+	long page_size        = 0;
+#endif
+	static char *function = "libolecf_read_ahead_advise_memory";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		return( 0 );
+	}
+#if !defined( WINAPI ) && defined( HAVE_MADVISE )
+	page_size = sysconf(
+	             _SC_PAGESIZE );
+
+	if( page_size <= 0 )
+	{
+		return( 0 );
+	}
+	/* The advised range must start on a page boundary
+	 */
+	page_offset = (size_t) ( (uintptr_t) data % (uintptr_t) page_size );
+	page_data   = (uint8_t *) ( data - page_offset );
+
+	if( madvise(
+	     (void *) page_data,
+	     data_size + page_offset,
+	     MADV_WILLNEED ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
@@ -0,0 +1,88 @@
+/*
+ * Read-ahead functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBOLECF_READ_AHEAD_H )
+#define _LIBOLECF_READ_AHEAD_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libolecf_libbfio.h"
+#include "libolecf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libolecf_read_ahead libolecf_read_ahead_t;
+
+struct libolecf_read_ahead
+{
+	/* The file descriptor used to advise the system
+	 * or -1 if not available
+	 */
+	int file_descriptor;
+};
+
+int libolecf_read_ahead_initialize(
+     libolecf_read_ahead_t **read_ahead,
+     libcerror_error_t **error );
+
+int libolecf_read_ahead_free(
+     libolecf_read_ahead_t **read_ahead,
+     libcerror_error_t **error );
+
+#if !defined( WINAPI ) && defined( HAVE_POSIX_FADVISE )
+
+int libolecf_read_ahead_verify_file_descriptor(
+     int file_descriptor,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#endif /* !defined( WINAPI ) && defined( HAVE_POSIX_FADVISE ) */
+
+int libolecf_read_ahead_open(
+     libolecf_read_ahead_t *read_ahead,
+     const char *filename,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libolecf_read_ahead_close(
+     libolecf_read_ahead_t *read_ahead,
+     libcerror_error_t **error );
+
+int libolecf_read_ahead_advise_file(
+     libolecf_read_ahead_t *read_ahead,
+     off64_t file_offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libolecf_read_ahead_advise_memory(
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBOLECF_READ_AHEAD_H ) */
+
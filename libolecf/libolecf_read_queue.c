@@ -0,0 +1,1356 @@
+/*
+ * Read queue functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libolecf_definitions.h"
+#include "libolecf_directory_entry.h"
+#include "libolecf_extent_map.h"
+#include "libolecf_io_handle.h"
+#include "libolecf_io_uring.h"
+#include "libolecf_item.h"
+#include "libolecf_libcerror.h"
+#include "libolecf_libcthreads.h"
+#include "libolecf_read_ahead.h"
+#include "libolecf_read_queue.h"
+#include "libolecf_stream.h"
+#include "libolecf_types.h"
+
+/* Creates a read queue
+ * Make sure the value read_queue is referencing, is set to NULL
+ * The system reads asynchronously if it supports io_uring
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_read_queue_initialize(
+     libolecf_read_queue_t **read_queue,
+     int maximum_number_of_requests,
+     libcerror_error_t **error )
+{
+	libolecf_internal_read_queue_t *internal_read_queue = NULL;
+	static char *function                               = "libolecf_read_queue_initialize";
+	int result                                          = 0;
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_requests <= 0 )
+	 || ( maximum_number_of_requests > LIBOLECF_MAXIMUM_NUMBER_OF_READ_QUEUE_REQUESTS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of requests value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_queue = memory_allocate_structure(
+	                       libolecf_internal_read_queue_t );
+
+	if( internal_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_read_queue,
+	     0,
+	     sizeof( libolecf_internal_read_queue_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read queue.",
+		 function );
+
+		memory_free(
+		 internal_read_queue );
+
+		return( -1 );
+	}
+	internal_read_queue->requests = (libolecf_read_queue_request_t *) memory_allocate(
+	                                                                   sizeof( libolecf_read_queue_request_t ) * maximum_number_of_requests );
+
+	if( internal_read_queue->requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create requests.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_read_queue->requests,
+	     0,
+	     sizeof( libolecf_read_queue_request_t ) * maximum_number_of_requests ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear requests.",
+		 function );
+
+		goto on_error;
+	}
+	internal_read_queue->maximum_number_of_requests = maximum_number_of_requests;
+
+	if( libolecf_io_uring_initialize(
+	     &( internal_read_queue->io_uring ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create io_uring.",
+		 function );
+
+		goto on_error;
+	}
+	/* Requests are read synchronously when the system does not support io_uring
+	 */
+	result = libolecf_io_uring_open(
+	          internal_read_queue->io_uring,
+	          (uint32_t) maximum_number_of_requests,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open io_uring.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libolecf_io_uring_free(
+		     &( internal_read_queue->io_uring ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free io_uring.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_read_queue->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*read_queue = (libolecf_read_queue_t *) internal_read_queue;
+
+	return( 1 );
+
+on_error:
+	if( internal_read_queue != NULL )
+	{
+		if( internal_read_queue->io_uring != NULL )
+		{
+			libolecf_io_uring_free(
+			 &( internal_read_queue->io_uring ),
+			 NULL );
+		}
+		if( internal_read_queue->requests != NULL )
+		{
+			memory_free(
+			 internal_read_queue->requests );
+		}
+		memory_free(
+		 internal_read_queue );
+	}
+	return( -1 );
+}
+
+/* Frees a read queue
+ * Waits for the asynchronous reads of requests that did not complete
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_read_queue_free(
+     libolecf_read_queue_t **read_queue,
+     libcerror_error_t **error )
+{
+	libolecf_internal_read_queue_t *internal_read_queue = NULL;
+	static char *function                               = "libolecf_read_queue_free";
+	int result                                          = 1;
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_queue != NULL )
+	{
+		internal_read_queue = (libolecf_internal_read_queue_t *) *read_queue;
+		*read_queue         = NULL;
+
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_read_queue->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( internal_read_queue->io_uring != NULL )
+		{
+			if( libolecf_io_uring_free(
+			     &( internal_read_queue->io_uring ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free io_uring.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 internal_read_queue->requests );
+
+		memory_free(
+		 internal_read_queue );
+	}
+	return( result );
+}
+
+/* Retrieves a completed asynchronous read and updates its request
+ * Returns 1 if successful, 0 if no asynchronous reads are outstanding or -1 on error
+ */
+int libolecf_internal_read_queue_process_completion(
+     libolecf_internal_read_queue_t *internal_read_queue,
+     libcerror_error_t **error )
+{
+	libolecf_read_queue_request_t *request = NULL;
+	intptr_t *user_data                    = NULL;
+	static char *function                  = "libolecf_internal_read_queue_process_completion";
+	int32_t read_result                    = 0;
+	int result                             = 0;
+
+	if( internal_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_read_queue->io_uring == NULL )
+	{
+		return( 0 );
+	}
+	result = libolecf_io_uring_get_completion(
+	          internal_read_queue->io_uring,
+	          &user_data,
+	          &read_result,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve completion.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	request = (libolecf_read_queue_request_t *) user_data;
+
+	if( request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing request.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_result < 0 )
+	{
+		if( request->system_error_code == 0 )
+		{
+			request->system_error_code = (uint32_t) -read_result;
+		}
+	}
+	else
+	{
+		request->read_count += (size_t) read_result;
+	}
+	request->number_of_pending_reads -= 1;
+
+	if( ( request->number_of_pending_reads == 0 )
+	 && ( request->state == LIBOLECF_READ_QUEUE_REQUEST_STATE_PENDING ) )
+	{
+		request->state = LIBOLECF_READ_QUEUE_REQUEST_STATE_COMPLETED;
+
+		internal_read_queue->number_of_completed_requests += 1;
+	}
+	return( 1 );
+}
+
+/* Prepares an asynchronous read of file data for a request
+ * Submits the prepared reads or processes completed reads when the queues are full
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_internal_read_queue_prepare_read(
+     libolecf_internal_read_queue_t *internal_read_queue,
+     libolecf_read_queue_request_t *request,
+     int file_descriptor,
+     uint8_t *buffer,
+     size_t size,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_internal_read_queue_prepare_read";
+	int result            = 0;
+
+	if( internal_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid request.",
+		 function );
+
+		return( -1 );
+	}
+	result = libolecf_io_uring_prepare_read(
+	          internal_read_queue->io_uring,
+	          file_descriptor,
+	          buffer,
+	          size,
+	          file_offset,
+	          (intptr_t *) request,
+	          error );
+
+	if( result == 0 )
+	{
+		/* The submission queue is full
+		 */
+		if( libolecf_io_uring_submit(
+		     internal_read_queue->io_uring,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to submit reads.",
+			 function );
+
+			return( -1 );
+		}
+		result = libolecf_io_uring_prepare_read(
+		          internal_read_queue->io_uring,
+		          file_descriptor,
+		          buffer,
+		          size,
+		          file_offset,
+		          (intptr_t *) request,
+		          error );
+	}
+	while( result == 0 )
+	{
+		/* The completion queue is full
+		 */
+		if( libolecf_internal_read_queue_process_completion(
+		     internal_read_queue,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process completion.",
+			 function );
+
+			return( -1 );
+		}
+		result = libolecf_io_uring_prepare_read(
+		          internal_read_queue->io_uring,
+		          file_descriptor,
+		          buffer,
+		          size,
+		          file_offset,
+		          (intptr_t *) request,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to prepare read.",
+		 function );
+
+		return( -1 );
+	}
+	request->number_of_pending_reads += 1;
+
+	return( 1 );
+}
+
+/* Prepares the asynchronous reads of stream data for a request
+ * The stream data is translated into contiguous file extents the same way
+ * libolecf_io_handle_read_stream does and every extent is read asynchronously
+ * This function requires that the file read/write lock is held for reading
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libolecf_internal_read_queue_read_stream_asynchronous(
+     libolecf_internal_read_queue_t *internal_read_queue,
+     libolecf_read_queue_request_t *request,
+     libolecf_internal_item_t *internal_item,
+     off64_t offset,
+     uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	libolecf_extent_map_t *extent_map = NULL;
+	libolecf_extent_t *extent         = NULL;
+	libolecf_io_handle_t *io_handle   = NULL;
+	static char *function             = "libolecf_internal_read_queue_read_stream_asynchronous";
+	off64_t extent_data_offset        = 0;
+	size_t buffer_offset              = 0;
+	size_t read_size                  = 0;
+	int extent_index                  = 0;
+	int file_descriptor               = -1;
+	int result                        = 0;
+
+	if( internal_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing file.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle = internal_item->io_handle;
+
+	/* The reads use the read-ahead file descriptor since the file IO handle
+	 * does not expose its descriptor, copying memory mapped data is faster
+	 */
+	if( ( internal_read_queue->io_uring == NULL )
+	 || ( io_handle->memory_mapped_data != NULL )
+	 || ( io_handle->read_ahead == NULL ) )
+	{
+		return( 0 );
+	}
+	file_descriptor = io_handle->read_ahead->file_descriptor;
+
+	if( file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	result = libolecf_io_handle_get_stream_extent_map_with_lock(
+	          io_handle,
+	          internal_item->file->sat,
+	          internal_item->file->ssat,
+	          internal_item->directory_entry,
+	          &extent_map,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stream extent map.",
+		 function );
+
+		return( -1 );
+	}
+	result = libolecf_extent_map_get_extent_index_by_offset(
+	          extent_map,
+	          offset,
+	          &extent_index,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent index for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	while( size > 0 )
+	{
+		if( extent_index >= extent_map->number_of_extents )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid extent index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		extent = &( extent_map->extents[ extent_index ] );
+
+		extent_data_offset = offset - extent->offset;
+
+		if( (size64_t) size > ( extent->size - extent_data_offset ) )
+		{
+			read_size = (size_t) ( extent->size - extent_data_offset );
+		}
+		else
+		{
+			read_size = size;
+		}
+		if( read_size > (size_t) LIBOLECF_MAXIMUM_ASYNCHRONOUS_READ_SIZE )
+		{
+			read_size = (size_t) LIBOLECF_MAXIMUM_ASYNCHRONOUS_READ_SIZE;
+		}
+		if( libolecf_internal_read_queue_prepare_read(
+		     internal_read_queue,
+		     request,
+		     file_descriptor,
+		     &( buffer[ buffer_offset ] ),
+		     read_size,
+		     extent->file_offset + extent_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to prepare read of stream data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		buffer_offset += read_size;
+		offset        += read_size;
+		size          -= read_size;
+
+		if( (size64_t) ( extent_data_offset + read_size ) >= extent->size )
+		{
+			extent_index++;
+		}
+	}
+	return( 1 );
+}
+
+/* Submits a request to read stream data at a specific offset into a buffer
+ * Returns 1 if successful, 0 if the queue is full or -1 on error
+ */
+int libolecf_internal_read_queue_submit_read(
+     libolecf_internal_read_queue_t *internal_read_queue,
+     libolecf_internal_item_t *internal_item,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     intptr_t *user_data,
+     libcerror_error_t **error )
+{
+	libolecf_read_queue_request_t *request = NULL;
+	static char *function                  = "libolecf_internal_read_queue_submit_read";
+	size64_t stream_size                   = 0;
+	ssize_t read_count                     = 0;
+	int request_index                      = 0;
+	int result                             = 0;
+
+	if( internal_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_read_queue->requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid read queue - missing requests.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_read_queue->number_of_requests >= internal_read_queue->maximum_number_of_requests )
+	{
+		return( 0 );
+	}
+	for( request_index = 0;
+	     request_index < internal_read_queue->maximum_number_of_requests;
+	     request_index++ )
+	{
+		request = &( internal_read_queue->requests[ request_index ] );
+
+		if( request->state == LIBOLECF_READ_QUEUE_REQUEST_STATE_UNUSED )
+		{
+			break;
+		}
+	}
+	if( request_index >= internal_read_queue->maximum_number_of_requests )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing unused request.",
+		 function );
+
+		return( -1 );
+	}
+	stream_size = (size64_t) internal_item->directory_entry->size;
+
+	if( (size64_t) offset >= stream_size )
+	{
+		buffer_size = 0;
+	}
+	else if( (size64_t) buffer_size > ( stream_size - (size64_t) offset ) )
+	{
+		buffer_size = (size_t) ( stream_size - (size64_t) offset );
+	}
+	request->user_data               = user_data;
+	request->read_size               = buffer_size;
+	request->read_count              = 0;
+	request->number_of_pending_reads = 0;
+	request->system_error_code       = 0;
+	request->state                   = LIBOLECF_READ_QUEUE_REQUEST_STATE_SUBMITTING;
+
+	internal_read_queue->number_of_requests += 1;
+
+	if( buffer_size > 0 )
+	{
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_item->file->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		result = libolecf_internal_read_queue_read_stream_asynchronous(
+		          internal_read_queue,
+		          request,
+		          internal_item,
+		          offset,
+		          buffer,
+		          buffer_size,
+		          error );
+
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_item->file->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read stream data asynchronously.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			read_count = libolecf_internal_stream_read_buffer_at_offset(
+			              internal_item,
+			              offset,
+			              buffer,
+			              buffer_size,
+			              error );
+
+			if( read_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read stream data.",
+				 function );
+
+				goto on_error;
+			}
+			request->read_count = (size_t) read_count;
+		}
+		else if( libolecf_io_uring_submit(
+		          internal_read_queue->io_uring,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to submit reads.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( request->number_of_pending_reads == 0 )
+	{
+		request->state = LIBOLECF_READ_QUEUE_REQUEST_STATE_COMPLETED;
+
+		internal_read_queue->number_of_completed_requests += 1;
+	}
+	else
+	{
+		request->state = LIBOLECF_READ_QUEUE_REQUEST_STATE_PENDING;
+	}
+	return( 1 );
+
+on_error:
+	/* The system can still write into the buffer of a read that was submitted,
+	 * hence the request is only released after its reads have completed
+	 */
+	while( request->number_of_pending_reads > 0 )
+	{
+		if( libolecf_internal_read_queue_process_completion(
+		     internal_read_queue,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	request->state = LIBOLECF_READ_QUEUE_REQUEST_STATE_UNUSED;
+
+	internal_read_queue->number_of_requests -= 1;
+
+	return( -1 );
+}
+
+/* Submits a request to read stream data at a specific offset into a buffer
+ * The data is read asynchronously if the system supports it, otherwise it is read
+ * before this function returns. The buffer, stream and file must remain valid until
+ * the completion of the request was retrieved with libolecf_read_queue_get_completion
+ * This function does not use or change the current offset of the stream
+ * Returns 1 if successful, 0 if the queue is full or -1 on error
+ */
+int libolecf_read_queue_submit_read(
+     libolecf_read_queue_t *read_queue,
+     libolecf_item_t *stream,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     intptr_t *user_data,
+     libcerror_error_t **error )
+{
+	libolecf_internal_item_t *internal_item             = NULL;
+	libolecf_internal_read_queue_t *internal_read_queue = NULL;
+	static char *function                               = "libolecf_read_queue_submit_read";
+	int result                                          = 0;
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_queue = (libolecf_internal_read_queue_t *) read_queue;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libolecf_internal_item_t *) stream;
+
+	if( internal_item->file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid stream - missing file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid stream - missing directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->directory_entry->type != LIBOLECF_ITEM_TYPE_STREAM )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid stream - unsupported directory entry type: 0x%02" PRIx8 ".",
+		 function,
+		 internal_item->directory_entry->type );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_read_queue->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libolecf_internal_read_queue_submit_read(
+	          internal_read_queue,
+	          internal_item,
+	          buffer,
+	          buffer_size,
+	          offset,
+	          user_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to submit read.",
+		 function );
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_read_queue->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a completed request and releases it
+ * Waits for a request to complete if none has completed yet
+ * Returns 1 if successful, 0 if no requests were submitted or -1 on error
+ */
+int libolecf_internal_read_queue_get_completion(
+     libolecf_internal_read_queue_t *internal_read_queue,
+     intptr_t **user_data,
+     ssize_t *read_count,
+     libcerror_error_t **error )
+{
+	libolecf_read_queue_request_t *request = NULL;
+	static char *function                  = "libolecf_internal_read_queue_get_completion";
+	size_t request_read_count              = 0;
+	size_t request_read_size               = 0;
+	uint32_t system_error_code             = 0;
+	int request_index                      = 0;
+
+	if( internal_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_read_queue->requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid read queue - missing requests.",
+		 function );
+
+		return( -1 );
+	}
+	if( user_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid user data.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_count == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read count.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_read_queue->number_of_requests == 0 )
+	{
+		return( 0 );
+	}
+	while( internal_read_queue->number_of_completed_requests == 0 )
+	{
+		if( libolecf_internal_read_queue_process_completion(
+		     internal_read_queue,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process completion.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	for( request_index = 0;
+	     request_index < internal_read_queue->maximum_number_of_requests;
+	     request_index++ )
+	{
+		request = &( internal_read_queue->requests[ request_index ] );
+
+		if( request->state == LIBOLECF_READ_QUEUE_REQUEST_STATE_COMPLETED )
+		{
+			break;
+		}
+	}
+	if( request_index >= internal_read_queue->maximum_number_of_requests )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing completed request.",
+		 function );
+
+		return( -1 );
+	}
+	*user_data = request->user_data;
+
+	request_read_count = request->read_count;
+	request_read_size  = request->read_size;
+	system_error_code  = request->system_error_code;
+
+	request->state = LIBOLECF_READ_QUEUE_REQUEST_STATE_UNUSED;
+
+	internal_read_queue->number_of_completed_requests -= 1;
+	internal_read_queue->number_of_requests           -= 1;
+
+	if( system_error_code != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 system_error_code,
+		 "%s: unable to read stream data.",
+		 function );
+
+		return( -1 );
+	}
+	if( request_read_count != request_read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read stream data - read count: %" PRIzd " does not match read size: %" PRIzd ".",
+		 function,
+		 request_read_count,
+		 request_read_size );
+
+		return( -1 );
+	}
+	*read_count = (ssize_t) request_read_count;
+
+	return( 1 );
+}
+
+/* Retrieves a completed request of the read queue
+ * Waits for a request to complete if none has completed yet,
+ * requests do not necessarily complete in the order they were submitted
+ * If the read of the request failed -1 is returned and user data is set
+ * Returns 1 if successful, 0 if no requests were submitted or -1 on error
+ */
+int libolecf_read_queue_get_completion(
+     libolecf_read_queue_t *read_queue,
+     intptr_t **user_data,
+     ssize_t *read_count,
+     libcerror_error_t **error )
+{
+	libolecf_internal_read_queue_t *internal_read_queue = NULL;
+	static char *function                               = "libolecf_read_queue_get_completion";
+	int result                                          = 0;
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_queue = (libolecf_internal_read_queue_t *) read_queue;
+
+	if( user_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid user data.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_count == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read count.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_read_queue->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libolecf_internal_read_queue_get_completion(
+	          internal_read_queue,
+	          user_data,
+	          read_count,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve completion.",
+		 function );
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_read_queue->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
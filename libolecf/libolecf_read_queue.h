@@ -0,0 +1,170 @@
+/*
+ * Read queue functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBOLECF_READ_QUEUE_H )
+#define _LIBOLECF_READ_QUEUE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libolecf_extern.h"
+#include "libolecf_io_uring.h"
+#include "libolecf_item.h"
+#include "libolecf_libcerror.h"
+#include "libolecf_libcthreads.h"
+#include "libolecf_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libolecf_read_queue_request libolecf_read_queue_request_t;
+
+struct libolecf_read_queue_request
+{
+	/* The user data
+	 */
+	intptr_t *user_data;
+
+	/* The number of bytes to read
+	 */
+	size_t read_size;
+
+	/* The number of bytes read
+	 */
+	size_t read_count;
+
+	/* The number of asynchronous reads that have not completed
+	 */
+	int number_of_pending_reads;
+
+	/* The system error code of the first asynchronous read that failed
+	 */
+	uint32_t system_error_code;
+
+	/* The state
+	 */
+	uint8_t state;
+};
+
+typedef struct libolecf_internal_read_queue libolecf_internal_read_queue_t;
+
+struct libolecf_internal_read_queue
+{
+	/* The requests
+	 */
+	libolecf_read_queue_request_t *requests;
+
+	/* The maximum number of requests
+	 */
+	int maximum_number_of_requests;
+
+	/* The number of requests
+	 */
+	int number_of_requests;
+
+	/* The number of completed requests
+	 */
+	int number_of_completed_requests;
+
+	/* The io_uring used for asynchronous reads
+	 * or NULL if not available
+	 */
+	libolecf_io_uring_t *io_uring;
+
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+LIBOLECF_EXTERN \
+int libolecf_read_queue_initialize(
+     libolecf_read_queue_t **read_queue,
+     int maximum_number_of_requests,
+     libcerror_error_t **error );
+
+LIBOLECF_EXTERN \
+int libolecf_read_queue_free(
+     libolecf_read_queue_t **read_queue,
+     libcerror_error_t **error );
+
+int libolecf_internal_read_queue_process_completion(
+     libolecf_internal_read_queue_t *internal_read_queue,
+     libcerror_error_t **error );
+
+int libolecf_internal_read_queue_prepare_read(
+     libolecf_internal_read_queue_t *internal_read_queue,
+     libolecf_read_queue_request_t *request,
+     int file_descriptor,
+     uint8_t *buffer,
+     size_t size,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libolecf_internal_read_queue_read_stream_asynchronous(
+     libolecf_internal_read_queue_t *internal_read_queue,
+     libolecf_read_queue_request_t *request,
+     libolecf_internal_item_t *internal_item,
+     off64_t offset,
+     uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int libolecf_internal_read_queue_submit_read(
+     libolecf_internal_read_queue_t *internal_read_queue,
+     libolecf_internal_item_t *internal_item,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
+LIBOLECF_EXTERN \
+int libolecf_read_queue_submit_read(
+     libolecf_read_queue_t *read_queue,
+     libolecf_item_t *stream,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
+int libolecf_internal_read_queue_get_completion(
+     libolecf_internal_read_queue_t *internal_read_queue,
+     intptr_t **user_data,
+     ssize_t *read_count,
+     libcerror_error_t **error );
+
+LIBOLECF_EXTERN \
+int libolecf_read_queue_get_completion(
+     libolecf_read_queue_t *read_queue,
+     intptr_t **user_data,
+     ssize_t *read_count,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBOLECF_READ_QUEUE_H ) */
+
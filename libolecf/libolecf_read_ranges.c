@@ -0,0 +1,315 @@
+/*
+ * Read ranges functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libolecf_libcerror.h"
+#include "libolecf_read_ranges.h"
+
+/* Creates read ranges
+ * Make sure the value read_ranges is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_read_ranges_initialize(
+     libolecf_read_ranges_t **read_ranges,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_read_ranges_initialize";
+
+	if( read_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_ranges != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read ranges value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*read_ranges = memory_allocate_structure(
+	                libolecf_read_ranges_t );
+
+	if( *read_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read ranges.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_ranges,
+	     0,
+	     sizeof( libolecf_read_ranges_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read ranges.",
+		 function );
+
+		memory_free(
+		 *read_ranges );
+
+		*read_ranges = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *read_ranges != NULL )
+	{
+		memory_free(
+		 *read_ranges );
+
+		*read_ranges = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees read ranges
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_read_ranges_free(
+     libolecf_read_ranges_t **read_ranges,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_read_ranges_free";
+
+	if( read_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_ranges != NULL )
+	{
+		if( ( *read_ranges )->ranges != NULL )
+		{
+			memory_free(
+			 ( *read_ranges )->ranges );
+		}
+		memory_free(
+		 *read_ranges );
+
+		*read_ranges = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a range to the read ranges
+ * The data of the range in the file is read into the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_read_ranges_append_range(
+     libolecf_read_ranges_t *read_ranges,
+     off64_t file_offset,
+     uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	libolecf_read_range_t *read_range = NULL;
+	void *reallocation                = NULL;
+	static char *function             = "libolecf_read_ranges_append_range";
+	size_t ranges_size                = 0;
+	int number_of_allocated_ranges    = 0;
+
+	if( read_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) SSIZE_MAX )
+	 || ( (size64_t) size > (size64_t) ( INT64_MAX - file_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_ranges->number_of_ranges >= read_ranges->number_of_allocated_ranges )
+	{
+		if( read_ranges->number_of_allocated_ranges == 0 )
+		{
+			number_of_allocated_ranges = 16;
+		}
+		else
+		{
+			number_of_allocated_ranges = read_ranges->number_of_allocated_ranges * 2;
+		}
+		if( (size_t) number_of_allocated_ranges > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libolecf_read_range_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of allocated ranges value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		ranges_size = sizeof( libolecf_read_range_t ) * number_of_allocated_ranges;
+
+		reallocation = memory_reallocate(
+		                read_ranges->ranges,
+		                ranges_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize ranges.",
+			 function );
+
+			return( -1 );
+		}
+		read_ranges->ranges                     = (libolecf_read_range_t *) reallocation;
+		read_ranges->number_of_allocated_ranges = number_of_allocated_ranges;
+	}
+	read_range = &( read_ranges->ranges[ read_ranges->number_of_ranges ] );
+
+	read_range->file_offset = file_offset;
+	read_range->size        = size;
+	read_range->buffer      = buffer;
+
+	read_ranges->number_of_ranges += 1;
+
+	return( 1 );
+}
+
+/* Compares two read ranges by their file offset
+ * Returns -1 if the first is less than the second, 0 if equal or 1 if greater
+ */
+int libolecf_read_range_compare_by_file_offset(
+     const void *first_read_range,
+     const void *second_read_range )
+{
+	off64_t first_file_offset  = 0;
+	off64_t second_file_offset = 0;
+
+	first_file_offset  = ( (const libolecf_read_range_t *) first_read_range )->file_offset;
+	second_file_offset = ( (const libolecf_read_range_t *) second_read_range )->file_offset;
+
+	if( first_file_offset < second_file_offset )
+	{
+		return( -1 );
+	}
+	else if( first_file_offset > second_file_offset )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Sorts the read ranges by their file offset
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_read_ranges_sort(
+     libolecf_read_ranges_t *read_ranges,
+     libcerror_error_t **error )
+{
+	static char *function = "libolecf_read_ranges_sort";
+
+	if( read_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_ranges->number_of_ranges > 1 )
+	{
+		qsort(
+		 read_ranges->ranges,
+		 (size_t) read_ranges->number_of_ranges,
+		 sizeof( libolecf_read_range_t ),
+		 &libolecf_read_range_compare_by_file_offset );
+	}
+	return( 1 );
+}
+
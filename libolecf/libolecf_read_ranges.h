@@ -0,0 +1,96 @@
+/*
+ * Read ranges functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBOLECF_READ_RANGES_H )
+#define _LIBOLECF_READ_RANGES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libolecf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libolecf_read_range libolecf_read_range_t;
+
+struct libolecf_read_range
+{
+	/* The file offset
+	 */
+	off64_t file_offset;
+
+	/* The size
+	 */
+	size_t size;
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+};
+
+typedef struct libolecf_read_ranges libolecf_read_ranges_t;
+
+struct libolecf_read_ranges
+{
+	/* The ranges
+	 */
+	libolecf_read_range_t *ranges;
+
+	/* The number of ranges
+	 */
+	int number_of_ranges;
+
+	/* The number of allocated ranges
+	 */
+	int number_of_allocated_ranges;
+};
+
+int libolecf_read_ranges_initialize(
+     libolecf_read_ranges_t **read_ranges,
+     libcerror_error_t **error );
+
+int libolecf_read_ranges_free(
+     libolecf_read_ranges_t **read_ranges,
+     libcerror_error_t **error );
+
+int libolecf_read_ranges_append_range(
+     libolecf_read_ranges_t *read_ranges,
+     off64_t file_offset,
+     uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int libolecf_read_range_compare_by_file_offset(
+     const void *first_read_range,
+     const void *second_read_range );
+
+int libolecf_read_ranges_sort(
+     libolecf_read_ranges_t *read_ranges,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBOLECF_READ_RANGES_H ) */
+
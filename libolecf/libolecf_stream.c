@@ -26,24 +26,26 @@
 #include "libolecf_definitions.h"
 #include "libolecf_directory_entry.h"
 #include "libolecf_libcerror.h"
+#include "libolecf_libcthreads.h"
 #include "libolecf_item.h"
 #include "libolecf_io_handle.h"
 #include "libolecf_stream.h"
 
-/* Reads stream data from the current offset into a buffer
+/* Reads stream data at a specific offset into a buffer
+ * This function does not change the current offset of the stream
  * Returns the number of bytes read or -1 on error
  */
-ssize_t libolecf_stream_read_buffer(
-         libolecf_item_t *item,
+ssize_t libolecf_internal_stream_read_buffer_at_offset(
+         libolecf_internal_item_t *internal_item,
+         off64_t offset,
          uint8_t *buffer,
          size_t size,
          libcerror_error_t **error )
 {
-	libolecf_internal_item_t *internal_item = NULL;
-	static char *function                   = "libolecf_stream_read_buffer";
-	ssize_t read_count                      = 0;
+	static char *function = "libolecf_internal_stream_read_buffer_at_offset";
+	ssize_t read_count    = 0;
 
-	if( item == NULL )
+	if( internal_item == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -54,8 +56,6 @@ ssize_t libolecf_stream_read_buffer(
 
 		return( -1 );
 	}
-	internal_item = (libolecf_internal_item_t *) item;
-
 	if( internal_item->file == NULL )
 	{
 		libcerror_error_set(
@@ -90,13 +90,13 @@ ssize_t libolecf_stream_read_buffer(
 
 		return( -1 );
 	}
-	if( internal_item->current_offset < 0 )
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid item - current offset value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
 		 function );
 
 		return( -1 );
@@ -123,26 +123,56 @@ ssize_t libolecf_stream_read_buffer(
 
 		return( -1 );
 	}
-	if( internal_item->current_offset >= (off64_t) internal_item->directory_entry->size )
+	if( offset >= (off64_t) internal_item->directory_entry->size )
 	{
 		return( 0 );
 	}
 	if( ( size > (size64_t) internal_item->directory_entry->size )
-	 || ( (size64_t) internal_item->current_offset > ( (size64_t) internal_item->directory_entry->size - size ) ) )
+	 || ( (size64_t) offset > ( (size64_t) internal_item->directory_entry->size - size ) ) )
 	{
-		size = (size_t)( (off64_t) internal_item->directory_entry->size - internal_item->current_offset );
+		size = (size_t)( (off64_t) internal_item->directory_entry->size - offset );
 	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_item->file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	read_count = libolecf_io_handle_read_stream(
 	              internal_item->io_handle,
 	              internal_item->file_io_handle,
 	              internal_item->file->sat,
 	              internal_item->file->ssat,
 	              internal_item->directory_entry,
-	              &( internal_item->current_offset ),
+	              &offset,
 	              buffer,
 	              size,
 	              error );
 
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_item->file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( read_count != (ssize_t) size )
 	{
 		libcerror_error_set(
@@ -157,41 +187,206 @@ ssize_t libolecf_stream_read_buffer(
 	return( read_count );
 }
 
+/* Reads stream data from the current offset into a buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libolecf_stream_read_buffer(
+         libolecf_item_t *item,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	libolecf_internal_item_t *internal_item = NULL;
+	static char *function                   = "libolecf_stream_read_buffer";
+	ssize_t read_count                      = 0;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libolecf_internal_item_t *) item;
+
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_item->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	read_count = libolecf_internal_stream_read_buffer_at_offset(
+	              internal_item,
+	              internal_item->current_offset,
+	              buffer,
+	              size,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer from stream.",
+		 function );
+
+		read_count = -1;
+	}
+	else
+	{
+		internal_item->current_offset += read_count;
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_item->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
 /* Reads stream data a specific offset into a buffer
  * Returns the number of bytes read or -1 on error
  */
 ssize_t libolecf_stream_read_buffer_at_offset(
-         libolecf_item_t *stream,
+         libolecf_item_t *item,
          uint8_t *buffer,
          size_t buffer_size,
          off64_t offset,
          libcerror_error_t **error )
 {
-	static char *function = "libolecf_stream_read_buffer_at_offset";
-	ssize_t read_count    = 0;
+	libolecf_internal_item_t *internal_item = NULL;
+	static char *function                   = "libolecf_stream_read_buffer_at_offset";
+	ssize_t read_count                      = 0;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libolecf_internal_item_t *) item;
+
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_item->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	read_count = libolecf_internal_stream_read_buffer_at_offset(
+	              internal_item,
+	              offset,
+	              buffer,
+	              buffer_size,
+	              error );
 
-	if( libolecf_stream_seek_offset(
-	     stream,
-	     offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	if( read_count == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		read_count = -1;
+	}
+	else
+	{
+		internal_item->current_offset = offset + read_count;
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_item->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Reads stream data at a specific offset into a buffer
+ * This function does not use or change the current offset of the stream and
+ * can be called concurrently for the same stream
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libolecf_stream_read_buffer_at_offset_without_seek(
+         libolecf_item_t *item,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libolecf_stream_read_buffer_at_offset_without_seek";
+	ssize_t read_count    = 0;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
 		 function );
 
 		return( -1 );
 	}
-	read_count = libolecf_stream_read_buffer(
-	              stream,
+	/* The item read/write lock is not needed since only values of the item
+	 * that are not changed after the item was created are used
+	 */
+	read_count = libolecf_internal_stream_read_buffer_at_offset(
+	              (libolecf_internal_item_t *) item,
+	              offset,
 	              buffer,
 	              buffer_size,
 	              error );
 
-	if( read_count < 0 )
+	if( read_count == -1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -205,6 +400,131 @@ ssize_t libolecf_stream_read_buffer_at_offset(
 	return( read_count );
 }
 
+/* Reads ranges of stream data into buffers
+ * The ranges are read with as few reads of the file as possible and
+ * must be within the stream data
+ * This function does not use or change the current offset of the stream and
+ * can be called concurrently for the same stream
+ * Returns 1 if successful or -1 on error
+ */
+int libolecf_stream_read_ranges(
+     libolecf_item_t *item,
+     uint8_t **buffers,
+     const size_t *buffer_sizes,
+     const off64_t *offsets,
+     int number_of_ranges,
+     libcerror_error_t **error )
+{
+	libolecf_internal_item_t *internal_item = NULL;
+	static char *function                   = "libolecf_stream_read_ranges";
+	int result                              = 0;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libolecf_internal_item_t *) item;
+
+	if( internal_item->file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->directory_entry->type != LIBOLECF_ITEM_TYPE_STREAM )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid item - unsupported directory entry type: 0x%02" PRIx8 ".",
+		 function,
+		 internal_item->directory_entry->type );
+
+		return( -1 );
+	}
+	/* The item read/write lock is not needed since only values of the item
+	 * that are not changed after the item was created are used
+	 */
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_item->file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libolecf_io_handle_read_stream_ranges(
+	          internal_item->io_handle,
+	          internal_item->file_io_handle,
+	          internal_item->file->sat,
+	          internal_item->file->ssat,
+	          internal_item->directory_entry,
+	          buffers,
+	          buffer_sizes,
+	          offsets,
+	          number_of_ranges,
+	          error );
+
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_item->file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read ranges.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Seeks a certain offset of the stream data
  * Returns the offset if seek is successful or -1 on error
  */
@@ -277,6 +597,21 @@ off64_t libolecf_stream_seek_offset(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_item->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( whence == SEEK_CUR )
 	{
 		offset += internal_item->current_offset;
@@ -294,10 +629,27 @@ off64_t libolecf_stream_seek_offset(
 		 "%s: unable to seek offset.",
 		 function );
 
-		return( -1 );
+		offset = -1;
 	}
-	internal_item->current_offset = offset;
+	else
+	{
+		internal_item->current_offset = offset;
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_item->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
+		return( -1 );
+	}
+#endif
 	return( offset );
 }
 
@@ -359,8 +711,158 @@ int libolecf_stream_get_offset(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_item->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	*offset = internal_item->current_offset;
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_item->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 
 	return( 1 );
 }
 
+/* Retrieves a view of the stream data at a specific offset
+ * The view references the contiguous part of the stream data in the memory mapped file
+ * that contains the offset and remains valid until the file is closed
+ * The mapped file must not be truncated while it is open, accessing data beyond
+ * the new end of the file, using a view or a stream read, raises SIGBUS on POSIX
+ * systems and an access violation on Windows
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libolecf_stream_get_data_view_at_offset(
+     libolecf_item_t *item,
+     off64_t offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libolecf_internal_item_t *internal_item = NULL;
+	static char *function                   = "libolecf_stream_get_data_view_at_offset";
+	int result                              = 0;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libolecf_internal_item_t *) item;
+
+	if( internal_item->file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->directory_entry->type != LIBOLECF_ITEM_TYPE_STREAM )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid item - unsupported directory entry type: 0x%02" PRIx8 ".",
+		 function,
+		 internal_item->directory_entry->type );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_item->file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libolecf_io_handle_get_stream_data_view(
+	          internal_item->io_handle,
+	          internal_item->file->sat,
+	          internal_item->file->ssat,
+	          internal_item->directory_entry,
+	          offset,
+	          data,
+	          data_size,
+	          error );
+
+#if defined( HAVE_LIBOLECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_item->file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stream data view.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
@@ -33,6 +33,13 @@
 extern "C" {
 #endif
 
+ssize_t libolecf_internal_stream_read_buffer_at_offset(
+         libolecf_internal_item_t *internal_item,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
 LIBOLECF_EXTERN \
 ssize_t libolecf_stream_read_buffer(
          libolecf_item_t *stream,
@@ -48,6 +55,23 @@ ssize_t libolecf_stream_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+LIBOLECF_EXTERN \
+ssize_t libolecf_stream_read_buffer_at_offset_without_seek(
+         libolecf_item_t *stream,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+LIBOLECF_EXTERN \
+int libolecf_stream_read_ranges(
+     libolecf_item_t *stream,
+     uint8_t **buffers,
+     const size_t *buffer_sizes,
+     const off64_t *offsets,
+     int number_of_ranges,
+     libcerror_error_t **error );
+
 LIBOLECF_EXTERN \
 off64_t libolecf_stream_seek_offset(
          libolecf_item_t *stream,
@@ -61,6 +85,14 @@ int libolecf_stream_get_offset(
      off64_t *offset,
      libcerror_error_t **error );
 
+LIBOLECF_EXTERN \
+int libolecf_stream_get_data_view_at_offset(
+     libolecf_item_t *stream,
+     off64_t offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -39,6 +39,7 @@ typedef struct libolecf_item {}			libolecf_item_t;
 typedef struct libolecf_property_section {}	libolecf_property_section_t;
 typedef struct libolecf_property_set {}		libolecf_property_set_t;
 typedef struct libolecf_property_value {}	libolecf_property_value_t;
+typedef struct libolecf_read_queue {}		libolecf_read_queue_t;
 
 #else
 typedef intptr_t libolecf_file_t;
@@ -46,6 +47,7 @@ typedef intptr_t libolecf_item_t;
 typedef intptr_t libolecf_property_section_t;
 typedef intptr_t libolecf_property_set_t;
 typedef intptr_t libolecf_property_value_t;
+typedef intptr_t libolecf_read_queue_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
@@ -32,11 +32,14 @@
 #include "olecftools_libclocale.h"
 #include "olecftools_libcnotify.h"
 #include "olecftools_libcpath.h"
+#include "olecftools_libcthreads.h"
 #include "olecftools_libolecf.h"
 #include "olecftools_unused.h"
 
-#define EXPORT_HANDLE_BUFFER_SIZE	32768
-#define EXPORT_HANDLE_NOTIFY_STREAM	stdout
+#define EXPORT_HANDLE_BUFFER_SIZE				32768
+#define EXPORT_HANDLE_NOTIFY_STREAM				stdout
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS			64
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_QUEUED_STREAM_DATA_JOBS	128
 
 /* Creates an export handle
  * Make sure the value export_handle is referencing, is set to NULL
@@ -282,6 +285,70 @@ int export_handle_set_ascii_codepage(
 	return( result );
 }
 
+/* Sets the number of threads used to export stream data
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_number_of_threads";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	int number_of_threads = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 0 )
+	 || ( string_length > 2 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		number_of_threads *= 10;
+		number_of_threads += (int) ( string[ string_index ] - (system_character_t) '0' );
+	}
+	if( number_of_threads > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+	{
+		return( 0 );
+	}
+	export_handle->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
 /* Sets the target path
  * Returns 1 if successful or -1 on error
  */
@@ -680,13 +747,13 @@ int export_handle_open_input(
 	if( libolecf_file_open_wide(
 	     export_handle->input_file,
 	     filename,
-	     LIBOLECF_OPEN_READ,
+	     LIBOLECF_OPEN_READ_AHEAD,
 	     error ) != 1 )
 #else
 	if( libolecf_file_open(
 	     export_handle->input_file,
 	     filename,
-	     LIBOLECF_OPEN_READ,
+	     LIBOLECF_OPEN_READ_AHEAD,
 	     error ) != 1 )
 #endif
 	{
@@ -740,6 +807,9 @@ int export_handle_close(
 }
 
 /* Exports the item
+ * This creates the directory and the stream data file of the item and exports its sub items
+ * The stream data file is returned open so that the stream data can be exported separately,
+ * it is NULL if the stream data should not be exported
  * Returns 1 if successful or -1 on error
  */
 int export_handle_export_item(
@@ -749,28 +819,23 @@ int export_handle_export_item(
      int number_of_items OLECFTOOLS_ATTRIBUTE_UNUSED,
      const system_character_t *export_path,
      size_t export_path_length,
+     libcfile_file_t **stream_data_file,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	libcfile_file_t *stream_data_file  = NULL;
-	system_character_t *item_name      = NULL;
-	system_character_t *item_path      = NULL;
-	system_character_t *sanitized_name = NULL;
-	system_character_t *target_path    = NULL;
-	uint8_t *buffer                    = NULL;
-	static char *function              = "export_handle_export_item";
-	size_t buffer_size                 = EXPORT_HANDLE_BUFFER_SIZE;
-	size_t item_name_size              = 0;
-	size_t item_path_size              = 0;
-	size_t minimum_item_name_size      = 0;
-	size_t read_size                   = 0;
-	size_t sanitized_name_size         = 0;
-	size_t target_path_size            = 0;
-	ssize_t read_count                 = 0;
-	ssize_t write_count                = 0;
-	uint32_t stream_data_size          = 0;
-	int print_count                    = 0;
-	int result                         = 0;
+	libcfile_file_t *safe_stream_data_file = NULL;
+	system_character_t *item_name          = NULL;
+	system_character_t *item_path          = NULL;
+	system_character_t *sanitized_name     = NULL;
+	system_character_t *target_path        = NULL;
+	static char *function                  = "export_handle_export_item";
+	size_t item_name_size                  = 0;
+	size_t item_path_size                  = 0;
+	size_t minimum_item_name_size          = 0;
+	size_t sanitized_name_size             = 0;
+	size_t target_path_size                = 0;
+	int print_count                        = 0;
+	int result                             = 0;
 
 	OLECFTOOLS_UNREFERENCED_PARAMETER( number_of_items )
 
@@ -807,6 +872,28 @@ int export_handle_export_item(
 
 		return( -1 );
 	}
+	if( stream_data_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream data file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream_data_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream data file value already set.",
+		 function );
+
+		return( -1 );
+	}
 	log_handle_printf(
 	 log_handle,
 	 "Processing item: %05d in path: %" PRIs_SYSTEM "%c\n",
@@ -984,6 +1071,25 @@ int export_handle_export_item(
 
 		item_path = NULL;
 
+		/* The sanitized item name can be smaller than the default item name
+		 */
+		memory_free(
+		 item_name );
+
+		item_name = system_string_allocate(
+		             10 );
+
+		if( item_name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create the item name.",
+			 function );
+
+			goto on_error;
+		}
 		print_count = system_string_sprintf(
 		               item_name,
 		               10,
@@ -1161,22 +1267,8 @@ int export_handle_export_item(
 
 		return( 1 );
 	}
-	if( libolecf_item_get_size(
-	     item,
-	     &stream_data_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve item stream data size.",
-		 function );
-
-		goto on_error;
-	}
 	if( libcfile_file_initialize(
-	     &stream_data_file,
+	     &safe_stream_data_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1190,13 +1282,13 @@ int export_handle_export_item(
 	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	result = libcfile_file_open_wide(
-		  stream_data_file,
+		  safe_stream_data_file,
 		  target_path,
 		  LIBCFILE_OPEN_WRITE,
 		  error );
 #else
 	result = libcfile_file_open(
-		  stream_data_file,
+		  safe_stream_data_file,
 		  target_path,
 		  LIBCFILE_OPEN_WRITE,
 		  error );
@@ -1218,6 +1310,130 @@ int export_handle_export_item(
 
 	target_path = NULL;
 
+	/* Export the sub items
+	 */
+	if( export_handle_export_sub_items(
+	     export_handle,
+	     item,
+	     item_path,
+	     item_path_size - 1,
+	     log_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+		 LIBCERROR_OUTPUT_ERROR_GENERIC,
+		 "%s: unable to export sub items.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 item_path );
+
+	item_path = NULL;
+
+	*stream_data_file = safe_stream_data_file;
+
+	return( 1 );
+
+on_error:
+	if( safe_stream_data_file != NULL )
+	{
+		libcfile_file_free(
+		 &safe_stream_data_file,
+		 NULL );
+	}
+	if( target_path != NULL )
+	{
+		memory_free(
+		 target_path );
+	}
+	if( item_path != NULL )
+	{
+		memory_free(
+		 item_path );
+	}
+	if( sanitized_name != NULL )
+	{
+		memory_free(
+		 sanitized_name );
+	}
+	if( item_name != NULL )
+	{
+		memory_free(
+		 item_name );
+	}
+	return( -1 );
+}
+
+/* Exports the stream data of an item
+ * The stream data file is closed afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_stream_data(
+     export_handle_t *export_handle,
+     libolecf_item_t *item,
+     libcfile_file_t *stream_data_file,
+     libcerror_error_t **error )
+{
+	uint8_t *buffer            = NULL;
+	static char *function      = "export_handle_export_stream_data";
+	size_t buffer_size         = EXPORT_HANDLE_BUFFER_SIZE;
+	size_t read_size           = 0;
+	ssize_t read_count         = 0;
+	ssize_t write_count        = 0;
+	off64_t stream_data_offset = 0;
+	uint32_t stream_data_size  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream_data_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream data file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libolecf_item_get_size(
+	     item,
+	     &stream_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve item stream data size.",
+		 function );
+
+		goto on_error;
+	}
 	if( stream_data_size > 0 )
 	{
 		buffer = (uint8_t *) memory_allocate(
@@ -1242,10 +1458,11 @@ int export_handle_export_item(
 			{
 				read_size = stream_data_size;
 			}
-			read_count = libolecf_stream_read_buffer(
+			read_count = libolecf_stream_read_buffer_at_offset_without_seek(
 			              item,
 			              buffer,
 			              read_size,
+			              stream_data_offset,
 			              error );
 
 			if( read_count != (ssize_t) read_size )
@@ -1259,7 +1476,8 @@ int export_handle_export_item(
 
 				goto on_error;
 			}
-			stream_data_size -= read_size;
+			stream_data_offset += read_size;
+			stream_data_size   -= read_size;
 
 			write_count = libcfile_file_write_buffer(
 			               stream_data_file,
@@ -1297,78 +1515,274 @@ int export_handle_export_item(
 
 		goto on_error;
 	}
-	if( libcfile_file_free(
-	     &stream_data_file,
-	     error ) != 1 )
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+/* Frees a stream data job
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_stream_data_job_free(
+     export_handle_stream_data_job_t **stream_data_job,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_stream_data_job_free";
+	int result            = 1;
+
+	if( stream_data_job == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free stream data file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream data job.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	/* Export the sub items
+	if( *stream_data_job != NULL )
+	{
+		if( ( *stream_data_job )->stream_data_file != NULL )
+		{
+			if( libcfile_file_free(
+			     &( ( *stream_data_job )->stream_data_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free stream data file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *stream_data_job )->item != NULL )
+		{
+			if( libolecf_item_free(
+			     &( ( *stream_data_job )->item ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free item.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *stream_data_job );
+
+		*stream_data_job = NULL;
+	}
+	return( result );
+}
+
+/* Exports the stream data of a stream data job
+ * This function is called by the threads of the stream data thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_stream_data_job_callback(
+     export_handle_stream_data_job_t *stream_data_job,
+     export_handle_t *export_handle )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "export_handle_export_stream_data_job_callback";
+	int result               = 1;
+
+	if( stream_data_job == NULL )
+	{
+		return( -1 );
+	}
+	/* Failing to export the stream data of an item does not stop the export
+	 * of the other items, which is the same as the single-threaded export
 	 */
-	if( export_handle_export_sub_items(
+	if( export_handle_export_stream_data(
 	     export_handle,
-	     item,
-	     item_path,
-	     item_path_size - 1,
-	     log_handle,
-	     error ) != 1 )
+	     stream_data_job->item,
+	     stream_data_job->stream_data_file,
+	     &error ) != 1 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_OUTPUT,
-		 LIBCERROR_OUTPUT_ERROR_GENERIC,
-		 "%s: unable to export sub items.",
-		 function );
+		fprintf(
+		 stdout,
+		 "Unable to export stream data of item: %d.\n",
+		 stream_data_job->item_index + 1 );
 
-		goto on_error;
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to export stream data of item: %d.\n",
+			 function,
+			 stream_data_job->item_index + 1 );
+		}
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+
+		log_handle_printf(
+		 stream_data_job->log_handle,
+		 "Unable to export stream data of item: %d.\n",
+		 stream_data_job->item_index + 1 );
 	}
-	memory_free(
-	 item_path );
+	if( export_handle_stream_data_job_free(
+	     &stream_data_job,
+	     &error ) != 1 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
 
-	item_path = NULL;
+		result = -1;
+	}
+	return( result );
+}
 
-	return( 1 );
+/* Exports the stream data of an item or queues it to be exported by the stream data thread pool
+ * The item and stream data file are freed or passed on to the stream data thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_queue_stream_data(
+     export_handle_t *export_handle,
+     libolecf_item_t **item,
+     int item_index,
+     libcfile_file_t **stream_data_file,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	export_handle_stream_data_job_t *stream_data_job = NULL;
+	static char *function                            = "export_handle_queue_stream_data";
+	int result                                       = 0;
 
-on_error:
-	if( buffer != NULL )
+	if( export_handle == NULL )
 	{
-		memory_free(
-		 buffer );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
 	}
-	if( stream_data_file != NULL )
+	if( item == NULL )
 	{
-		libcfile_file_free(
-		 &stream_data_file,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
 	}
-	if( target_path != NULL )
+	if( stream_data_file == NULL )
 	{
-		memory_free(
-		 target_path );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream data file.",
+		 function );
+
+		return( -1 );
 	}
-	if( item_path != NULL )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->stream_data_thread_pool != NULL )
 	{
-		memory_free(
-		 item_path );
+		stream_data_job = memory_allocate_structure(
+		                   export_handle_stream_data_job_t );
+
+		if( stream_data_job == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create stream data job.",
+			 function );
+
+			goto on_error;
+		}
+		stream_data_job->item             = *item;
+		stream_data_job->item_index       = item_index;
+		stream_data_job->stream_data_file = *stream_data_file;
+		stream_data_job->log_handle       = log_handle;
+
+		*item             = NULL;
+		*stream_data_file = NULL;
+
+		if( libcthreads_thread_pool_push(
+		     export_handle->stream_data_thread_pool,
+		     (intptr_t *) stream_data_job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push stream data job onto thread pool queue.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
 	}
-	if( sanitized_name != NULL )
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	result = export_handle_export_stream_data(
+	          export_handle,
+	          *item,
+	          *stream_data_file,
+	          error );
+
+	if( result != 1 )
 	{
-		memory_free(
-		 sanitized_name );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+		 LIBCERROR_OUTPUT_ERROR_GENERIC,
+		 "%s: unable to export stream data of item: %d.",
+		 function,
+		 item_index + 1 );
 	}
-	if( item_name != NULL )
+	if( libcfile_file_free(
+	     stream_data_file,
+	     error ) != 1 )
 	{
-		memory_free(
-		 item_name );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free stream data file.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	if( stream_data_job != NULL )
+	{
+		export_handle_stream_data_job_free(
+		 &stream_data_job,
+		 NULL );
 	}
 	return( -1 );
+#endif
 }
 
 /* Exports the sub items
@@ -1382,10 +1796,12 @@ int export_handle_export_sub_items(
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	libolecf_item_t *sub_item = NULL;
-	static char *function     = "export_handle_export_sub_items";
-	int number_of_sub_items   = 0;
-	int sub_item_iterator     = 0;
+	libcfile_file_t *stream_data_file = NULL;
+	libolecf_item_t *sub_item         = NULL;
+	static char *function             = "export_handle_export_sub_items";
+	int number_of_sub_items           = 0;
+	int result                        = 0;
+	int sub_item_iterator             = 0;
 
 	if( export_handle == NULL )
 	{
@@ -1454,15 +1870,29 @@ int export_handle_export_sub_items(
 
 			return( -1 );
 		}
-		if( export_handle_export_item(
-		     export_handle,
-		     sub_item,
-		     sub_item_iterator,
-		     number_of_sub_items,
-		     export_path,
-		     export_path_length,
-		     log_handle,
-		     error ) != 1 )
+		result = export_handle_export_item(
+		          export_handle,
+		          sub_item,
+		          sub_item_iterator,
+		          number_of_sub_items,
+		          export_path,
+		          export_path_length,
+		          &stream_data_file,
+		          log_handle,
+		          error );
+
+		if( ( result == 1 )
+		 && ( stream_data_file != NULL ) )
+		{
+			result = export_handle_queue_stream_data(
+			          export_handle,
+			          &sub_item,
+			          sub_item_iterator,
+			          &stream_data_file,
+			          log_handle,
+			          error );
+		}
+		if( result != 1 )
 		{
 			fprintf(
 			 stdout,
@@ -1491,22 +1921,52 @@ int export_handle_export_sub_items(
 			 "Unable to export sub item: %d.\n",
 			 sub_item_iterator + 1 );
 		}
-		if( libolecf_item_free(
-		     &sub_item,
-		     error ) != 1 )
+		if( stream_data_file != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free sub item: %d.",
-			 function,
-			 sub_item_iterator + 1 );
+			if( libcfile_file_free(
+			     &stream_data_file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free stream data file.",
+				 function );
 
-			return( -1 );
+				goto on_error;
+			}
+		}
+		/* The sub item is NULL if it was passed on to the stream data thread pool
+		 */
+		if( sub_item != NULL )
+		{
+			if( libolecf_item_free(
+			     &sub_item,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sub item: %d.",
+				 function,
+				 sub_item_iterator + 1 );
+
+				goto on_error;
+			}
 		}
 	}
 	return( 1 );
+
+on_error:
+	if( sub_item != NULL )
+	{
+		libolecf_item_free(
+		 &sub_item,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Exports the file
@@ -1582,6 +2042,29 @@ int export_handle_export_file(
 	{
 		return( 1 );
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->number_of_threads > 0 )
+	{
+		if( libcthreads_thread_pool_create(
+		     &( export_handle->stream_data_thread_pool ),
+		     NULL,
+		     export_handle->number_of_threads,
+		     EXPORT_HANDLE_MAXIMUM_NUMBER_OF_QUEUED_STREAM_DATA_JOBS,
+		     (int (*)(intptr_t *, void *)) &export_handle_export_stream_data_job_callback,
+		     (void *) export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create stream data thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
 	if( export_handle_export_sub_items(
 	     export_handle,
 	     root_item,
@@ -1599,6 +2082,26 @@ int export_handle_export_file(
 
 		goto on_error;
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->stream_data_thread_pool != NULL )
+	{
+		/* Wait for the queued stream data jobs to finish
+		 */
+		if( libcthreads_thread_pool_join(
+		     &( export_handle->stream_data_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join stream data thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
 	if( libolecf_item_free(
 	     &root_item,
 	     error ) != 1 )
@@ -1615,6 +2118,14 @@ int export_handle_export_file(
 	return( 1 );
 
 on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->stream_data_thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &( export_handle->stream_data_thread_pool ),
+		 NULL );
+	}
+#endif
 	if( root_item != NULL )
 	{
 		libolecf_item_free(
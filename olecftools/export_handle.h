@@ -27,6 +27,8 @@
 
 #include "log_handle.h"
 #include "olecftools_libcerror.h"
+#include "olecftools_libcfile.h"
+#include "olecftools_libcthreads.h"
 #include "olecftools_libolecf.h"
 
 #if defined( __cplusplus )
@@ -34,6 +36,7 @@ extern "C" {
 #endif
 
 typedef struct export_handle export_handle_t;
+typedef struct export_handle_stream_data_job export_handle_stream_data_job_t;
 
 struct export_handle
 {
@@ -61,11 +64,40 @@ struct export_handle
 	 */
 	int ascii_codepage;
 
+	/* The number of threads used to export stream data
+	 */
+	int number_of_threads;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The stream data thread pool
+	 */
+	libcthreads_thread_pool_t *stream_data_thread_pool;
+#endif
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
 };
 
+struct export_handle_stream_data_job
+{
+	/* The item
+	 */
+	libolecf_item_t *item;
+
+	/* The item index
+	 */
+	int item_index;
+
+	/* The stream data file
+	 */
+	libcfile_file_t *stream_data_file;
+
+	/* The log handle
+	 */
+	log_handle_t *log_handle;
+};
+
 int export_handle_initialize(
      export_handle_t **export_handle,
      libcerror_error_t **error );
@@ -83,6 +115,11 @@ int export_handle_set_ascii_codepage(
      const system_character_t *string,
      libcerror_error_t **error );
 
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int export_handle_set_target_path(
      export_handle_t *export_handle,
      const system_character_t *target_path,
@@ -118,6 +155,29 @@ int export_handle_export_item(
      int number_of_items,
      const system_character_t *export_path,
      size_t export_path_length,
+     libcfile_file_t **stream_data_file,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_handle_export_stream_data(
+     export_handle_t *export_handle,
+     libolecf_item_t *item,
+     libcfile_file_t *stream_data_file,
+     libcerror_error_t **error );
+
+int export_handle_stream_data_job_free(
+     export_handle_stream_data_job_t **stream_data_job,
+     libcerror_error_t **error );
+
+int export_handle_export_stream_data_job_callback(
+     export_handle_stream_data_job_t *stream_data_job,
+     export_handle_t *export_handle );
+
+int export_handle_queue_stream_data(
+     export_handle_t *export_handle,
+     libolecf_item_t **item,
+     int item_index,
+     libcfile_file_t **stream_data_file,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
@@ -895,7 +895,7 @@ ssize_t mount_file_entry_read_buffer_at_offset(
 
 		return( -1 );
 	}
-	read_count = libolecf_stream_read_buffer_at_offset(
+	read_count = libolecf_stream_read_buffer_at_offset_without_seek(
 	              file_entry->olecf_item,
 	              buffer,
 	              buffer_size,
@@ -490,7 +490,11 @@ int mount_file_system_get_filename_from_item(
      size_t *filename_size,
      libcerror_error_t **error )
 {
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	system_character_t *item_name = NULL;
+#else
+	const uint8_t *item_name      = NULL;
+#endif
 	static char *function         = "mount_file_system_get_filename_from_item";
 	size_t item_name_size         = 0;
 	int result                    = 0;
@@ -512,8 +516,11 @@ int mount_file_system_get_filename_from_item(
 	          &item_name_size,
 	          error );
 #else
-	result = libolecf_item_get_utf8_name_size(
+	/* The UTF-8 name is cached by the library hence no copy is needed
+	 */
+	result = libolecf_item_get_utf8_name_pointer(
 	          olecf_item,
+	          &item_name,
 	          &item_name_size,
 	          error );
 #endif
@@ -540,6 +547,7 @@ int mount_file_system_get_filename_from_item(
 
 		goto on_error;
 	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	item_name = system_string_allocate(
 	             item_name_size );
 
@@ -554,19 +562,12 @@ int mount_file_system_get_filename_from_item(
 
 		goto on_error;
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	result = libolecf_item_get_utf16_name(
 	          olecf_item,
 	          (uint16_t *) item_name,
 	          item_name_size,
 	          error );
-#else
-	result = libolecf_item_get_utf8_name(
-	          olecf_item,
-	          (uint8_t *) item_name,
-	          item_name_size,
-	          error );
-#endif
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -578,10 +579,11 @@ int mount_file_system_get_filename_from_item(
 
 		goto on_error;
 	}
+#endif
 	if( mount_path_string_copy_from_item_path(
 	     filename,
 	     filename_size,
-	     item_name,
+	     (const system_character_t *) item_name,
 	     item_name_size - 1,
 	     error ) != 1 )
 	{
@@ -594,17 +596,20 @@ int mount_file_system_get_filename_from_item(
 
 		goto on_error;
 	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	memory_free(
 	 item_name );
-
+#endif
 	return( 1 );
 
 on_error:
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	if( item_name != NULL )
 	{
 		memory_free(
 		 item_name );
 	}
+#endif
 	return( -1 );
 }
 
@@ -312,13 +312,13 @@ int mount_handle_open(
 	result = libolecf_file_open_wide(
 	          olecf_file,
 	          filename,
-	          LIBOLECF_OPEN_READ,
+	          LIBOLECF_OPEN_READ_AHEAD,
 	          error );
 #else
 	result = libolecf_file_open(
 	          olecf_file,
 	          filename,
-	          LIBOLECF_OPEN_READ,
+	          LIBOLECF_OPEN_READ_AHEAD,
 	          error );
 #endif
 	if( result == -1 )
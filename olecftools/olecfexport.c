@@ -117,6 +117,9 @@ int main( int argc, char * const argv[] )
 	olecftools_option_t options[ ] = {
 		{ 'c', "codepage", "codepage of ASCII strings, options: ascii, windows-874, windows-932, windows-936, windows-949, windows-950, windows-1250, windows-1251, windows-1252 (default), windows-1253, windows-1254, windows-1255, windows-1256, windows-1257 or windows-1258" },
 		{ 'h', NULL, "shows this help" },
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		{ 'j', "jobs", "number of concurrent jobs (threads) used to export stream data, where 0 represents single-threaded mode (default is 0)" },
+#endif
 		{ 'l', "log_file", "logs information about the exported items" },
 		{ 't', "target", "specify the target directory to export to (default is the source filename followed by .export)" },
 		{ 'v', NULL, "verbose output to stderr" },
@@ -125,19 +128,20 @@ int main( int argc, char * const argv[] )
 	};
 	system_character_t options_string[ 32 ];
 
-	libcerror_error_t *error               = NULL;
-	log_handle_t *log_handle               = NULL;
-	system_character_t *log_filename       = NULL;
-	system_character_t *option_codepage    = NULL;
-	system_character_t *option_target_path = NULL;
-	system_character_t *path_separator     = NULL;
-	system_character_t *source             = NULL;
-	char *program                          = "olecfexport";
-	system_integer_t option                = 0;
-	size_t source_length                   = 0;
-	int number_of_options                  = (int) ( sizeof( options ) / sizeof( olecftools_option_t ) );
-	int result                             = 0;
-	int verbose                            = 0;
+	libcerror_error_t *error                     = NULL;
+	log_handle_t *log_handle                     = NULL;
+	system_character_t *log_filename             = NULL;
+	system_character_t *option_codepage          = NULL;
+	system_character_t *option_number_of_threads = NULL;
+	system_character_t *option_target_path       = NULL;
+	system_character_t *path_separator           = NULL;
+	system_character_t *source                   = NULL;
+	char *program                                = "olecfexport";
+	system_integer_t option                      = 0;
+	size_t source_length                         = 0;
+	int number_of_options                        = (int) ( sizeof( options ) / sizeof( olecftools_option_t ) );
+	int result                                   = 0;
+	int verbose                                  = 0;
 
 #if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
 	_setmode( _fileno( stdout ), _O_BINARY );
@@ -224,6 +228,13 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			case (system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+#endif
+
 			case (system_integer_t) 'l':
 				log_filename = optarg;
 
@@ -380,6 +391,28 @@ int main( int argc, char * const argv[] )
 			 "Unsupported ASCII codepage defaulting to: windows-1252.\n" );
 		}
 	}
+	if( option_number_of_threads != NULL )
+	{
+		result = export_handle_set_number_of_threads(
+		          olecfexport_export_handle,
+		          option_number_of_threads,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of jobs in export handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of jobs defaulting to: 0.\n" );
+		}
+	}
 	fprintf(
 	 stdout,
 	 "Opening file.\n" );
@@ -0,0 +1,466 @@
+/*
+ * Scans OLE Compound Files and writes an inventory record for every file
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include <stdio.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "olecftools_getopt.h"
+#include "olecftools_libcerror.h"
+#include "olecftools_libclocale.h"
+#include "olecftools_libcnotify.h"
+#include "olecftools_libolecf.h"
+#include "olecftools_output.h"
+#include "olecftools_signal.h"
+#include "olecftools_unused.h"
+#include "scan_handle.h"
+
+scan_handle_t *olecfscan_scan_handle = NULL;
+int olecfscan_abort                  = 0;
+
+/* Signal handler for olecfscan
+ */
+void olecfscan_signal_handler(
+      olecftools_signal_t signal OLECFTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "olecfscan_signal_handler";
+
+	OLECFTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	olecfscan_abort = 1;
+
+	if( olecfscan_scan_handle != NULL )
+	{
+		if( scan_handle_signal_abort(
+		     olecfscan_scan_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal scan handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use olecfscan to scan OLE Compound Files and write an inventory record, in JSON, for every file.";
+
+	olecftools_option_t options[ ] = {
+		{ 'c', "codepage", "codepage of ASCII strings, options: ascii, windows-874, windows-932, windows-936, windows-949, windows-950, windows-1250, windows-1251, windows-1252 (default), windows-1253, windows-1254, windows-1255, windows-1256, windows-1257 or windows-1258" },
+		{ 'f', "file_list", "file that contains the sources to scan, one per line, use - to read the sources from stdin" },
+		{ 'h', NULL, "shows this help" },
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		{ 'j', "jobs", "number of concurrent jobs (threads) used to scan the sources, where 0 represents single-threaded mode (default is 0)" },
+#endif
+		{ 'o', "output_file", "write the records to the output file instead of stdout" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "source", "the source files" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libcerror_error_t *error                     = NULL;
+	system_character_t *option_codepage          = NULL;
+	system_character_t *option_file_list         = NULL;
+	system_character_t *option_number_of_threads = NULL;
+	system_character_t *option_output_file       = NULL;
+	char *program                                = "olecfscan";
+	system_integer_t option                      = 0;
+	int number_of_options                        = (int) ( sizeof( options ) / sizeof( olecftools_option_t ) );
+	int result                                   = 0;
+	int verbose                                  = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "olecftools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( olecftools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	/* The records are written to stdout by default, so the version is written to stderr
+	 */
+	olecftools_output_version_fprint(
+	 stderr,
+	 program );
+
+	if( olecftools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = olecftools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				olecftools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				option_codepage = optarg;
+
+				break;
+
+			case (system_integer_t) 'f':
+				option_file_list = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				olecftools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			case (system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+#endif
+
+			case (system_integer_t) 'o':
+				option_output_file = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				olecftools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( ( optind == argc )
+	 && ( option_file_list == NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file or file list.\n" );
+
+		olecftools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_verbose_set(
+	 verbose );
+	libolecf_notify_set_stream(
+	 stderr,
+	 NULL );
+	libolecf_notify_set_verbose(
+	 verbose );
+
+	if( scan_handle_initialize(
+	     &olecfscan_scan_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize scan handle.\n" );
+
+		goto on_error;
+	}
+#if defined( __clang_analyzer__ )
+	__builtin_assume( olecfscan_scan_handle != NULL );
+#endif
+	if( olecftools_signal_attach(
+	     olecfscan_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( option_codepage != NULL )
+	{
+		result = scan_handle_set_ascii_codepage(
+		          olecfscan_scan_handle,
+		          option_codepage,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set ASCII codepage in scan handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported ASCII codepage defaulting to: windows-1252.\n" );
+		}
+	}
+	if( option_number_of_threads != NULL )
+	{
+		result = scan_handle_set_number_of_threads(
+		          olecfscan_scan_handle,
+		          option_number_of_threads,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of jobs in scan handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of jobs defaulting to: 0.\n" );
+		}
+	}
+	while( optind < argc )
+	{
+		if( scan_handle_append_source(
+		     olecfscan_scan_handle,
+		     argv[ optind ],
+		     system_string_length(
+		      argv[ optind ] ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to append source: %" PRIs_SYSTEM ".\n",
+			 argv[ optind ] );
+
+			goto on_error;
+		}
+		optind++;
+	}
+	if( option_file_list != NULL )
+	{
+		if( scan_handle_read_source_list(
+		     olecfscan_scan_handle,
+		     option_file_list,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read file list: %" PRIs_SYSTEM ".\n",
+			 option_file_list );
+
+			goto on_error;
+		}
+	}
+	if( option_output_file != NULL )
+	{
+		if( scan_handle_open_output(
+		     olecfscan_scan_handle,
+		     option_output_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open output file: %" PRIs_SYSTEM ".\n",
+			 option_output_file );
+
+			goto on_error;
+		}
+	}
+	if( scan_handle_scan_sources(
+	     olecfscan_scan_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to scan sources.\n" );
+
+		goto on_error;
+	}
+	if( scan_handle_close_output(
+	     olecfscan_scan_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close output file.\n" );
+
+		goto on_error;
+	}
+	if( olecftools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_handle_free(
+	     &olecfscan_scan_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free scan handle.\n" );
+
+		goto on_error;
+	}
+	if( olecfscan_abort != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Scan aborted.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( olecfscan_scan_handle != NULL )
+	{
+		scan_handle_free(
+		 &olecfscan_scan_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1391 @@
+/*
+ * Scan handle
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "olecftools_libcerror.h"
+#include "olecftools_libclocale.h"
+#include "olecftools_libcnotify.h"
+#include "olecftools_libcthreads.h"
+#include "olecftools_libolecf.h"
+#include "scan_handle.h"
+#include "scan_worker.h"
+
+#define SCAN_HANDLE_NOTIFY_STREAM			stderr
+#define SCAN_HANDLE_MAXIMUM_NUMBER_OF_THREADS		64
+#define SCAN_HANDLE_MAXIMUM_SOURCE_LENGTH		4096
+#define SCAN_HANDLE_INITIAL_MAXIMUM_NUMBER_OF_SOURCES	256
+
+/* Creates a scan handle
+ * Make sure the value scan_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_initialize(
+     scan_handle_t **scan_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_initialize";
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*scan_handle = memory_allocate_structure(
+	                scan_handle_t );
+
+	if( *scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *scan_handle,
+	     0,
+	     sizeof( scan_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *scan_handle )->ascii_codepage = LIBOLECF_CODEPAGE_WINDOWS_1252;
+	( *scan_handle )->output_stream  = stdout;
+	( *scan_handle )->notify_stream  = SCAN_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *scan_handle != NULL )
+	{
+		memory_free(
+		 *scan_handle );
+
+		*scan_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a scan handle
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_free(
+     scan_handle_t **scan_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_free";
+	int result            = 1;
+	int source_index      = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_handle != NULL )
+	{
+		if( ( *scan_handle )->output_stream_is_open != 0 )
+		{
+			if( scan_handle_close_output(
+			     *scan_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close output.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *scan_handle )->sources != NULL )
+		{
+			for( source_index = 0;
+			     source_index < ( *scan_handle )->number_of_sources;
+			     source_index++ )
+			{
+				memory_free(
+				 ( *scan_handle )->sources[ source_index ] );
+			}
+			memory_free(
+			 ( *scan_handle )->sources );
+		}
+		memory_free(
+		 *scan_handle );
+
+		*scan_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the scan handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_signal_abort(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_signal_abort";
+	int worker_index      = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	scan_handle->abort = 1;
+
+	if( scan_handle->workers != NULL )
+	{
+		for( worker_index = 0;
+		     worker_index < scan_handle->number_of_workers;
+		     worker_index++ )
+		{
+			if( scan_handle->workers[ worker_index ] == NULL )
+			{
+				continue;
+			}
+			if( scan_worker_signal_abort(
+			     scan_handle->workers[ worker_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to signal worker: %d to abort.",
+				 function,
+				 worker_index );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the ascii codepage
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_set_ascii_codepage(
+     scan_handle_t *scan_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function  = "scan_handle_set_ascii_codepage";
+	size_t string_length   = 0;
+	uint32_t feature_flags = 0;
+	int result             = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	feature_flags = LIBCLOCALE_CODEPAGE_FEATURE_FLAG_HAVE_KOI8
+	              | LIBCLOCALE_CODEPAGE_FEATURE_FLAG_HAVE_WINDOWS;
+
+	string_length = system_string_length(
+	                 string );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libclocale_codepage_copy_from_string_wide(
+	          &( scan_handle->ascii_codepage ),
+	          string,
+	          string_length,
+	          feature_flags,
+	          error );
+#else
+	result = libclocale_codepage_copy_from_string(
+	          &( scan_handle->ascii_codepage ),
+	          string,
+	          string_length,
+	          feature_flags,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sets the number of threads used to scan the sources
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int scan_handle_set_number_of_threads(
+     scan_handle_t *scan_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_set_number_of_threads";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	int number_of_threads = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 0 )
+	 || ( string_length > 2 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		number_of_threads *= 10;
+		number_of_threads += (int) ( string[ string_index ] - (system_character_t) '0' );
+	}
+	if( number_of_threads > SCAN_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+	{
+		return( 0 );
+	}
+	scan_handle->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Opens the output file
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_open_output(
+     scan_handle_t *scan_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_open_output";
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_handle->output_stream_is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan handle - output stream already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	scan_handle->output_stream = file_stream_open_wide(
+	                              filename,
+	                              _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	scan_handle->output_stream = file_stream_open(
+	                              filename,
+	                              FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( scan_handle->output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output file.",
+		 function );
+
+		scan_handle->output_stream = stdout;
+
+		return( -1 );
+	}
+	scan_handle->output_stream_is_open = 1;
+
+	return( 1 );
+}
+
+/* Closes the output file
+ * Returns the 0 if successful or -1 on error
+ */
+int scan_handle_close_output(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_close_output";
+	int result            = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_handle->output_stream_is_open != 0 )
+	{
+		if( file_stream_close(
+		     scan_handle->output_stream ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close output stream.",
+			 function );
+
+			result = -1;
+		}
+		scan_handle->output_stream         = stdout;
+		scan_handle->output_stream_is_open = 0;
+	}
+	return( result );
+}
+
+/* Appends a source
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_append_source(
+     scan_handle_t *scan_handle,
+     const system_character_t *source,
+     size_t source_length,
+     libcerror_error_t **error )
+{
+	system_character_t **sources    = NULL;
+	system_character_t *source_copy = NULL;
+	static char *function           = "scan_handle_append_source";
+	size_t sources_size             = 0;
+	int maximum_number_of_sources   = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( source_length == 0 )
+	 || ( source_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_handle->number_of_sources >= scan_handle->maximum_number_of_sources )
+	{
+		if( scan_handle->maximum_number_of_sources == 0 )
+		{
+			maximum_number_of_sources = SCAN_HANDLE_INITIAL_MAXIMUM_NUMBER_OF_SOURCES;
+		}
+		else if( scan_handle->maximum_number_of_sources <= ( INT_MAX / 2 ) )
+		{
+			maximum_number_of_sources = scan_handle->maximum_number_of_sources * 2;
+		}
+		sources_size = (size_t) maximum_number_of_sources * sizeof( system_character_t * );
+
+		if( ( maximum_number_of_sources == 0 )
+		 || ( sources_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid maximum number of sources value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		sources = (system_character_t **) memory_reallocate(
+		                                   scan_handle->sources,
+		                                   sources_size );
+
+		if( sources == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize sources.",
+			 function );
+
+			return( -1 );
+		}
+		scan_handle->sources                   = sources;
+		scan_handle->maximum_number_of_sources = maximum_number_of_sources;
+	}
+	source_copy = system_string_allocate(
+	               source_length + 1 );
+
+	if( source_copy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create source.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     source_copy,
+	     source,
+	     source_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source.",
+		 function );
+
+		memory_free(
+		 source_copy );
+
+		return( -1 );
+	}
+	source_copy[ source_length ] = 0;
+
+	scan_handle->sources[ scan_handle->number_of_sources ] = source_copy;
+
+	scan_handle->number_of_sources += 1;
+
+	return( 1 );
+}
+
+/* Reads the sources from a source list file that contains one source per line
+ * A filename of "-" reads the source list from stdin
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_read_source_list(
+     scan_handle_t *scan_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	system_character_t source[ SCAN_HANDLE_MAXIMUM_SOURCE_LENGTH ];
+
+	FILE *source_list_stream = NULL;
+	static char *function    = "scan_handle_read_source_list";
+	size_t source_length     = 0;
+	int line_number          = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename[ 0 ] == (system_character_t) '-' )
+	 && ( filename[ 1 ] == 0 ) )
+	{
+		source_list_stream = stdin;
+	}
+	else
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		source_list_stream = file_stream_open_wide(
+		                      filename,
+		                      _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+		source_list_stream = file_stream_open(
+		                      filename,
+		                      FILE_STREAM_OPEN_READ );
+#endif
+		if( source_list_stream == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open source list file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( scan_handle->abort == 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( file_stream_get_string_wide(
+		     source_list_stream,
+		     source,
+		     SCAN_HANDLE_MAXIMUM_SOURCE_LENGTH ) == NULL )
+#else
+		if( file_stream_get_string(
+		     source_list_stream,
+		     source,
+		     SCAN_HANDLE_MAXIMUM_SOURCE_LENGTH ) == NULL )
+#endif
+		{
+			break;
+		}
+		line_number++;
+
+		source_length = system_string_length(
+		                 source );
+
+		if( ( source_length > 0 )
+		 && ( source[ source_length - 1 ] != (system_character_t) '\n' )
+		 && ( file_stream_at_end(
+		       source_list_stream ) == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid source on line: %d value exceeds maximum.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		while( ( source_length > 0 )
+		    && ( ( source[ source_length - 1 ] == (system_character_t) '\n' )
+		     ||  ( source[ source_length - 1 ] == (system_character_t) '\r' ) ) )
+		{
+			source_length--;
+		}
+		if( source_length == 0 )
+		{
+			continue;
+		}
+		if( scan_handle_append_source(
+		     scan_handle,
+		     source,
+		     source_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source on line: %d.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+	}
+	if( source_list_stream != stdin )
+	{
+		if( file_stream_close(
+		     source_list_stream ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close source list file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( ( source_list_stream != NULL )
+	 && ( source_list_stream != stdin ) )
+	{
+		file_stream_close(
+		 source_list_stream );
+	}
+	return( -1 );
+}
+
+/* Retrieves the index of the next source to be scanned by a worker
+ * The worker first consumes its own range of sources, when that is exhausted
+ * it takes over the upper half of the largest range of the other workers
+ * Returns 1 if successful, 0 if no sources remain or -1 on error
+ */
+int scan_handle_get_next_source_index(
+     scan_handle_t *scan_handle,
+     scan_worker_t *scan_worker,
+     int *source_index,
+     libcerror_error_t **error )
+{
+	scan_worker_t *victim_worker    = NULL;
+	static char *function           = "scan_handle_get_next_source_index";
+	int maximum_number_of_sources   = 0;
+	int number_of_remaining_sources = 0;
+	int number_of_stolen_sources    = 0;
+	int result                      = 0;
+	int worker_index                = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( scan_handle->sources_mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     scan_handle->sources_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab sources mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( scan_handle->abort == 0 )
+	{
+		if( scan_worker->next_source_index >= scan_worker->end_source_index )
+		{
+			for( worker_index = 0;
+			     worker_index < scan_handle->number_of_workers;
+			     worker_index++ )
+			{
+				if( scan_handle->workers[ worker_index ] == scan_worker )
+				{
+					continue;
+				}
+				number_of_remaining_sources = scan_handle->workers[ worker_index ]->end_source_index
+				                            - scan_handle->workers[ worker_index ]->next_source_index;
+
+				if( number_of_remaining_sources > maximum_number_of_sources )
+				{
+					victim_worker             = scan_handle->workers[ worker_index ];
+					maximum_number_of_sources = number_of_remaining_sources;
+				}
+			}
+			if( victim_worker != NULL )
+			{
+				/* Leave the lower half of the range to the victim worker, which is
+				 * consuming it from the start, and take over the upper half
+				 */
+				number_of_stolen_sources = ( maximum_number_of_sources + 1 ) / 2;
+
+				scan_worker->end_source_index   = victim_worker->end_source_index;
+				scan_worker->next_source_index  = victim_worker->end_source_index - number_of_stolen_sources;
+				victim_worker->end_source_index = scan_worker->next_source_index;
+			}
+		}
+		if( scan_worker->next_source_index < scan_worker->end_source_index )
+		{
+			*source_index = scan_worker->next_source_index;
+
+			scan_worker->next_source_index += 1;
+
+			result = 1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( scan_handle->sources_mutex != NULL )
+	{
+		if( libcthreads_mutex_release(
+		     scan_handle->sources_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release sources mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( result );
+}
+
+/* Writes the record of a worker to the output stream
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_write_record(
+     scan_handle_t *scan_handle,
+     scan_worker_t *scan_worker,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_write_record";
+	size_t write_count    = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan worker.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( scan_handle->output_mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     scan_handle->output_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab output mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	write_count = file_stream_write(
+	               scan_handle->output_stream,
+	               scan_worker->record->data,
+	               scan_worker->record->data_offset );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( scan_handle->output_mutex != NULL )
+	{
+		if( libcthreads_mutex_release(
+		     scan_handle->output_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release output mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( write_count != scan_worker->record->data_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees the workers
+ * The thread of a worker that is still running is joined first
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_free_workers(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_free_workers";
+	int result            = 1;
+	int worker_index      = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_handle->workers != NULL )
+	{
+		for( worker_index = 0;
+		     worker_index < scan_handle->number_of_workers;
+		     worker_index++ )
+		{
+			if( scan_worker_free(
+			     &( scan_handle->workers[ worker_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free worker: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 scan_handle->workers );
+
+		scan_handle->workers           = NULL;
+		scan_handle->number_of_workers = 0;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( scan_handle->output_mutex != NULL )
+	{
+		if( libcthreads_mutex_free(
+		     &( scan_handle->output_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output mutex.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( scan_handle->sources_mutex != NULL )
+	{
+		if( libcthreads_mutex_free(
+		     &( scan_handle->sources_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sources mutex.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	return( result );
+}
+
+/* Scans sources until none remain
+ * This function is called by the thread of every worker
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_scan_sources_callback(
+     scan_worker_t *scan_worker )
+{
+	libcerror_error_t *error   = NULL;
+	scan_handle_t *scan_handle = NULL;
+	static char *function      = "scan_handle_scan_sources_callback";
+	int result                 = 0;
+	int source_index           = 0;
+
+	if( scan_worker == NULL )
+	{
+		return( -1 );
+	}
+	scan_handle = (scan_handle_t *) scan_worker->scan_handle;
+
+	do
+	{
+		result = scan_handle_get_next_source_index(
+		          scan_handle,
+		          scan_worker,
+		          &source_index,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next source.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( scan_worker_scan_file(
+			     scan_worker,
+			     scan_handle->sources[ source_index ],
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan source: %d.",
+				 function,
+				 source_index );
+
+				goto on_error;
+			}
+			if( scan_handle_write_record(
+			     scan_handle,
+			     scan_worker,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write record of source: %d.",
+				 function,
+				 source_index );
+
+				goto on_error;
+			}
+		}
+	}
+	while( result != 0 );
+
+	return( 1 );
+
+on_error:
+	scan_worker->has_failed = 1;
+
+	libcnotify_print_error_backtrace(
+	 error );
+	libcerror_error_free(
+	 &error );
+
+	return( -1 );
+}
+
+/* Scans the sources
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_scan_sources(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error )
+{
+	static char *function           = "scan_handle_scan_sources";
+	size_t workers_size             = 0;
+	int has_failed                  = 0;
+	int number_of_failed_files      = 0;
+	int number_of_scanned_files     = 0;
+	int number_of_unsupported_files = 0;
+	int number_of_workers           = 0;
+	int worker_index                = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_handle->workers != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan handle - workers value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_handle->number_of_sources == 0 )
+	{
+		return( 1 );
+	}
+	number_of_workers = scan_handle->number_of_threads;
+
+	if( number_of_workers == 0 )
+	{
+		number_of_workers = 1;
+	}
+	else if( number_of_workers > scan_handle->number_of_sources )
+	{
+		number_of_workers = scan_handle->number_of_sources;
+	}
+	workers_size = sizeof( scan_worker_t * ) * number_of_workers;
+
+	scan_handle->workers = (scan_worker_t **) memory_allocate(
+	                                           workers_size );
+
+	if( scan_handle->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     scan_handle->workers,
+	     0,
+	     workers_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		goto on_error;
+	}
+	scan_handle->number_of_workers = number_of_workers;
+
+	/* Every worker starts with a contiguous range of the sources
+	 */
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( scan_worker_initialize(
+		     &( scan_handle->workers[ worker_index ] ),
+		     (intptr_t *) scan_handle,
+		     scan_handle->ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		scan_handle->workers[ worker_index ]->next_source_index = (int) ( ( (int64_t) scan_handle->number_of_sources * worker_index ) / number_of_workers );
+		scan_handle->workers[ worker_index ]->end_source_index  = (int) ( ( (int64_t) scan_handle->number_of_sources * ( worker_index + 1 ) ) / number_of_workers );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( scan_handle->number_of_threads > 0 )
+	{
+		if( libcthreads_mutex_initialize(
+		     &( scan_handle->sources_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create sources mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_mutex_initialize(
+		     &( scan_handle->output_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create output mutex.",
+			 function );
+
+			goto on_error;
+		}
+		for( worker_index = 0;
+		     worker_index < number_of_workers;
+		     worker_index++ )
+		{
+			if( libcthreads_thread_create(
+			     &( scan_handle->workers[ worker_index ]->thread ),
+			     NULL,
+			     (int (*)(void *)) &scan_handle_scan_sources_callback,
+			     (void *) scan_handle->workers[ worker_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread of worker: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+		for( worker_index = 0;
+		     worker_index < number_of_workers;
+		     worker_index++ )
+		{
+			if( libcthreads_thread_join(
+			     &( scan_handle->workers[ worker_index ]->thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread of worker: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	{
+		scan_handle_scan_sources_callback(
+		 scan_handle->workers[ 0 ] );
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( scan_handle->workers[ worker_index ]->has_failed != 0 )
+		{
+			has_failed = 1;
+		}
+		number_of_scanned_files     += scan_handle->workers[ worker_index ]->number_of_scanned_files;
+		number_of_unsupported_files += scan_handle->workers[ worker_index ]->number_of_unsupported_files;
+		number_of_failed_files      += scan_handle->workers[ worker_index ]->number_of_failed_files;
+	}
+	fprintf(
+	 scan_handle->notify_stream,
+	 "Scanned %d of %d files: %d unsupported and %d failed.\n",
+	 number_of_scanned_files,
+	 scan_handle->number_of_sources,
+	 number_of_unsupported_files,
+	 number_of_failed_files );
+
+	if( scan_handle_free_workers(
+	     scan_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free workers.",
+		 function );
+
+		return( -1 );
+	}
+	if( has_failed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan one or more sources.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	/* Make sure the threads that were started stop before their workers are freed
+	 */
+	scan_handle->abort = 1;
+
+	scan_handle_free_workers(
+	 scan_handle,
+	 NULL );
+
+	return( -1 );
+}
+
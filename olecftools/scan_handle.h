@@ -0,0 +1,165 @@
+/*
+ * Scan handle
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SCAN_HANDLE_H )
+#define _SCAN_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "olecftools_libcerror.h"
+#include "olecftools_libcthreads.h"
+#include "scan_worker.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct scan_handle scan_handle_t;
+
+struct scan_handle
+{
+	/* The sources
+	 */
+	system_character_t **sources;
+
+	/* The number of sources
+	 */
+	int number_of_sources;
+
+	/* The maximum number of sources that fit in the sources array
+	 */
+	int maximum_number_of_sources;
+
+	/* The ascii codepage
+	 */
+	int ascii_codepage;
+
+	/* The number of threads used to scan the sources
+	 */
+	int number_of_threads;
+
+	/* The workers
+	 */
+	scan_worker_t **workers;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* The output stream
+	 */
+	FILE *output_stream;
+
+	/* Value to indicate the output stream was opened by the scan handle
+	 */
+	uint8_t output_stream_is_open;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the source ranges of the workers
+	 */
+	libcthreads_mutex_t *sources_mutex;
+
+	/* The mutex that protects the output stream
+	 */
+	libcthreads_mutex_t *output_mutex;
+#endif
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int scan_handle_initialize(
+     scan_handle_t **scan_handle,
+     libcerror_error_t **error );
+
+int scan_handle_free(
+     scan_handle_t **scan_handle,
+     libcerror_error_t **error );
+
+int scan_handle_signal_abort(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error );
+
+int scan_handle_set_ascii_codepage(
+     scan_handle_t *scan_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int scan_handle_set_number_of_threads(
+     scan_handle_t *scan_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int scan_handle_open_output(
+     scan_handle_t *scan_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int scan_handle_close_output(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error );
+
+int scan_handle_append_source(
+     scan_handle_t *scan_handle,
+     const system_character_t *source,
+     size_t source_length,
+     libcerror_error_t **error );
+
+int scan_handle_read_source_list(
+     scan_handle_t *scan_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int scan_handle_get_next_source_index(
+     scan_handle_t *scan_handle,
+     scan_worker_t *scan_worker,
+     int *source_index,
+     libcerror_error_t **error );
+
+int scan_handle_write_record(
+     scan_handle_t *scan_handle,
+     scan_worker_t *scan_worker,
+     libcerror_error_t **error );
+
+int scan_handle_free_workers(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error );
+
+int scan_handle_scan_sources_callback(
+     scan_worker_t *scan_worker );
+
+int scan_handle_scan_sources(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SCAN_HANDLE_H ) */
+
@@ -0,0 +1,1227 @@
+/*
+ * Scan record
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "olecftools_libcerror.h"
+#include "olecftools_libfdatetime.h"
+#include "olecftools_libfguid.h"
+#include "olecftools_libuna.h"
+#include "scan_record.h"
+
+#define SCAN_RECORD_DATA_INITIAL_SIZE	4096
+
+/* Creates a scan record
+ * Make sure the value scan_record is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int scan_record_initialize(
+     scan_record_t **scan_record,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_record_initialize";
+
+	if( scan_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*scan_record = memory_allocate_structure(
+	                scan_record_t );
+
+	if( *scan_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan record.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *scan_record,
+	     0,
+	     sizeof( scan_record_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan record.",
+		 function );
+
+		memory_free(
+		 *scan_record );
+
+		*scan_record = NULL;
+
+		return( -1 );
+	}
+	if( libfdatetime_filetime_initialize(
+	     &( ( *scan_record )->filetime ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create filetime.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfguid_identifier_initialize(
+	     &( ( *scan_record )->guid ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create GUID.",
+		 function );
+
+		goto on_error;
+	}
+	( *scan_record )->data = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * SCAN_RECORD_DATA_INITIAL_SIZE );
+
+	if( ( *scan_record )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	( *scan_record )->data_size      = SCAN_RECORD_DATA_INITIAL_SIZE;
+	( *scan_record )->ascii_codepage = ascii_codepage;
+
+	return( 1 );
+
+on_error:
+	if( *scan_record != NULL )
+	{
+		if( ( *scan_record )->guid != NULL )
+		{
+			libfguid_identifier_free(
+			 &( ( *scan_record )->guid ),
+			 NULL );
+		}
+		if( ( *scan_record )->filetime != NULL )
+		{
+			libfdatetime_filetime_free(
+			 &( ( *scan_record )->filetime ),
+			 NULL );
+		}
+		memory_free(
+		 *scan_record );
+
+		*scan_record = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a scan record
+ * Returns 1 if successful or -1 on error
+ */
+int scan_record_free(
+     scan_record_t **scan_record,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_record_free";
+	int result            = 1;
+
+	if( scan_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_record != NULL )
+	{
+		if( libfdatetime_filetime_free(
+		     &( ( *scan_record )->filetime ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free filetime.",
+			 function );
+
+			result = -1;
+		}
+		if( libfguid_identifier_free(
+		     &( ( *scan_record )->guid ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free GUID.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 ( *scan_record )->data );
+
+		memory_free(
+		 *scan_record );
+
+		*scan_record = NULL;
+	}
+	return( result );
+}
+
+/* Resizes the record data to hold at least an additional number of bytes
+ * Returns 1 if successful or -1 on error
+ */
+int scan_record_resize_data(
+     scan_record_t *scan_record,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation   = NULL;
+	static char *function   = "scan_record_resize_data";
+	size_t record_data_size = 0;
+
+	if( scan_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan record.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - scan_record->data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size <= ( scan_record->data_size - scan_record->data_offset ) )
+	{
+		return( 1 );
+	}
+	record_data_size = scan_record->data_size;
+
+	while( data_size > ( record_data_size - scan_record->data_offset ) )
+	{
+		if( record_data_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+		{
+			record_data_size = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE;
+		}
+		else
+		{
+			record_data_size *= 2;
+		}
+	}
+	reallocation = (uint8_t *) memory_reallocate(
+	                            scan_record->data,
+	                            sizeof( uint8_t ) * record_data_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize record data.",
+		 function );
+
+		return( -1 );
+	}
+	scan_record->data      = reallocation;
+	scan_record->data_size = record_data_size;
+
+	return( 1 );
+}
+
+/* Appends data to the record
+ * Returns 1 if successful or -1 on error
+ */
+int scan_record_append_data(
+     scan_record_t *scan_record,
+     const char *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_record_append_data";
+
+	if( scan_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan record.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_record_resize_data(
+	     scan_record,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( scan_record->data[ scan_record->data_offset ] ),
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data to record.",
+		 function );
+
+		return( -1 );
+	}
+	scan_record->data_offset += data_size;
+
+	return( 1 );
+}
+
+/* Appends a JSON string to the record
+ * Control characters, quotes and backslashes are escaped
+ * Returns 1 if successful or -1 on error
+ */
+int scan_record_append_json_string(
+     scan_record_t *scan_record,
+     const uint8_t *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	const char *hexadecimal_digits = "0123456789abcdef";
+	uint8_t *record_data           = NULL;
+	static char *function          = "scan_record_append_json_string";
+	size_t string_index            = 0;
+	uint8_t character              = 0;
+
+	if( scan_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan record.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > ( ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - 2 ) / 6 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* An escaped character requires at most 6 bytes
+	 */
+	if( scan_record_resize_data(
+	     scan_record,
+	     ( string_length * 6 ) + 2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize record data.",
+		 function );
+
+		return( -1 );
+	}
+	record_data = &( scan_record->data[ scan_record->data_offset ] );
+
+	*record_data++ = (uint8_t) '"';
+
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		character = string[ string_index ];
+
+		if( ( character == (uint8_t) '"' )
+		 || ( character == (uint8_t) '\\' ) )
+		{
+			*record_data++ = (uint8_t) '\\';
+			*record_data++ = character;
+		}
+		else if( ( character < 0x20 )
+		      || ( character == 0x7f ) )
+		{
+			*record_data++ = (uint8_t) '\\';
+			*record_data++ = (uint8_t) 'u';
+			*record_data++ = (uint8_t) '0';
+			*record_data++ = (uint8_t) '0';
+			*record_data++ = (uint8_t) hexadecimal_digits[ character >> 4 ];
+			*record_data++ = (uint8_t) hexadecimal_digits[ character & 0x0f ];
+		}
+		else
+		{
+			*record_data++ = character;
+		}
+	}
+	*record_data++ = (uint8_t) '"';
+
+	scan_record->data_offset = (size_t) ( record_data - scan_record->data );
+
+	return( 1 );
+}
+
+/* Appends a value separator to the record
+ * The separator is omitted for the first value of an object or array
+ * Returns 1 if successful or -1 on error
+ */
+int scan_record_append_separator(
+     scan_record_t *scan_record,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_record_append_separator";
+	uint8_t last_byte     = 0;
+
+	if( scan_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan record.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_record->data_offset == 0 )
+	{
+		return( 1 );
+	}
+	last_byte = scan_record->data[ scan_record->data_offset - 1 ];
+
+	if( ( last_byte == (uint8_t) '{' )
+	 || ( last_byte == (uint8_t) '[' ) )
+	{
+		return( 1 );
+	}
+	if( scan_record_append_data(
+	     scan_record,
+	     ",",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append separator.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a key to the record
+ * Returns 1 if successful or -1 on error
+ */
+int scan_record_append_key(
+     scan_record_t *scan_record,
+     const char *key,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_record_append_key";
+	size_t key_length     = 0;
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	key_length = narrow_string_length(
+	              key );
+
+	if( scan_record_append_separator(
+	     scan_record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append separator.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_record_append_json_string(
+	     scan_record,
+	     (uint8_t *) key,
+	     key_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append key.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_record_append_data(
+	     scan_record,
+	     ":",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append key separator.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a filename as a JSON string to the record
+ * The filename is converted to UTF-8, characters that cannot be converted are replaced by U+fffd
+ * Returns 1 if successful or -1 on error
+ */
+int scan_record_append_filename(
+     scan_record_t *scan_record,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	uint8_t *utf8_filename                       = NULL;
+	static char *function                        = "scan_record_append_filename";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t character_index                       = 0;
+	size_t filename_index                        = 0;
+	size_t filename_length                       = 0;
+	size_t utf8_filename_index                   = 0;
+	size_t utf8_filename_size                    = 0;
+	int result                                   = 0;
+
+	if( scan_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan record.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+	/* Note that there is a worst-case of a 1 to 3 ratio for each character
+	 * since an invalid character is replaced by U+fffd
+	 */
+	if( filename_length > ( ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) / 3 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	utf8_filename_size = ( filename_length * 3 ) + 1;
+
+	utf8_filename = (uint8_t *) memory_allocate(
+	                             sizeof( uint8_t ) * utf8_filename_size );
+
+	if( utf8_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 filename.",
+		 function );
+
+		goto on_error;
+	}
+	while( filename_index < filename_length )
+	{
+		character_index = filename_index;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libuna_unicode_character_copy_from_utf16(
+		          &unicode_character,
+		          (libuna_utf16_character_t *) filename,
+		          filename_length,
+		          &filename_index,
+		          NULL );
+#else
+		result = libuna_unicode_character_copy_from_utf8(
+		          &unicode_character,
+		          (libuna_utf8_character_t *) filename,
+		          filename_length,
+		          &filename_index,
+		          NULL );
+#endif
+		/* Replace a character that cannot be converted or a surrogate by U+fffd
+		 * so that the record always contains valid UTF-8
+		 */
+		if( ( result != 1 )
+		 || ( filename_index <= character_index )
+		 || ( ( unicode_character >= 0x0000d800UL )
+		  &&  ( unicode_character <= 0x0000dfffUL ) )
+		 || ( unicode_character > 0x0010ffffUL ) )
+		{
+			unicode_character = 0x0000fffdUL;
+			filename_index    = character_index + 1;
+		}
+		if( libuna_unicode_character_copy_to_utf8(
+		     unicode_character,
+		     (libuna_utf8_character_t *) utf8_filename,
+		     utf8_filename_size,
+		     &utf8_filename_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character to UTF-8 filename.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( scan_record_append_json_string(
+	     scan_record,
+	     utf8_filename,
+	     utf8_filename_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append filename.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 utf8_filename );
+
+	return( 1 );
+
+on_error:
+	if( utf8_filename != NULL )
+	{
+		memory_free(
+		 utf8_filename );
+	}
+	return( -1 );
+}
+
+/* Appends the result of a failed scan to the record
+ * Returns 1 if successful or -1 on error
+ */
+int scan_record_append_error(
+     scan_record_t *scan_record,
+     libcerror_error_t *scan_error,
+     libcerror_error_t **error )
+{
+	char error_string[ 512 ];
+
+	static char *function     = "scan_record_append_error";
+	size_t error_string_index = 0;
+	int print_count           = 0;
+
+	if( scan_record_append_data(
+	     scan_record,
+	     ",\"result\":\"error\"",
+	     17,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append result.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_error == NULL )
+	{
+		return( 1 );
+	}
+	print_count = libcerror_error_sprint(
+	               scan_error,
+	               error_string,
+	               512 );
+
+	if( print_count <= 0 )
+	{
+		return( 1 );
+	}
+	error_string_index = narrow_string_length(
+	                      error_string );
+
+	/* Remove the trailing end of line and period
+	 */
+	while( error_string_index > 0 )
+	{
+		if( ( error_string[ error_string_index - 1 ] != '\n' )
+		 && ( error_string[ error_string_index - 1 ] != '\r' )
+		 && ( error_string[ error_string_index - 1 ] != '.' ) )
+		{
+			break;
+		}
+		error_string_index--;
+	}
+	if( scan_record_append_data(
+	     scan_record,
+	     ",\"error\":",
+	     9,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append error key.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_record_append_json_string(
+	     scan_record,
+	     (uint8_t *) error_string,
+	     error_string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append error string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a FILETIME value as an ISO 8601 date and time string to the record
+ * A value of 0 is not appended
+ * Returns 1 if successful or -1 on error
+ */
+int scan_record_append_filetime(
+     scan_record_t *scan_record,
+     const char *key,
+     uint64_t filetime,
+     libcerror_error_t **error )
+{
+	uint8_t date_time_string[ 48 ];
+
+	static char *function = "scan_record_append_filetime";
+
+	if( scan_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan record.",
+		 function );
+
+		return( -1 );
+	}
+	if( filetime == 0 )
+	{
+		return( 1 );
+	}
+	if( libfdatetime_filetime_copy_from_64bit(
+	     scan_record->filetime,
+	     filetime,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy 64-bit value to filetime.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_filetime_copy_to_utf8_string(
+	     scan_record->filetime,
+	     date_time_string,
+	     48,
+	     LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy filetime to string.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_record_append_key(
+	     scan_record,
+	     key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append key.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_record_append_json_string(
+	     scan_record,
+	     date_time_string,
+	     narrow_string_length(
+	      (char *) date_time_string ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append date and time string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a GUID to the record
+ * Returns 1 if successful or -1 on error
+ */
+int scan_record_append_guid(
+     scan_record_t *scan_record,
+     const char *key,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t guid_string[ 48 ];
+
+	static char *function = "scan_record_append_guid";
+
+	if( scan_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan record.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfguid_identifier_copy_from_byte_stream(
+	     scan_record->guid,
+	     guid_data,
+	     guid_data_size,
+	     LIBFGUID_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy byte stream to GUID.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfguid_identifier_copy_to_utf8_string(
+	     scan_record->guid,
+	     guid_string,
+	     48,
+	     LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy GUID to string.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_record_append_key(
+	     scan_record,
+	     key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append key.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_record_append_json_string(
+	     scan_record,
+	     guid_string,
+	     narrow_string_length(
+	      (char *) guid_string ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append GUID string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends an extended ASCII string as a JSON string to the record
+ * The string is converted from the ASCII codepage to UTF-8
+ * Returns 1 if successful or -1 on error
+ */
+int scan_record_append_byte_stream_string(
+     scan_record_t *scan_record,
+     const char *key,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	uint8_t *utf8_string    = NULL;
+	static char *function   = "scan_record_append_byte_stream_string";
+	size_t utf8_string_size = 0;
+
+	if( scan_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan record.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_utf8_string_size_from_byte_stream(
+	     byte_stream,
+	     byte_stream_size,
+	     scan_record->ascii_codepage,
+	     &utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 string size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( utf8_string_size == 0 )
+	 || ( utf8_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	utf8_string = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * utf8_string_size );
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libuna_utf8_string_copy_from_byte_stream(
+	     utf8_string,
+	     utf8_string_size,
+	     byte_stream,
+	     byte_stream_size,
+	     scan_record->ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( scan_record_append_key(
+	     scan_record,
+	     key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append key.",
+		 function );
+
+		goto on_error;
+	}
+	if( scan_record_append_json_string(
+	     scan_record,
+	     utf8_string,
+	     narrow_string_length(
+	      (char *) utf8_string ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append string.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 utf8_string );
+
+	return( 1 );
+
+on_error:
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	return( -1 );
+}
+
+/* Replaces a part of the record that could not be read by a null value
+ * The record is rewound to the offset of the start of the part
+ * Returns 1 if successful or -1 on error
+ */
+int scan_record_replace_with_null_value(
+     scan_record_t *scan_record,
+     const char *key,
+     size_t data_offset,
+     libcerror_error_t **part_error,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_record_replace_with_null_value";
+
+	if( scan_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan record.",
+		 function );
+
+		return( -1 );
+	}
+	if( part_error == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid part error.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset > scan_record->data_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	libcerror_error_free(
+	 part_error );
+
+	scan_record->data_offset = data_offset;
+
+	if( scan_record_append_key(
+	     scan_record,
+	     key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append key.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_record_append_data(
+	     scan_record,
+	     "null",
+	     4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append null value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
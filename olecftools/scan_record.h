@@ -0,0 +1,142 @@
+/*
+ * Scan record
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SCAN_RECORD_H )
+#define _SCAN_RECORD_H
+
+#include <common.h>
+#include <types.h>
+
+#include "olecftools_libcerror.h"
+#include "olecftools_libfdatetime.h"
+#include "olecftools_libfguid.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct scan_record scan_record_t;
+
+struct scan_record
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The data offset
+	 */
+	size_t data_offset;
+
+	/* The filetime, that is reused for every date and time value
+	 */
+	libfdatetime_filetime_t *filetime;
+
+	/* The GUID, that is reused for every class identifier
+	 */
+	libfguid_identifier_t *guid;
+
+	/* The ascii codepage
+	 */
+	int ascii_codepage;
+};
+
+int scan_record_initialize(
+     scan_record_t **scan_record,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int scan_record_free(
+     scan_record_t **scan_record,
+     libcerror_error_t **error );
+
+int scan_record_resize_data(
+     scan_record_t *scan_record,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int scan_record_append_data(
+     scan_record_t *scan_record,
+     const char *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int scan_record_append_separator(
+     scan_record_t *scan_record,
+     libcerror_error_t **error );
+
+int scan_record_append_key(
+     scan_record_t *scan_record,
+     const char *key,
+     libcerror_error_t **error );
+
+int scan_record_append_json_string(
+     scan_record_t *scan_record,
+     const uint8_t *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+int scan_record_append_filename(
+     scan_record_t *scan_record,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int scan_record_append_error(
+     scan_record_t *scan_record,
+     libcerror_error_t *scan_error,
+     libcerror_error_t **error );
+
+int scan_record_append_filetime(
+     scan_record_t *scan_record,
+     const char *key,
+     uint64_t filetime,
+     libcerror_error_t **error );
+
+int scan_record_append_guid(
+     scan_record_t *scan_record,
+     const char *key,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
+int scan_record_append_byte_stream_string(
+     scan_record_t *scan_record,
+     const char *key,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+int scan_record_replace_with_null_value(
+     scan_record_t *scan_record,
+     const char *key,
+     size_t data_offset,
+     libcerror_error_t **part_error,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SCAN_RECORD_H ) */
+
@@ -0,0 +1,2369 @@
+/*
+ * Scan worker
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "olecftools_libcerror.h"
+#include "olecftools_libolecf.h"
+#include "scan_worker.h"
+
+uint8_t scan_worker_class_identifier_summary_information[ 16 ] = {
+        0xe0, 0x85, 0x9f, 0xf2, 0xf9, 0x4f, 0x68, 0x10, 0xab, 0x91, 0x08, 0x00, 0x2b, 0x27, 0xb3, 0xd9 };
+
+uint8_t scan_worker_class_identifier_document_summary_information[ 16 ] = {
+        0x02, 0xd5, 0xcd, 0xd5, 0x9c, 0x2e, 0x1b, 0x10, 0x93, 0x97, 0x08, 0x00, 0x2b, 0x2c, 0xf9, 0xae };
+
+/* Creates a scan worker
+ * Make sure the value scan_worker is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int scan_worker_initialize(
+     scan_worker_t **scan_worker,
+     intptr_t *scan_handle,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_worker_initialize";
+
+	if( scan_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_worker != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan worker value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*scan_worker = memory_allocate_structure(
+	                scan_worker_t );
+
+	if( *scan_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan worker.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *scan_worker,
+	     0,
+	     sizeof( scan_worker_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan worker.",
+		 function );
+
+		memory_free(
+		 *scan_worker );
+
+		*scan_worker = NULL;
+
+		return( -1 );
+	}
+	if( libolecf_file_initialize(
+	     &( ( *scan_worker )->input_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libolecf_file_set_ascii_codepage(
+	     ( *scan_worker )->input_file,
+	     ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set ASCII codepage in input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( scan_record_initialize(
+	     &( ( *scan_worker )->record ),
+	     ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		goto on_error;
+	}
+	( *scan_worker )->scan_handle = scan_handle;
+
+	return( 1 );
+
+on_error:
+	if( *scan_worker != NULL )
+	{
+		if( ( *scan_worker )->input_file != NULL )
+		{
+			libolecf_file_free(
+			 &( ( *scan_worker )->input_file ),
+			 NULL );
+		}
+		memory_free(
+		 *scan_worker );
+
+		*scan_worker = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a scan worker
+ * Returns 1 if successful or -1 on error
+ */
+int scan_worker_free(
+     scan_worker_t **scan_worker,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_worker_free";
+	int result            = 1;
+
+	if( scan_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_worker != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *scan_worker )->thread != NULL )
+		{
+			if( libcthreads_thread_join(
+			     &( ( *scan_worker )->thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( libolecf_file_free(
+		     &( ( *scan_worker )->input_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input file.",
+			 function );
+
+			result = -1;
+		}
+		if( scan_record_free(
+		     &( ( *scan_worker )->record ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *scan_worker )->item_path != NULL )
+		{
+			memory_free(
+			 ( *scan_worker )->item_path );
+		}
+		memory_free(
+		 *scan_worker );
+
+		*scan_worker = NULL;
+	}
+	return( result );
+}
+
+/* Signals the scan worker to abort
+ * Returns 1 if successful or -1 on error
+ */
+int scan_worker_signal_abort(
+     scan_worker_t *scan_worker,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_worker_signal_abort";
+
+	if( scan_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_worker->input_file != NULL )
+	{
+		if( libolecf_file_signal_abort(
+		     scan_worker->input_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input file to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends the file information to the record
+ * Returns 1 if successful or -1 on error
+ */
+int scan_worker_append_file_information(
+     scan_worker_t *scan_worker,
+     libcerror_error_t **error )
+{
+	char value_string[ 128 ];
+
+	static char *function      = "scan_worker_append_file_information";
+	size32_t sector_size       = 0;
+	size32_t short_sector_size = 0;
+	uint16_t major_version     = 0;
+	uint16_t minor_version     = 0;
+	int print_count            = 0;
+
+	if( scan_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( libolecf_file_get_format_version(
+	     scan_worker->input_file,
+	     &major_version,
+	     &minor_version,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve format version.",
+		 function );
+
+		return( -1 );
+	}
+	if( libolecf_file_get_sector_size(
+	     scan_worker->input_file,
+	     &sector_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sector size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libolecf_file_get_short_sector_size(
+	     scan_worker->input_file,
+	     &short_sector_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve short sector size.",
+		 function );
+
+		return( -1 );
+	}
+	print_count = narrow_string_snprintf(
+	               value_string,
+	               128,
+	               ",\"format_version\":\"%" PRIu16 ".%" PRIu16 "\",\"sector_size\":%" PRIu32 ",\"short_sector_size\":%" PRIu32 "",
+	               major_version,
+	               minor_version,
+	               sector_size,
+	               short_sector_size );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 128 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set file information string.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_record_append_data(
+	     scan_worker->record,
+	     value_string,
+	     (size_t) print_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file information.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends an item and its sub items to the record
+ * The item path is built from the path of the parent item and the name of the item
+ * Returns 1 if successful or -1 on error
+ */
+int scan_worker_append_item(
+     scan_worker_t *scan_worker,
+     libolecf_item_t *item,
+     size_t parent_path_length,
+     libcerror_error_t **error )
+{
+	char value_string[ 64 ];
+
+	libolecf_item_t *sub_item = NULL;
+	const uint8_t *name       = NULL;
+	uint8_t *reallocation     = NULL;
+	const char *type_string   = NULL;
+	static char *function     = "scan_worker_append_item";
+	size_t item_path_length   = 0;
+	size_t item_path_size     = 0;
+	size_t name_size          = 0;
+	uint64_t filetime         = 0;
+	uint32_t size             = 0;
+	uint8_t item_type         = 0;
+	int number_of_sub_items   = 0;
+	int print_count           = 0;
+	int result                = 0;
+	int sub_item_index        = 0;
+
+	if( scan_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( libolecf_item_get_type(
+	     item,
+	     &item_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve item type.",
+		 function );
+
+		goto on_error;
+	}
+	switch( item_type )
+	{
+		case LIBOLECF_ITEM_TYPE_EMPTY:
+			type_string = "empty";
+			break;
+
+		case LIBOLECF_ITEM_TYPE_STORAGE:
+			type_string = "storage";
+			break;
+
+		case LIBOLECF_ITEM_TYPE_STREAM:
+			type_string = "stream";
+			break;
+
+		case LIBOLECF_ITEM_TYPE_LOCK_BYTES:
+			type_string = "lock_bytes";
+			break;
+
+		case LIBOLECF_ITEM_TYPE_PROPERTY:
+			type_string = "property";
+			break;
+
+		case LIBOLECF_ITEM_TYPE_ROOT_STORAGE:
+			type_string = "root_storage";
+			break;
+
+		default:
+			type_string = "unknown";
+			break;
+	}
+	/* The root storage has path "/" and its sub items are relative to it
+	 */
+	if( item_type != LIBOLECF_ITEM_TYPE_ROOT_STORAGE )
+	{
+		if( libolecf_item_get_utf8_name_pointer(
+		     item,
+		     &name,
+		     &name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve item name.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( name_size == 0 )
+		 || ( name_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - parent_path_length - 1 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid item name size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		item_path_length = parent_path_length + name_size;
+		item_path_size   = item_path_length + 1;
+
+		if( item_path_size > scan_worker->item_path_size )
+		{
+			reallocation = (uint8_t *) memory_reallocate(
+			                            scan_worker->item_path,
+			                            sizeof( uint8_t ) * item_path_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize item path.",
+				 function );
+
+				goto on_error;
+			}
+			scan_worker->item_path      = reallocation;
+			scan_worker->item_path_size = item_path_size;
+		}
+		scan_worker->item_path[ parent_path_length ] = (uint8_t) '/';
+
+		if( memory_copy(
+		     &( scan_worker->item_path[ parent_path_length + 1 ] ),
+		     name,
+		     name_size - 1 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name to item path.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libolecf_item_get_size(
+	     item,
+	     &size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve item size.",
+		 function );
+
+		goto on_error;
+	}
+	if( scan_record_append_separator(
+	     scan_worker->record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append separator.",
+		 function );
+
+		goto on_error;
+	}
+	if( scan_record_append_data(
+	     scan_worker->record,
+	     "{\"path\":",
+	     8,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append item.",
+		 function );
+
+		goto on_error;
+	}
+	if( item_type == LIBOLECF_ITEM_TYPE_ROOT_STORAGE )
+	{
+		result = scan_record_append_json_string(
+		               scan_worker->record,
+		               (uint8_t *) "/",
+		               1,
+		               error );
+	}
+	else
+	{
+		result = scan_record_append_json_string(
+		               scan_worker->record,
+		               scan_worker->item_path,
+		               item_path_length,
+		               error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append item path.",
+		 function );
+
+		goto on_error;
+	}
+	print_count = narrow_string_snprintf(
+	               value_string,
+	               64,
+	               ",\"type\":\"%s\",\"size\":%" PRIu32 "",
+	               type_string,
+	               size );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 64 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set item values string.",
+		 function );
+
+		goto on_error;
+	}
+	if( scan_record_append_data(
+	     scan_worker->record,
+	     value_string,
+	     (size_t) print_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append item values.",
+		 function );
+
+		goto on_error;
+	}
+	if( libolecf_item_get_creation_time(
+	     item,
+	     &filetime,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve creation time.",
+		 function );
+
+		goto on_error;
+	}
+	if( scan_record_append_filetime(
+	     scan_worker->record,
+	     "creation_time",
+	     filetime,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append creation time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libolecf_item_get_modification_time(
+	     item,
+	     &filetime,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve modification time.",
+		 function );
+
+		goto on_error;
+	}
+	if( scan_record_append_filetime(
+	     scan_worker->record,
+	     "modification_time",
+	     filetime,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append modification time.",
+		 function );
+
+		goto on_error;
+	}
+	if( scan_record_append_data(
+	     scan_worker->record,
+	     "}",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append item end.",
+		 function );
+
+		goto on_error;
+	}
+	if( libolecf_item_get_number_of_sub_items(
+	     item,
+	     &number_of_sub_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub items.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_item_index = 0;
+	     sub_item_index < number_of_sub_items;
+	     sub_item_index++ )
+	{
+		if( libolecf_item_get_sub_item(
+		     item,
+		     sub_item_index,
+		     &sub_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		if( scan_worker_append_item(
+		     scan_worker,
+		     sub_item,
+		     item_path_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		if( libolecf_item_free(
+		     &sub_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( sub_item != NULL )
+	{
+		libolecf_item_free(
+		 &sub_item,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends the compound object (\1CompObj) to the record
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int scan_worker_append_compound_object(
+     scan_worker_t *scan_worker,
+     libolecf_item_t *root_item,
+     libcerror_error_t **error )
+{
+	char value_string[ 16 ];
+
+	libolecf_item_t *compound_object_stream = NULL;
+	uint8_t *compound_object_data           = NULL;
+	static char *function                   = "scan_worker_append_compound_object";
+	size_t data_offset                      = 0;
+	ssize_t read_count                      = 0;
+	uint32_t read_size                      = 0;
+	uint32_t string_size                    = 0;
+	uint32_t value_32bit                    = 0;
+	int print_count                         = 0;
+	int result                              = 0;
+
+	if( scan_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan worker.",
+		 function );
+
+		return( -1 );
+	}
+	result = libolecf_item_get_sub_item_by_utf8_name(
+	          root_item,
+	          (uint8_t *) "\001CompObj",
+	          8,
+	          &compound_object_stream,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compound object stream.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libolecf_item_get_size(
+	     compound_object_stream,
+	     &read_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compound object stream size.",
+		 function );
+
+		goto on_error;
+	}
+	if( read_size > SCAN_WORKER_MAXIMUM_COMPOUND_OBJECT_DATA_SIZE )
+	{
+		read_size = SCAN_WORKER_MAXIMUM_COMPOUND_OBJECT_DATA_SIZE;
+	}
+	compound_object_data = scan_worker->compound_object_data;
+
+	read_count = libolecf_stream_read_buffer_at_offset_without_seek(
+	              compound_object_stream,
+	              compound_object_data,
+	              (size_t) read_size,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compound object stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( libolecf_item_free(
+	     &compound_object_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free compound object stream.",
+		 function );
+
+		goto on_error;
+	}
+	/* The compound object header is 28 bytes of size
+	 */
+	if( read_size < 28 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compound object stream size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( scan_record_append_key(
+	     scan_worker->record,
+	     "compound_object",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append compound object key.",
+		 function );
+
+		goto on_error;
+	}
+	if( scan_record_append_data(
+	     scan_worker->record,
+	     "{",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append compound object start.",
+		 function );
+
+		goto on_error;
+	}
+	/* The class identifier in the compound object header is preceded by -1
+	 */
+	byte_stream_copy_to_uint32_little_endian(
+	 &( compound_object_data[ 8 ] ),
+	 value_32bit );
+
+	if( value_32bit == 0xffffffffUL )
+	{
+		if( scan_record_append_guid(
+		     scan_worker->record,
+		     "class_identifier",
+		     &( compound_object_data[ 12 ] ),
+		     16,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append class identifier.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	data_offset = 28;
+
+	if( ( read_size - data_offset ) >= 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( compound_object_data[ data_offset ] ),
+		 string_size );
+
+		data_offset += 4;
+
+		if( ( string_size > 0 )
+		 && ( string_size <= ( read_size - data_offset ) ) )
+		{
+			if( scan_record_append_byte_stream_string(
+			     scan_worker->record,
+			     "user_type",
+			     &( compound_object_data[ data_offset ] ),
+			     (size_t) string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append user type.",
+				 function );
+
+				goto on_error;
+			}
+			data_offset += string_size;
+
+			if( ( read_size - data_offset ) >= 4 )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 &( compound_object_data[ data_offset ] ),
+				 string_size );
+
+				data_offset += 4;
+			}
+			else
+			{
+				string_size = 0;
+			}
+			/* A clipboard format data size of 0xfffffffe or 0xffffffff indicates
+			 * a standard clipboard format identifier
+			 */
+			if( ( string_size >= 0xfffffffeUL )
+			 && ( ( read_size - data_offset ) >= 4 ) )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 &( compound_object_data[ data_offset ] ),
+				 value_32bit );
+
+				print_count = narrow_string_snprintf(
+				               value_string,
+				               16,
+				               "%" PRIu32 "",
+				               value_32bit );
+
+				if( ( print_count < 0 )
+				 || ( print_count >= 16 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set clipboard format string.",
+					 function );
+
+					goto on_error;
+				}
+				if( scan_record_append_key(
+				     scan_worker->record,
+				     "clipboard_format",
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append clipboard format key.",
+					 function );
+
+					goto on_error;
+				}
+				if( scan_record_append_data(
+				     scan_worker->record,
+				     value_string,
+				     (size_t) print_count,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append clipboard format.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			/* A clipboard format data size of 1 to 400 indicates
+			 * the name of a registered clipboard format
+			 */
+			else if( ( string_size > 0 )
+			      && ( string_size <= 0x190 )
+			      && ( string_size <= ( read_size - data_offset ) ) )
+			{
+				if( scan_record_append_byte_stream_string(
+				     scan_worker->record,
+				     "clipboard_format",
+				     &( compound_object_data[ data_offset ] ),
+				     (size_t) string_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append clipboard format.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+	}
+	if( scan_record_append_data(
+	     scan_worker->record,
+	     "}",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append compound object end.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( compound_object_stream != NULL )
+	{
+		libolecf_item_free(
+		 &compound_object_stream,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends a property value to the record
+ * Only the values of known property identifiers are appended
+ * Returns 1 if successful or -1 on error
+ */
+int scan_worker_append_property_value(
+     scan_worker_t *scan_worker,
+     uint8_t is_document_summary_information,
+     libolecf_property_value_t *property_value,
+     libcerror_error_t **error )
+{
+	char value_string[ 32 ];
+
+	uint8_t *utf8_string               = NULL;
+	const char *key                    = NULL;
+	static char *function              = "scan_worker_append_property_value";
+	size_t utf8_string_size            = 0;
+	uint64_t value_64bit               = 0;
+	uint32_t property_value_identifier = 0;
+	uint32_t property_value_type       = 0;
+	uint32_t value_32bit               = 0;
+	uint16_t value_16bit               = 0;
+	uint8_t value_boolean              = 0;
+	int print_count                    = 0;
+
+	if( scan_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( libolecf_property_value_get_identifier(
+	     property_value,
+	     &property_value_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( libolecf_property_value_get_value_type(
+	     property_value,
+	     &property_value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value type.",
+		 function );
+
+		goto on_error;
+	}
+	if( is_document_summary_information != 0 )
+	{
+		switch( property_value_identifier )
+		{
+			case LIBOLECF_DOCUMENT_SUMMARY_INFORMATION_PID_CODEPAGE:
+				key = "codepage";
+				break;
+
+			case LIBOLECF_DOCUMENT_SUMMARY_INFORMATION_PID_CATEGORY:
+				key = "category";
+				break;
+
+			case LIBOLECF_DOCUMENT_SUMMARY_INFORMATION_PID_PRESENTATION_TARGET:
+				key = "presentation_target";
+				break;
+
+			case LIBOLECF_DOCUMENT_SUMMARY_INFORMATION_PID_BYTE_COUNT:
+				key = "number_of_bytes";
+				break;
+
+			case LIBOLECF_DOCUMENT_SUMMARY_INFORMATION_PID_LINE_COUNT:
+				key = "number_of_lines";
+				break;
+
+			case LIBOLECF_DOCUMENT_SUMMARY_INFORMATION_PID_PARAGRAPH_COUNT:
+				key = "number_of_paragraphs";
+				break;
+
+			case LIBOLECF_DOCUMENT_SUMMARY_INFORMATION_PID_SLIDE_COUNT:
+				key = "number_of_slides";
+				break;
+
+			case LIBOLECF_DOCUMENT_SUMMARY_INFORMATION_PID_NOTE_COUNT:
+				key = "number_of_notes";
+				break;
+
+			case LIBOLECF_DOCUMENT_SUMMARY_INFORMATION_PID_HIDDEN_SLIDE_COUNT:
+				key = "number_of_hidden_slides";
+				break;
+
+			case LIBOLECF_DOCUMENT_SUMMARY_INFORMATION_PID_MMCLIP_COUNT:
+				key = "number_of_multimedia_clips";
+				break;
+
+			case LIBOLECF_DOCUMENT_SUMMARY_INFORMATION_PID_SCALE:
+				key = "scale";
+				break;
+
+			case LIBOLECF_DOCUMENT_SUMMARY_INFORMATION_PID_MANAGER:
+				key = "manager";
+				break;
+
+			case LIBOLECF_DOCUMENT_SUMMARY_INFORMATION_PID_COMPANY:
+				key = "company";
+				break;
+
+			case LIBOLECF_DOCUMENT_SUMMARY_INFORMATION_PID_LINKS_DIRTY:
+				key = "links_dirty";
+				break;
+
+			default:
+				break;
+		}
+	}
+	else
+	{
+		switch( property_value_identifier )
+		{
+			case LIBOLECF_SUMMARY_INFORMATION_PID_CODEPAGE:
+				key = "codepage";
+				break;
+
+			case LIBOLECF_SUMMARY_INFORMATION_PID_TITLE:
+				key = "title";
+				break;
+
+			case LIBOLECF_SUMMARY_INFORMATION_PID_SUBJECT:
+				key = "subject";
+				break;
+
+			case LIBOLECF_SUMMARY_INFORMATION_PID_AUTHOR:
+				key = "author";
+				break;
+
+			case LIBOLECF_SUMMARY_INFORMATION_PID_KEYWORDS:
+				key = "keywords";
+				break;
+
+			case LIBOLECF_SUMMARY_INFORMATION_PID_COMMENTS:
+				key = "comments";
+				break;
+
+			case LIBOLECF_SUMMARY_INFORMATION_PID_TEMPLATE:
+				key = "template";
+				break;
+
+			case LIBOLECF_SUMMARY_INFORMATION_PID_LAST_SAVED_BY:
+				key = "last_saved_by";
+				break;
+
+			case LIBOLECF_SUMMARY_INFORMATION_PID_REVISION_NUMBER:
+				key = "revision_number";
+				break;
+
+			case LIBOLECF_SUMMARY_INFORMATION_PID_EDITING_TIME:
+				key = "editing_time";
+				break;
+
+			case LIBOLECF_SUMMARY_INFORMATION_PID_LAST_PRINTED_TIME:
+				key = "last_printed_time";
+				break;
+
+			case LIBOLECF_SUMMARY_INFORMATION_PID_CREATION_TIME:
+				key = "creation_time";
+				break;
+
+			case LIBOLECF_SUMMARY_INFORMATION_PID_LAST_WRITTEN_TIME:
+				key = "last_written_time";
+				break;
+
+			case LIBOLECF_SUMMARY_INFORMATION_PID_NUMBER_OF_PAGES:
+				key = "number_of_pages";
+				break;
+
+			case LIBOLECF_SUMMARY_INFORMATION_PID_NUMBER_OF_WORDS:
+				key = "number_of_words";
+				break;
+
+			case LIBOLECF_SUMMARY_INFORMATION_PID_NUMBER_OF_CHARACTERS:
+				key = "number_of_characters";
+				break;
+
+			case LIBOLECF_SUMMARY_INFORMATION_PID_APPLICATION_NAME:
+				key = "application_name";
+				break;
+
+			case LIBOLECF_SUMMARY_INFORMATION_PID_SECURITY:
+				key = "security";
+				break;
+
+			default:
+				break;
+		}
+	}
+	if( key == NULL )
+	{
+		return( 1 );
+	}
+	print_count = 0;
+
+	switch( property_value_type )
+	{
+		case LIBOLECF_VALUE_TYPE_BOOLEAN:
+			if( libolecf_property_value_get_data_as_boolean(
+			     property_value,
+			     &value_boolean,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve boolean value.",
+				 function );
+
+				goto on_error;
+			}
+			print_count = narrow_string_snprintf(
+			               value_string,
+			               32,
+			               "%s",
+			               ( value_boolean != 0 ) ? "true" : "false" );
+			break;
+
+		case LIBOLECF_VALUE_TYPE_INTEGER_16BIT_SIGNED:
+		case LIBOLECF_VALUE_TYPE_INTEGER_16BIT_UNSIGNED:
+			if( libolecf_property_value_get_data_as_16bit_integer(
+			     property_value,
+			     &value_16bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve 16-bit integer value.",
+				 function );
+
+				goto on_error;
+			}
+			/* The codepage is stored as a signed 16-bit integer but represents
+			 * an unsigned codepage identifier, such as 65001 for UTF-8
+			 */
+			if( ( property_value_type == LIBOLECF_VALUE_TYPE_INTEGER_16BIT_SIGNED )
+			 && ( property_value_identifier != LIBOLECF_SUMMARY_INFORMATION_PID_CODEPAGE ) )
+			{
+				print_count = narrow_string_snprintf(
+				               value_string,
+				               32,
+				               "%" PRIi16 "",
+				               (int16_t) value_16bit );
+			}
+			else
+			{
+				print_count = narrow_string_snprintf(
+				               value_string,
+				               32,
+				               "%" PRIu16 "",
+				               value_16bit );
+			}
+			break;
+
+		case LIBOLECF_VALUE_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBOLECF_VALUE_TYPE_INTEGER_32BIT_UNSIGNED:
+			if( libolecf_property_value_get_data_as_32bit_integer(
+			     property_value,
+			     &value_32bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve 32-bit integer value.",
+				 function );
+
+				goto on_error;
+			}
+			if( property_value_type == LIBOLECF_VALUE_TYPE_INTEGER_32BIT_SIGNED )
+			{
+				print_count = narrow_string_snprintf(
+				               value_string,
+				               32,
+				               "%" PRIi32 "",
+				               (int32_t) value_32bit );
+			}
+			else
+			{
+				print_count = narrow_string_snprintf(
+				               value_string,
+				               32,
+				               "%" PRIu32 "",
+				               value_32bit );
+			}
+			break;
+
+		case LIBOLECF_VALUE_TYPE_INTEGER_64BIT_SIGNED:
+		case LIBOLECF_VALUE_TYPE_INTEGER_64BIT_UNSIGNED:
+			if( libolecf_property_value_get_data_as_64bit_integer(
+			     property_value,
+			     &value_64bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve 64-bit integer value.",
+				 function );
+
+				goto on_error;
+			}
+			if( property_value_type == LIBOLECF_VALUE_TYPE_INTEGER_64BIT_SIGNED )
+			{
+				print_count = narrow_string_snprintf(
+				               value_string,
+				               32,
+				               "%" PRIi64 "",
+				               (int64_t) value_64bit );
+			}
+			else
+			{
+				print_count = narrow_string_snprintf(
+				               value_string,
+				               32,
+				               "%" PRIu64 "",
+				               value_64bit );
+			}
+			break;
+
+		case LIBOLECF_VALUE_TYPE_FILETIME:
+			if( libolecf_property_value_get_data_as_filetime(
+			     property_value,
+			     &value_64bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve FILETIME value.",
+				 function );
+
+				goto on_error;
+			}
+			/* The editing time is a duration and not a date and time value
+			 * it is represented as a number of seconds
+			 */
+			if( ( is_document_summary_information == 0 )
+			 && ( property_value_identifier == LIBOLECF_SUMMARY_INFORMATION_PID_EDITING_TIME ) )
+			{
+				print_count = narrow_string_snprintf(
+				               value_string,
+				               32,
+				               "%" PRIu64 "",
+				               value_64bit / 10000000UL );
+			}
+			else if( scan_record_append_filetime(
+			          scan_worker->record,
+			          key,
+			          value_64bit,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append FILETIME value.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBOLECF_VALUE_TYPE_STRING_ASCII:
+		case LIBOLECF_VALUE_TYPE_STRING_UNICODE:
+			if( libolecf_property_value_get_data_as_utf8_string_size(
+			     property_value,
+			     &utf8_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string value size.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( utf8_string_size == 0 )
+			 || ( utf8_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid string value size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			utf8_string = (uint8_t *) memory_allocate(
+			                           sizeof( uint8_t ) * utf8_string_size );
+
+			if( utf8_string == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create string value.",
+				 function );
+
+				goto on_error;
+			}
+			if( libolecf_property_value_get_data_as_utf8_string(
+			     property_value,
+			     utf8_string,
+			     utf8_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string value.",
+				 function );
+
+				goto on_error;
+			}
+			if( scan_record_append_key(
+			     scan_worker->record,
+			     key,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append key.",
+				 function );
+
+				goto on_error;
+			}
+			if( scan_record_append_json_string(
+			     scan_worker->record,
+			     utf8_string,
+			     narrow_string_length(
+			      (char *) utf8_string ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append string value.",
+				 function );
+
+				goto on_error;
+			}
+			memory_free(
+			 utf8_string );
+
+			utf8_string = NULL;
+
+			break;
+
+		default:
+			break;
+	}
+	if( print_count != 0 )
+	{
+		if( ( print_count < 0 )
+		 || ( print_count >= 32 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set value string.",
+			 function );
+
+			goto on_error;
+		}
+		if( scan_record_append_key(
+		     scan_worker->record,
+		     key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append key.",
+			 function );
+
+			goto on_error;
+		}
+		if( scan_record_append_data(
+		     scan_worker->record,
+		     value_string,
+		     (size_t) print_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	return( -1 );
+}
+
+/* Appends a property set stream to the record
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int scan_worker_append_property_set_stream(
+     scan_worker_t *scan_worker,
+     libolecf_item_t *root_item,
+     const char *key,
+     const uint8_t *utf8_name,
+     size_t utf8_name_length,
+     uint8_t is_document_summary_information,
+     libcerror_error_t **error )
+{
+	uint8_t class_identifier[ 16 ];
+
+	libolecf_item_t *property_set_stream          = NULL;
+	libolecf_property_section_t *property_section = NULL;
+	libolecf_property_set_t *property_set         = NULL;
+	libolecf_property_value_t *property_value     = NULL;
+	uint8_t *expected_class_identifier            = NULL;
+	static char *function                         = "scan_worker_append_property_set_stream";
+	int number_of_properties                      = 0;
+	int number_of_sections                        = 0;
+	int property_index                            = 0;
+	int result                                    = 0;
+	int section_index                             = 0;
+
+	if( scan_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_document_summary_information != 0 )
+	{
+		expected_class_identifier = scan_worker_class_identifier_document_summary_information;
+	}
+	else
+	{
+		expected_class_identifier = scan_worker_class_identifier_summary_information;
+	}
+	result = libolecf_item_get_sub_item_by_utf8_name(
+	          root_item,
+	          utf8_name,
+	          utf8_name_length,
+	          &property_set_stream,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property set stream.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libolecf_property_set_stream_get_set(
+	     property_set_stream,
+	     &property_set,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property set.",
+		 function );
+
+		goto on_error;
+	}
+	if( libolecf_property_set_get_number_of_sections(
+	     property_set,
+	     &number_of_sections,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sections.",
+		 function );
+
+		goto on_error;
+	}
+	if( scan_record_append_key(
+	     scan_worker->record,
+	     key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append key.",
+		 function );
+
+		goto on_error;
+	}
+	if( scan_record_append_data(
+	     scan_worker->record,
+	     "{",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append property set start.",
+		 function );
+
+		goto on_error;
+	}
+	for( section_index = 0;
+	     section_index < number_of_sections;
+	     section_index++ )
+	{
+		if( libolecf_property_set_get_section_by_index(
+		     property_set,
+		     section_index,
+		     &property_section,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section: %d.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+		if( libolecf_property_section_get_class_identifier(
+		     property_section,
+		     class_identifier,
+		     16,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section: %d class identifier.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+		/* Only the properties of the section with the well-known format identifier
+		 * are appended, for example the user defined properties are ignored
+		 */
+		if( memory_compare(
+		     class_identifier,
+		     expected_class_identifier,
+		     16 ) == 0 )
+		{
+			if( libolecf_property_section_get_number_of_properties(
+			     property_section,
+			     &number_of_properties,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve section: %d number of properties.",
+				 function,
+				 section_index );
+
+				goto on_error;
+			}
+			for( property_index = 0;
+			     property_index < number_of_properties;
+			     property_index++ )
+			{
+				if( libolecf_property_section_get_property_by_index(
+				     property_section,
+				     property_index,
+				     &property_value,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve section: %d property: %d.",
+					 function,
+					 section_index,
+					 property_index );
+
+					goto on_error;
+				}
+				if( scan_worker_append_property_value(
+				     scan_worker,
+				     is_document_summary_information,
+				     property_value,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append section: %d property: %d.",
+					 function,
+					 section_index,
+					 property_index );
+
+					goto on_error;
+				}
+				if( libolecf_property_value_free(
+				     &property_value,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free section: %d property: %d.",
+					 function,
+					 section_index,
+					 property_index );
+
+					goto on_error;
+				}
+			}
+		}
+		if( libolecf_property_section_free(
+		     &property_section,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free section: %d.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+	}
+	if( scan_record_append_data(
+	     scan_worker->record,
+	     "}",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append property set end.",
+		 function );
+
+		goto on_error;
+	}
+	if( libolecf_property_set_free(
+	     &property_set,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free property set.",
+		 function );
+
+		goto on_error;
+	}
+	if( libolecf_item_free(
+	     &property_set_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free property set stream.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( property_value != NULL )
+	{
+		libolecf_property_value_free(
+		 &property_value,
+		 NULL );
+	}
+	if( property_section != NULL )
+	{
+		libolecf_property_section_free(
+		 &property_section,
+		 NULL );
+	}
+	if( property_set != NULL )
+	{
+		libolecf_property_set_free(
+		 &property_set,
+		 NULL );
+	}
+	if( property_set_stream != NULL )
+	{
+		libolecf_item_free(
+		 &property_set_stream,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Scans a file and stores the resulting record in the record data
+ * A file that cannot be read does not cause an error, its record contains the error instead
+ * Returns 1 if successful or -1 on error
+ */
+int scan_worker_scan_file(
+     scan_worker_t *scan_worker,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *scan_error = NULL;
+	libolecf_item_t *root_item    = NULL;
+	static char *function         = "scan_worker_scan_file";
+	size_t record_data_offset     = 0;
+	uint8_t file_is_open          = 0;
+	int result                    = 0;
+
+	if( scan_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan worker.",
+		 function );
+
+		return( -1 );
+	}
+	scan_worker->record->data_offset = 0;
+
+	if( scan_record_append_data(
+	     scan_worker->record,
+	     "{",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append record start.",
+		 function );
+
+		goto on_error;
+	}
+	if( scan_record_append_key(
+	     scan_worker->record,
+	     "path",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append path key.",
+		 function );
+
+		goto on_error;
+	}
+	if( scan_record_append_filename(
+	     scan_worker->record,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append path.",
+		 function );
+
+		goto on_error;
+	}
+	scan_worker->number_of_scanned_files += 1;
+
+	record_data_offset = scan_worker->record->data_offset;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libolecf_check_file_signature_wide(
+	          filename,
+	          &scan_error );
+#else
+	result = libolecf_check_file_signature(
+	          filename,
+	          &scan_error );
+#endif
+	if( result == 0 )
+	{
+		if( scan_record_append_data(
+		     scan_worker->record,
+		     ",\"result\":\"unsupported\"",
+		     23,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append result.",
+			 function );
+
+			goto on_error;
+		}
+		scan_worker->number_of_unsupported_files += 1;
+	}
+	if( result == 1 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libolecf_file_open_wide(
+		          scan_worker->input_file,
+		          filename,
+		          LIBOLECF_OPEN_READ,
+		          &scan_error );
+#else
+		result = libolecf_file_open(
+		          scan_worker->input_file,
+		          filename,
+		          LIBOLECF_OPEN_READ,
+		          &scan_error );
+#endif
+		if( result == 1 )
+		{
+			file_is_open = 1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( scan_record_append_data(
+		     scan_worker->record,
+		     ",\"result\":\"ok\"",
+		     14,
+		     &scan_error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( scan_worker_append_file_information(
+		     scan_worker,
+		     &scan_error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libolecf_file_get_root_item(
+		     scan_worker->input_file,
+		     &root_item,
+		     &scan_error ) == -1 )
+		{
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( scan_record_append_key(
+		     scan_worker->record,
+		     "items",
+		     &scan_error ) != 1 )
+		{
+			result = -1;
+		}
+		else if( scan_record_append_data(
+		          scan_worker->record,
+		          "[",
+		          1,
+		          &scan_error ) != 1 )
+		{
+			result = -1;
+		}
+		else if( root_item != NULL )
+		{
+			if( scan_worker_append_item(
+			     scan_worker,
+			     root_item,
+			     0,
+			     &scan_error ) != 1 )
+			{
+				result = -1;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		if( scan_record_append_data(
+		     scan_worker->record,
+		     "]",
+		     1,
+		     &scan_error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( ( result == 1 )
+	 && ( root_item != NULL ) )
+	{
+		/* The compound object and property sets are optional and a failure
+		 * to read them does not invalidate the other parts of the record
+		 */
+		record_data_offset = scan_worker->record->data_offset;
+
+		if( scan_worker_append_compound_object(
+		     scan_worker,
+		     root_item,
+		     &scan_error ) == -1 )
+		{
+			if( scan_record_replace_with_null_value(
+			     scan_worker->record,
+			     "compound_object",
+			     record_data_offset,
+			     &scan_error,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to replace compound object.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		record_data_offset = scan_worker->record->data_offset;
+
+		if( scan_worker_append_property_set_stream(
+		     scan_worker,
+		     root_item,
+		     "summary_information",
+		     (uint8_t *) "\005SummaryInformation",
+		     19,
+		     0,
+		     &scan_error ) == -1 )
+		{
+			if( scan_record_replace_with_null_value(
+			     scan_worker->record,
+			     "summary_information",
+			     record_data_offset,
+			     &scan_error,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to replace summary information.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		record_data_offset = scan_worker->record->data_offset;
+
+		if( scan_worker_append_property_set_stream(
+		     scan_worker,
+		     root_item,
+		     "document_summary_information",
+		     (uint8_t *) "\005DocumentSummaryInformation",
+		     27,
+		     1,
+		     &scan_error ) == -1 )
+		{
+			if( scan_record_replace_with_null_value(
+			     scan_worker->record,
+			     "document_summary_information",
+			     record_data_offset,
+			     &scan_error,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to replace document summary information.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( root_item != NULL )
+	{
+		if( libolecf_item_free(
+		     &root_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free root item.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( file_is_open != 0 )
+	{
+		file_is_open = 0;
+
+		if( libolecf_file_close(
+		     scan_worker->input_file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close input file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result == -1 )
+	{
+		/* Discard the parts of the record that were appended before the failure
+		 */
+		scan_worker->record->data_offset = record_data_offset;
+
+		if( scan_record_append_error(
+		     scan_worker->record,
+		     scan_error,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append error.",
+			 function );
+
+			goto on_error;
+		}
+		libcerror_error_free(
+		 &scan_error );
+
+		scan_worker->number_of_failed_files += 1;
+	}
+	if( scan_record_append_data(
+	     scan_worker->record,
+	     "}\n",
+	     2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append record end.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( scan_error != NULL )
+	{
+		libcerror_error_free(
+		 &scan_error );
+	}
+	if( root_item != NULL )
+	{
+		libolecf_item_free(
+		 &root_item,
+		 NULL );
+	}
+	if( file_is_open != 0 )
+	{
+		libolecf_file_close(
+		 scan_worker->input_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
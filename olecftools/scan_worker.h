@@ -0,0 +1,154 @@
+/*
+ * Scan worker
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SCAN_WORKER_H )
+#define _SCAN_WORKER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "olecftools_libcerror.h"
+#include "olecftools_libcthreads.h"
+#include "olecftools_libolecf.h"
+#include "scan_record.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of bytes of the compound object stream that are read
+ */
+#define SCAN_WORKER_MAXIMUM_COMPOUND_OBJECT_DATA_SIZE	4096
+
+typedef struct scan_worker scan_worker_t;
+
+struct scan_worker
+{
+	/* The scan handle the worker belongs to
+	 */
+	intptr_t *scan_handle;
+
+	/* The index of the next source of the range of the worker
+	 */
+	int next_source_index;
+
+	/* The index of the end of the range of the worker
+	 */
+	int end_source_index;
+
+	/* The libolecf input file, that is reused for every source
+	 */
+	libolecf_file_t *input_file;
+
+	/* The record
+	 */
+	scan_record_t *record;
+
+	/* The item path
+	 */
+	uint8_t *item_path;
+
+	/* The item path size
+	 */
+	size_t item_path_size;
+
+	/* The compound object stream data
+	 */
+	uint8_t compound_object_data[ SCAN_WORKER_MAXIMUM_COMPOUND_OBJECT_DATA_SIZE ];
+
+	/* The number of scanned files
+	 */
+	int number_of_scanned_files;
+
+	/* The number of unsupported files
+	 */
+	int number_of_unsupported_files;
+
+	/* The number of failed files
+	 */
+	int number_of_failed_files;
+
+	/* Value to indicate the worker failed
+	 */
+	uint8_t has_failed;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+int scan_worker_initialize(
+     scan_worker_t **scan_worker,
+     intptr_t *scan_handle,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int scan_worker_free(
+     scan_worker_t **scan_worker,
+     libcerror_error_t **error );
+
+int scan_worker_signal_abort(
+     scan_worker_t *scan_worker,
+     libcerror_error_t **error );
+
+int scan_worker_append_file_information(
+     scan_worker_t *scan_worker,
+     libcerror_error_t **error );
+
+int scan_worker_append_item(
+     scan_worker_t *scan_worker,
+     libolecf_item_t *item,
+     size_t parent_path_length,
+     libcerror_error_t **error );
+
+int scan_worker_append_compound_object(
+     scan_worker_t *scan_worker,
+     libolecf_item_t *root_item,
+     libcerror_error_t **error );
+
+int scan_worker_append_property_value(
+     scan_worker_t *scan_worker,
+     uint8_t is_document_summary_information,
+     libolecf_property_value_t *property_value,
+     libcerror_error_t **error );
+
+int scan_worker_append_property_set_stream(
+     scan_worker_t *scan_worker,
+     libolecf_item_t *root_item,
+     const char *key,
+     const uint8_t *utf8_name,
+     size_t utf8_name_length,
+     uint8_t is_document_summary_information,
+     libcerror_error_t **error );
+
+int scan_worker_scan_file(
+     scan_worker_t *scan_worker,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SCAN_WORKER_H ) */
+
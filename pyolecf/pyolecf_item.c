@@ -414,12 +414,12 @@ PyObject *pyolecf_item_get_name(
            pyolecf_item_t *pyolecf_item,
            PyObject *arguments PYOLECF_ATTRIBUTE_UNUSED )
 {
-	PyObject *string_object  = NULL;
-	libcerror_error_t *error = NULL;
-	static char *function    = "pyolecf_item_get_name";
-	char *utf8_string        = NULL;
-	size_t utf8_string_size  = 0;
-	int result               = 0;
+	PyObject *string_object    = NULL;
+	libcerror_error_t *error   = NULL;
+	const uint8_t *utf8_string = NULL;
+	static char *function      = "pyolecf_item_get_name";
+	size_t utf8_string_size    = 0;
+	int result                 = 0;
 
 	PYOLECF_UNREFERENCED_PARAMETER( arguments )
 
@@ -432,10 +432,13 @@ PyObject *pyolecf_item_get_name(
 
 		return( NULL );
 	}
+	/* The UTF-8 name is cached by the library hence no copy is needed
+	 */
 	Py_BEGIN_ALLOW_THREADS
 
-	result = libolecf_item_get_utf8_name_size(
+	result = libolecf_item_get_utf8_name_pointer(
 	          pyolecf_item->item,
+	          &utf8_string,
 	          &utf8_string_size,
 	          &error );
 
@@ -446,13 +449,13 @@ PyObject *pyolecf_item_get_name(
 		pyolecf_error_raise(
 		 error,
 		 PyExc_IOError,
-		 "%s: unable to determine size of name as UTF-8 string.",
+		 "%s: unable to retrieve name as UTF-8 string.",
 		 function );
 
 		libcerror_error_free(
 		 &error );
 
-		goto on_error;
+		return( NULL );
 	}
 	else if( ( result == 0 )
 	      || ( utf8_string_size == 0 ) )
@@ -462,46 +465,11 @@ PyObject *pyolecf_item_get_name(
 
 		return( Py_None );
 	}
-	utf8_string = (char *) PyMem_Malloc(
-	                        sizeof( char ) * utf8_string_size );
-
-	if( utf8_string == NULL )
-	{
-		PyErr_Format(
-		 PyExc_MemoryError,
-		 "%s: unable to create UTF-8 string.",
-		 function );
-
-		goto on_error;
-	}
-	Py_BEGIN_ALLOW_THREADS
-
-	result = libolecf_item_get_utf8_name(
-	          pyolecf_item->item,
-	          (uint8_t *) utf8_string,
-	          utf8_string_size,
-	          &error );
-
-	Py_END_ALLOW_THREADS
-
-	if( result != 1 )
-	{
-		pyolecf_error_raise(
-		 error,
-		 PyExc_IOError,
-		 "%s: unable to retrieve name as UTF-8 string.",
-		 function );
-
-		libcerror_error_free(
-		 &error );
-
-		goto on_error;
-	}
 	/* Pass the string length to PyUnicode_DecodeUTF8 otherwise it makes
 	 * the end of string character is part of the string
 	 */
 	string_object = PyUnicode_DecodeUTF8(
-	                 utf8_string,
+	                 (char *) utf8_string,
 	                 (Py_ssize_t) utf8_string_size - 1,
 	                 NULL );
 
@@ -512,20 +480,9 @@ PyObject *pyolecf_item_get_name(
 		 "%s: unable to convert UTF-8 string into Unicode object.",
 		 function );
 
-		goto on_error;
+		return( NULL );
 	}
-	PyMem_Free(
-	 utf8_string );
-
 	return( string_object );
-
-on_error:
-	if( utf8_string != NULL )
-	{
-		PyMem_Free(
-		 utf8_string );
-	}
-	return( NULL );
 }
 
 /* Retrieves the size
@@ -51,7 +51,7 @@ PyMethodDef pyolecf_stream_object_methods[] = {
 	  METH_VARARGS | METH_KEYWORDS,
 	  "read_buffer_at_offset(size, offset) -> String\n"
 	  "\n"
-	  "Reads a buffer of stream data at a specific offset." },
+	  "Reads a buffer of stream data at a specific offset, the current offset is not changed." },
 
 	{ "seek_offset",
 	  (PyCFunction) pyolecf_stream_seek_offset,
@@ -566,7 +566,7 @@ PyObject *pyolecf_stream_read_buffer_at_offset(
 #endif
 	Py_BEGIN_ALLOW_THREADS
 
-	read_count = libolecf_stream_read_buffer_at_offset(
+	read_count = libolecf_stream_read_buffer_at_offset_without_seek(
 	              pyolecf_item->item,
 	              (uint8_t *) buffer,
 	              (size_t) read_size,
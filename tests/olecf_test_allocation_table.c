@@ -275,6 +275,1062 @@ on_error:
 	return( 0 );
 }
 
+/* Sets the sector identifiers of a test allocation table
+ * The table contains a chain of 100 sectors followed by unused sectors
+ */
+void olecf_test_allocation_table_set_test_sector_identifiers(
+      libolecf_allocation_table_t *allocation_table )
+{
+	int entry_index = 0;
+
+	for( entry_index = 0;
+	     entry_index < allocation_table->number_of_sector_identifiers;
+	     entry_index++ )
+	{
+		if( entry_index < 99 )
+		{
+			allocation_table->sector_identifiers[ entry_index ] = (uint32_t) entry_index + 1;
+		}
+		else if( entry_index == 99 )
+		{
+			allocation_table->sector_identifiers[ entry_index ] = 0xfffffffeUL;
+		}
+		else
+		{
+			allocation_table->sector_identifiers[ entry_index ] = 0xffffffffUL;
+		}
+	}
+}
+
+/* Tests the libolecf_allocation_table_compact function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_allocation_table_compact(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libolecf_allocation_table_t *allocation_table = NULL;
+	int entry_index                               = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_allocation_table_initialize(
+	          &allocation_table,
+	          256,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_table",
+	 allocation_table );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	olecf_test_allocation_table_set_test_sector_identifiers(
+	 allocation_table );
+
+	/* Test regular cases
+	 */
+	result = libolecf_allocation_table_compact(
+	          allocation_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "allocation_table->sector_identifiers",
+	 allocation_table->sector_identifiers );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "allocation_table->number_of_runs",
+	 allocation_table->number_of_runs,
+	 3 );
+
+	/* Test compact on sector identifiers that do not form runs
+	 */
+	result = libolecf_allocation_table_free(
+	          &allocation_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_allocation_table_initialize(
+	          &allocation_table,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_table",
+	 allocation_table );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < 16;
+	     entry_index++ )
+	{
+		allocation_table->sector_identifiers[ entry_index ] = (uint32_t) ( ( entry_index * 7 ) % 16 );
+	}
+	result = libolecf_allocation_table_compact(
+	          allocation_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_table->sector_identifiers",
+	 allocation_table->sector_identifiers );
+
+	/* Test error cases
+	 */
+	result = libolecf_allocation_table_compact(
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_allocation_table_free(
+	          &allocation_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "allocation_table",
+	 allocation_table );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( allocation_table != NULL )
+	{
+		libolecf_allocation_table_free(
+		 &allocation_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_allocation_table_get_memory_size function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_allocation_table_get_memory_size(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libolecf_allocation_table_t *allocation_table = NULL;
+	size_t compacted_memory_size                  = 0;
+	size_t memory_size                            = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_allocation_table_initialize(
+	          &allocation_table,
+	          256,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_table",
+	 allocation_table );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	olecf_test_allocation_table_set_test_sector_identifiers(
+	 allocation_table );
+
+	/* Test regular cases
+	 */
+	result = libolecf_allocation_table_get_memory_size(
+	          allocation_table,
+	          &memory_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_SIZE(
+	 "memory_size",
+	 memory_size,
+	 (size_t) ( sizeof( libolecf_allocation_table_t ) + ( 256 * sizeof( uint32_t ) ) ) );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the memory size with the sector identifiers run-length encoded
+	 */
+	result = libolecf_allocation_table_compact(
+	          allocation_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_allocation_table_get_memory_size(
+	          allocation_table,
+	          &compacted_memory_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_SIZE(
+	 "compacted_memory_size",
+	 compacted_memory_size,
+	 (size_t) ( sizeof( libolecf_allocation_table_t ) + ( 3 * sizeof( libolecf_allocation_table_run_t ) ) ) );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	OLECF_TEST_ASSERT_LESS_THAN_UINT64(
+	 "compacted_memory_size",
+	 (uint64_t) compacted_memory_size,
+	 (uint64_t) memory_size );
+
+	/* Test error cases
+	 */
+	result = libolecf_allocation_table_get_memory_size(
+	          NULL,
+	          &memory_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_allocation_table_get_memory_size(
+	          allocation_table,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_allocation_table_free(
+	          &allocation_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "allocation_table",
+	 allocation_table );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( allocation_table != NULL )
+	{
+		libolecf_allocation_table_free(
+		 &allocation_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_allocation_table_get_run_index_by_entry_index function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_allocation_table_get_run_index_by_entry_index(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libolecf_allocation_table_t *allocation_table = NULL;
+	int entry_index                               = 0;
+	int expected_run_index                        = 0;
+	int result                                    = 0;
+	int run_index                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_allocation_table_initialize(
+	          &allocation_table,
+	          256,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_table",
+	 allocation_table );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	olecf_test_allocation_table_set_test_sector_identifiers(
+	 allocation_table );
+
+	result = libolecf_allocation_table_compact(
+	          allocation_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "allocation_table->number_of_runs",
+	 allocation_table->number_of_runs,
+	 3 );
+
+	/* Test regular cases including the first and last entry of every run
+	 * The runs are: entries 0 to 98 the chain, entry 99 the end of chain
+	 * and entries 100 to 255 the unused sectors
+	 */
+	for( entry_index = 0;
+	     entry_index < 256;
+	     entry_index++ )
+	{
+		if( entry_index < 99 )
+		{
+			expected_run_index = 0;
+		}
+		else if( entry_index == 99 )
+		{
+			expected_run_index = 1;
+		}
+		else
+		{
+			expected_run_index = 2;
+		}
+		run_index = libolecf_allocation_table_get_run_index_by_entry_index(
+		             allocation_table,
+		             entry_index );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "run_index",
+		 run_index,
+		 expected_run_index );
+	}
+	/* Clean up
+	 */
+	result = libolecf_allocation_table_free(
+	          &allocation_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "allocation_table",
+	 allocation_table );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( allocation_table != NULL )
+	{
+		libolecf_allocation_table_free(
+		 &allocation_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_allocation_table_scan_sector_identifiers function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_allocation_table_scan_sector_identifiers(
+     void )
+{
+	uint32_t sector_identifiers[ 24 ];
+
+	int end_index   = 0;
+	int entry_index = 0;
+	int index       = 0;
+	int result      = 0;
+	int start_index = 0;
+
+	/* Test regular cases with the matching entry in every position,
+	 * including every lane of a vector and the tail that is shorter
+	 * than a vector
+	 */
+	for( start_index = 0;
+	     start_index < 4;
+	     start_index++ )
+	{
+		for( end_index = start_index;
+		     end_index <= 24;
+		     end_index++ )
+		{
+			for( entry_index = start_index;
+			     entry_index <= end_index;
+			     entry_index++ )
+			{
+				for( index = 0;
+				     index < 24;
+				     index++ )
+				{
+					if( index == entry_index )
+					{
+						sector_identifiers[ index ] = 0xfffffffeUL;
+					}
+					else
+					{
+						sector_identifiers[ index ] = 0xffffffffUL;
+					}
+				}
+				/* An entry index of end index means there is no such entry
+				 */
+				result = libolecf_allocation_table_scan_sector_identifiers(
+				          sector_identifiers,
+				          start_index,
+				          end_index,
+				          0xfffffffeUL,
+				          1 );
+
+				OLECF_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 entry_index );
+
+				result = libolecf_allocation_table_scan_sector_identifiers(
+				          sector_identifiers,
+				          start_index,
+				          end_index,
+				          0xffffffffUL,
+				          0 );
+
+				OLECF_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 entry_index );
+			}
+		}
+	}
+	/* Test that the first of multiple matching entries is returned
+	 */
+	for( index = 0;
+	     index < 24;
+	     index++ )
+	{
+		sector_identifiers[ index ] = (uint32_t) ( index % 8 );
+	}
+	result = libolecf_allocation_table_scan_sector_identifiers(
+	          sector_identifiers,
+	          0,
+	          24,
+	          7,
+	          1 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 7 );
+
+	result = libolecf_allocation_table_scan_sector_identifiers(
+	          sector_identifiers,
+	          8,
+	          24,
+	          0,
+	          0 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 9 );
+
+	result = libolecf_allocation_table_scan_sector_identifiers(
+	          sector_identifiers,
+	          0,
+	          24,
+	          8,
+	          1 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 24 );
+
+	/* Test start index equal to end index
+	 */
+	result = libolecf_allocation_table_scan_sector_identifiers(
+	          sector_identifiers,
+	          5,
+	          5,
+	          5,
+	          1 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 5 );
+
+	result = libolecf_allocation_table_scan_sector_identifiers(
+	          sector_identifiers,
+	          5,
+	          5,
+	          5,
+	          0 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 5 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libolecf_allocation_table_get_sector_identifier_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_allocation_table_get_sector_identifier_by_index(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libolecf_allocation_table_t *allocation_table = NULL;
+	uint32_t expected_sector_identifier           = 0;
+	uint32_t sector_identifier                    = 0;
+	int entry_index                               = 0;
+	int pass_index                                = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_allocation_table_initialize(
+	          &allocation_table,
+	          256,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_table",
+	 allocation_table );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	olecf_test_allocation_table_set_test_sector_identifiers(
+	 allocation_table );
+
+	/* Test regular cases with the sector identifiers stored as-is
+	 * and run-length encoded
+	 */
+	for( pass_index = 0;
+	     pass_index < 2;
+	     pass_index++ )
+	{
+		if( pass_index == 1 )
+		{
+			result = libolecf_allocation_table_compact(
+			          allocation_table,
+			          &error );
+
+			OLECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		for( entry_index = 0;
+		     entry_index < 256;
+		     entry_index++ )
+		{
+			if( entry_index < 99 )
+			{
+				expected_sector_identifier = (uint32_t) entry_index + 1;
+			}
+			else if( entry_index == 99 )
+			{
+				expected_sector_identifier = 0xfffffffeUL;
+			}
+			else
+			{
+				expected_sector_identifier = 0xffffffffUL;
+			}
+			result = libolecf_allocation_table_get_sector_identifier_by_index(
+			          allocation_table,
+			          entry_index,
+			          &sector_identifier,
+			          &error );
+
+			OLECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			OLECF_TEST_ASSERT_EQUAL_UINT32(
+			 "sector_identifier",
+			 sector_identifier,
+			 expected_sector_identifier );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Test error cases
+	 */
+	result = libolecf_allocation_table_get_sector_identifier_by_index(
+	          NULL,
+	          0,
+	          &sector_identifier,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_allocation_table_get_sector_identifier_by_index(
+	          allocation_table,
+	          256,
+	          &sector_identifier,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_allocation_table_get_sector_identifier_by_index(
+	          allocation_table,
+	          0,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_allocation_table_free(
+	          &allocation_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "allocation_table",
+	 allocation_table );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( allocation_table != NULL )
+	{
+		libolecf_allocation_table_free(
+		 &allocation_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_allocation_table_get_unused_range function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_allocation_table_get_unused_range(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libolecf_allocation_table_t *allocation_table = NULL;
+	int pass_index                                = 0;
+	int range_entry_index                         = 0;
+	int range_number_of_entries                   = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_allocation_table_initialize(
+	          &allocation_table,
+	          256,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_table",
+	 allocation_table );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	olecf_test_allocation_table_set_test_sector_identifiers(
+	 allocation_table );
+
+	/* Test regular cases with the sector identifiers stored as-is
+	 * and run-length encoded
+	 */
+	for( pass_index = 0;
+	     pass_index < 2;
+	     pass_index++ )
+	{
+		if( pass_index == 1 )
+		{
+			result = libolecf_allocation_table_compact(
+			          allocation_table,
+			          &error );
+
+			OLECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libolecf_allocation_table_get_unused_range(
+		          allocation_table,
+		          0,
+		          &range_entry_index,
+		          &range_number_of_entries,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "range_entry_index",
+		 range_entry_index,
+		 100 );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "range_number_of_entries",
+		 range_number_of_entries,
+		 156 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libolecf_allocation_table_get_unused_range(
+		          allocation_table,
+		          201,
+		          &range_entry_index,
+		          &range_number_of_entries,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "range_entry_index",
+		 range_entry_index,
+		 201 );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "range_number_of_entries",
+		 range_number_of_entries,
+		 55 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libolecf_allocation_table_get_unused_range(
+		          allocation_table,
+		          256,
+		          &range_entry_index,
+		          &range_number_of_entries,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libolecf_allocation_table_get_unused_range(
+	          NULL,
+	          0,
+	          &range_entry_index,
+	          &range_number_of_entries,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_allocation_table_get_unused_range(
+	          allocation_table,
+	          -1,
+	          &range_entry_index,
+	          &range_number_of_entries,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_allocation_table_get_unused_range(
+	          allocation_table,
+	          0,
+	          NULL,
+	          &range_number_of_entries,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_allocation_table_get_unused_range(
+	          allocation_table,
+	          0,
+	          &range_entry_index,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_allocation_table_free(
+	          &allocation_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "allocation_table",
+	 allocation_table );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( allocation_table != NULL )
+	{
+		libolecf_allocation_table_free(
+		 &allocation_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
 
 /* The main program
@@ -304,7 +1360,35 @@ int main(
 
 	/* TODO: add tests for libolecf_allocation_table_resize */
 
-	/* TODO: add tests for libolecf_allocation_table_get_sector_identifier_by_index */
+	/* TODO: add tests for libolecf_allocation_table_set_table_sectors */
+
+	/* TODO: add tests for libolecf_allocation_table_read_table_sector */
+
+	/* TODO: add tests for libolecf_allocation_table_read_all_table_sectors */
+
+	OLECF_TEST_RUN(
+	 "libolecf_allocation_table_compact",
+	 olecf_test_allocation_table_compact );
+
+	OLECF_TEST_RUN(
+	 "libolecf_allocation_table_get_memory_size",
+	 olecf_test_allocation_table_get_memory_size );
+
+	OLECF_TEST_RUN(
+	 "libolecf_allocation_table_get_run_index_by_entry_index",
+	 olecf_test_allocation_table_get_run_index_by_entry_index );
+
+	OLECF_TEST_RUN(
+	 "libolecf_allocation_table_scan_sector_identifiers",
+	 olecf_test_allocation_table_scan_sector_identifiers );
+
+	OLECF_TEST_RUN(
+	 "libolecf_allocation_table_get_unused_range",
+	 olecf_test_allocation_table_get_unused_range );
+
+	OLECF_TEST_RUN(
+	 "libolecf_allocation_table_get_sector_identifier_by_index",
+	 olecf_test_allocation_table_get_sector_identifier_by_index );
 
 #endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
 
@@ -0,0 +1,837 @@
+/*
+ * Library block_cache type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "olecf_test_libcerror.h"
+#include "olecf_test_libolecf.h"
+#include "olecf_test_macros.h"
+#include "olecf_test_memory.h"
+#include "olecf_test_unused.h"
+
+#include "../libolecf/libolecf_block_cache.h"
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+/* Tests the libolecf_block_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_block_cache_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libolecf_block_cache_t *block_cache = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_OLECF_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 4;
+	int number_of_memset_fail_tests     = 1;
+	int test_number                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libolecf_block_cache_initialize(
+	          &block_cache,
+	          4,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_block_cache_initialize(
+	          NULL,
+	          4,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	block_cache = (libolecf_block_cache_t *) 0x12345678UL;
+
+	result = libolecf_block_cache_initialize(
+	          &block_cache,
+	          4,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	block_cache = NULL;
+
+	result = libolecf_block_cache_initialize(
+	          &block_cache,
+	          0,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_block_cache_initialize(
+	          &block_cache,
+	          4,
+	          0,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_OLECF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libolecf_block_cache_initialize with malloc failing
+		 */
+		olecf_test_malloc_attempts_before_fail = test_number;
+
+		result = libolecf_block_cache_initialize(
+		          &block_cache,
+		          4,
+		          16,
+		          &error );
+
+		if( olecf_test_malloc_attempts_before_fail != -1 )
+		{
+			olecf_test_malloc_attempts_before_fail = -1;
+
+			if( block_cache != NULL )
+			{
+				libolecf_block_cache_free(
+				 &block_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			OLECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "block_cache",
+			 block_cache );
+
+			OLECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libolecf_block_cache_initialize with memset failing
+		 */
+		olecf_test_memset_attempts_before_fail = test_number;
+
+		result = libolecf_block_cache_initialize(
+		          &block_cache,
+		          4,
+		          16,
+		          &error );
+
+		if( olecf_test_memset_attempts_before_fail != -1 )
+		{
+			olecf_test_memset_attempts_before_fail = -1;
+
+			if( block_cache != NULL )
+			{
+				libolecf_block_cache_free(
+				 &block_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			OLECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "block_cache",
+			 block_cache );
+
+			OLECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_OLECF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libolecf_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_block_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_block_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libolecf_block_cache_free(
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_block_cache_get_cached_block and libolecf_block_cache_set_block functions
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_block_cache_set_block(
+     void )
+{
+	uint8_t data[ 16 ];
+
+	libcerror_error_t *error            = NULL;
+	libolecf_block_cache_t *block_cache = NULL;
+	const uint8_t *block_data           = NULL;
+	size_t block_data_size              = 0;
+	int data_index                      = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < 16;
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t) ( 16 + data_index );
+	}
+	result = libolecf_block_cache_initialize(
+	          &block_cache,
+	          2,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libolecf_block_cache_get_cached_block(
+	          block_cache,
+	          16,
+	          &block_data,
+	          &block_data_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_block_cache_set_block(
+	          block_cache,
+	          16,
+	          data,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a block that is already cached is not changed
+	 */
+	result = libolecf_block_cache_set_block(
+	          block_cache,
+	          16,
+	          data,
+	          8,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_block_cache_get_cached_block(
+	          block_cache,
+	          16,
+	          &block_data,
+	          &block_data_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	OLECF_TEST_ASSERT_EQUAL_SIZE(
+	 "block_data_size",
+	 block_data_size,
+	 (size_t) 16 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT8(
+	 "block_data[ 15 ]",
+	 block_data[ 15 ],
+	 (uint8_t) 31 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "block_cache->number_of_hits",
+	 block_cache->number_of_hits,
+	 (uint64_t) 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "block_cache->number_of_misses",
+	 block_cache->number_of_misses,
+	 (uint64_t) 1 );
+
+	/* Test replacement of the least recently used block
+	 */
+	result = libolecf_block_cache_set_block(
+	          block_cache,
+	          32,
+	          data,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_block_cache_set_block(
+	          block_cache,
+	          48,
+	          data,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_block_cache_get_cached_block(
+	          block_cache,
+	          16,
+	          &block_data,
+	          &block_data_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that retrieving a block makes it the most recently used block
+	 */
+	result = libolecf_block_cache_get_cached_block(
+	          block_cache,
+	          32,
+	          &block_data,
+	          &block_data_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_block_cache_set_block(
+	          block_cache,
+	          64,
+	          data,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_block_cache_get_cached_block(
+	          block_cache,
+	          48,
+	          &block_data,
+	          &block_data_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_block_cache_get_cached_block(
+	          block_cache,
+	          32,
+	          &block_data,
+	          &block_data_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	OLECF_TEST_ASSERT_EQUAL_SIZE(
+	 "block_data_size",
+	 block_data_size,
+	 (size_t) 16 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT8(
+	 "block_data[ 15 ]",
+	 block_data[ 15 ],
+	 (uint8_t) 31 );
+
+	result = libolecf_block_cache_get_cached_block(
+	          block_cache,
+	          64,
+	          &block_data,
+	          &block_data_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "block_cache->number_of_hits",
+	 block_cache->number_of_hits,
+	 (uint64_t) 4 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "block_cache->number_of_misses",
+	 block_cache->number_of_misses,
+	 (uint64_t) 3 );
+
+	/* Test error cases
+	 */
+	result = libolecf_block_cache_get_cached_block(
+	          NULL,
+	          16,
+	          &block_data,
+	          &block_data_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_block_cache_get_cached_block(
+	          block_cache,
+	          8,
+	          &block_data,
+	          &block_data_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_block_cache_get_cached_block(
+	          block_cache,
+	          16,
+	          NULL,
+	          &block_data_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_block_cache_get_cached_block(
+	          block_cache,
+	          16,
+	          &block_data,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_block_cache_set_block(
+	          NULL,
+	          16,
+	          data,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_block_cache_set_block(
+	          block_cache,
+	          8,
+	          data,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_block_cache_set_block(
+	          block_cache,
+	          16,
+	          NULL,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_block_cache_set_block(
+	          block_cache,
+	          16,
+	          data,
+	          17,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libolecf_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc OLECF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] OLECF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc OLECF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] OLECF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	OLECF_TEST_UNREFERENCED_PARAMETER( argc )
+	OLECF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+	OLECF_TEST_RUN(
+	 "libolecf_block_cache_initialize",
+	 olecf_test_block_cache_initialize );
+
+	OLECF_TEST_RUN(
+	 "libolecf_block_cache_free",
+	 olecf_test_block_cache_free );
+
+	/* TODO: add tests for libolecf_block_cache_unlink_entry */
+
+	/* TODO: add tests for libolecf_block_cache_link_entry */
+
+	OLECF_TEST_RUN(
+	 "libolecf_block_cache_set_block",
+	 olecf_test_block_cache_set_block );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -271,6 +272,215 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libolecf_directory_entry_get_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_directory_entry_get_utf8_name(
+     void )
+{
+	uint8_t name[ 6 ] = {
+		'T', 0, 'e', 0, 0, 0 };
+
+	libcerror_error_t *error                    = NULL;
+	libolecf_directory_entry_t *directory_entry = NULL;
+	const uint8_t *cached_utf8_string           = NULL;
+	const uint8_t *utf8_string                  = NULL;
+	size_t utf8_string_size                     = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	directory_entry->name = (uint8_t *) memory_allocate(
+	                                     sizeof( uint8_t ) * 6 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry->name",
+	 directory_entry->name );
+
+	result = memory_copy(
+	          directory_entry->name,
+	          name,
+	          6 ) != NULL;
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	directory_entry->name_size = 6;
+
+	/* Test regular cases
+	 */
+	result = libolecf_directory_entry_get_utf8_name(
+	          directory_entry,
+	          LIBOLECF_ENDIAN_LITTLE,
+	          &utf8_string,
+	          &utf8_string_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "utf8_string",
+	 utf8_string );
+
+	OLECF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 3 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "Te",
+	          3 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test if the cached UTF-8 name is returned
+	 */
+	result = libolecf_directory_entry_get_utf8_name(
+	          directory_entry,
+	          LIBOLECF_ENDIAN_LITTLE,
+	          &cached_utf8_string,
+	          &utf8_string_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "cached_utf8_string == utf8_string",
+	 (int) ( cached_utf8_string == utf8_string ),
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_directory_entry_get_utf8_name(
+	          NULL,
+	          LIBOLECF_ENDIAN_LITTLE,
+	          &utf8_string,
+	          &utf8_string_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_directory_entry_get_utf8_name(
+	          directory_entry,
+	          LIBOLECF_ENDIAN_LITTLE,
+	          NULL,
+	          &utf8_string_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_directory_entry_get_utf8_name(
+	          directory_entry,
+	          LIBOLECF_ENDIAN_LITTLE,
+	          &utf8_string,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entry != NULL )
+	{
+		libolecf_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libolecf_directory_entry_compare function
  * Returns 1 if successful or 0 if not
  */
@@ -458,6 +668,10 @@ int main(
 
 	/* TODO: add tests for libolecf_directory_entry_free_not_in_tree */
 
+	OLECF_TEST_RUN(
+	 "libolecf_directory_entry_get_utf8_name",
+	 olecf_test_directory_entry_get_utf8_name );
+
 	OLECF_TEST_RUN(
 	 "libolecf_directory_entry_compare",
 	 olecf_test_directory_entry_compare );
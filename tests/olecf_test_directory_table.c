@@ -0,0 +1,1235 @@
+/*
+ * Library directory_table type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "olecf_test_libcerror.h"
+#include "olecf_test_libolecf.h"
+#include "olecf_test_macros.h"
+#include "olecf_test_memory.h"
+#include "olecf_test_unused.h"
+
+#include "../libolecf/libolecf_directory_entry.h"
+#include "../libolecf/libolecf_directory_table.h"
+
+uint8_t olecf_test_directory_table_data1[ 384 ] = {
+	0x52, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x20, 0x00, 0x45, 0x00, 0x6e, 0x00, 0x74, 0x00,
+	0x72, 0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x16, 0x00, 0x05, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x53, 0x00, 0x74, 0x00, 0x72, 0x00, 0x65, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0e, 0x00, 0x02, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+/* Tests the libolecf_directory_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_directory_table_initialize(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libolecf_directory_table_t *directory_table = NULL;
+	int result                                  = 0;
+
+#if defined( HAVE_OLECF_TEST_MEMORY )
+	int number_of_malloc_fail_tests             = 1;
+	int number_of_memset_fail_tests             = 1;
+	int test_number                             = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libolecf_directory_table_initialize(
+	          &directory_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_table",
+	 directory_table );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_directory_table_free(
+	          &directory_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "directory_table",
+	 directory_table );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_directory_table_initialize(
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	directory_table = (libolecf_directory_table_t *) 0x12345678UL;
+
+	result = libolecf_directory_table_initialize(
+	          &directory_table,
+	          &error );
+
+	directory_table = NULL;
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_OLECF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libolecf_directory_table_initialize with malloc failing
+		 */
+		olecf_test_malloc_attempts_before_fail = test_number;
+
+		result = libolecf_directory_table_initialize(
+		          &directory_table,
+		          &error );
+
+		if( olecf_test_malloc_attempts_before_fail != -1 )
+		{
+			olecf_test_malloc_attempts_before_fail = -1;
+
+			if( directory_table != NULL )
+			{
+				libolecf_directory_table_free(
+				 &directory_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			OLECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "directory_table",
+			 directory_table );
+
+			OLECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libolecf_directory_table_initialize with memset failing
+		 */
+		olecf_test_memset_attempts_before_fail = test_number;
+
+		result = libolecf_directory_table_initialize(
+		          &directory_table,
+		          &error );
+
+		if( olecf_test_memset_attempts_before_fail != -1 )
+		{
+			olecf_test_memset_attempts_before_fail = -1;
+
+			if( directory_table != NULL )
+			{
+				libolecf_directory_table_free(
+				 &directory_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			OLECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "directory_table",
+			 directory_table );
+
+			OLECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_OLECF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_table != NULL )
+	{
+		libolecf_directory_table_free(
+		 &directory_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_directory_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_directory_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libolecf_directory_table_free(
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_directory_table_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_directory_table_read_data(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libolecf_directory_entry_t *directory_entry = NULL;
+	libolecf_directory_table_t *directory_table = NULL;
+	int number_of_entries                       = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_directory_table_initialize(
+	          &directory_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_table",
+	 directory_table );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libolecf_directory_table_read_data(
+	          directory_table,
+	          olecf_test_directory_table_data1,
+	          384,
+	          LIBOLECF_ENDIAN_LITTLE,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_directory_table_get_number_of_entries(
+	          directory_table,
+	          &number_of_entries,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 3 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The names of all the directory entries are stored in the names data
+	 */
+	OLECF_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_table->names_data_size",
+	 directory_table->names_data_size,
+	 (size_t) 36 );
+
+	result = libolecf_directory_table_get_entry_by_identifier(
+	          directory_table,
+	          1,
+	          &directory_entry,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT32(
+	 "directory_entry->directory_identifier",
+	 directory_entry->directory_identifier,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT32(
+	 "directory_entry->size",
+	 directory_entry->size,
+	 32 );
+
+	OLECF_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_entry->name_size",
+	 directory_entry->name_size,
+	 (size_t) 14 );
+
+	OLECF_TEST_ASSERT_EQUAL_INTPTR(
+	 "directory_entry->name",
+	 (intptr_t) directory_entry->name,
+	 (intptr_t) &( directory_table->names_data[ 22 ] ) );
+
+	/* Test an empty directory entry
+	 */
+	result = libolecf_directory_table_get_entry_by_identifier(
+	          directory_table,
+	          2,
+	          &directory_entry,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a directory identifier that is out of bounds
+	 */
+	result = libolecf_directory_table_get_entry_by_identifier(
+	          directory_table,
+	          3,
+	          &directory_entry,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_directory_table_read_data(
+	          NULL,
+	          olecf_test_directory_table_data1,
+	          384,
+	          LIBOLECF_ENDIAN_LITTLE,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with entries value already set
+	 */
+	result = libolecf_directory_table_read_data(
+	          directory_table,
+	          olecf_test_directory_table_data1,
+	          384,
+	          LIBOLECF_ENDIAN_LITTLE,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_directory_table_free(
+	          &directory_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "directory_table",
+	 directory_table );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libolecf_directory_table_initialize(
+	          &directory_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_table",
+	 directory_table );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_directory_table_read_data(
+	          directory_table,
+	          NULL,
+	          384,
+	          LIBOLECF_ENDIAN_LITTLE,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_directory_table_read_data(
+	          directory_table,
+	          olecf_test_directory_table_data1,
+	          100,
+	          LIBOLECF_ENDIAN_LITTLE,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_directory_table_read_data(
+	          directory_table,
+	          olecf_test_directory_table_data1,
+	          384,
+	          0xff,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_directory_table_free(
+	          &directory_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "directory_table",
+	 directory_table );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_table != NULL )
+	{
+		libolecf_directory_table_free(
+		 &directory_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_directory_table_get_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_directory_table_get_number_of_entries(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libolecf_directory_table_t *directory_table = NULL;
+	int number_of_entries                       = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_directory_table_initialize(
+	          &directory_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_table",
+	 directory_table );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_directory_table_read_data(
+	          directory_table,
+	          olecf_test_directory_table_data1,
+	          384,
+	          LIBOLECF_ENDIAN_LITTLE,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libolecf_directory_table_get_number_of_entries(
+	          directory_table,
+	          &number_of_entries,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 3 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_directory_table_get_number_of_entries(
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_directory_table_get_number_of_entries(
+	          directory_table,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_directory_table_free(
+	          &directory_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "directory_table",
+	 directory_table );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_table != NULL )
+	{
+		libolecf_directory_table_free(
+		 &directory_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_directory_table_get_entry_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_directory_table_get_entry_by_identifier(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libolecf_directory_entry_t *directory_entry = NULL;
+	libolecf_directory_table_t *directory_table = NULL;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_directory_table_initialize(
+	          &directory_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_table",
+	 directory_table );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_directory_table_read_data(
+	          directory_table,
+	          olecf_test_directory_table_data1,
+	          384,
+	          LIBOLECF_ENDIAN_LITTLE,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libolecf_directory_table_get_entry_by_identifier(
+	          directory_table,
+	          0,
+	          &directory_entry,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT32(
+	 "directory_entry->directory_identifier",
+	 directory_entry->directory_identifier,
+	 0 );
+
+	OLECF_TEST_ASSERT_EQUAL_INTPTR(
+	 "directory_entry",
+	 (intptr_t) directory_entry,
+	 (intptr_t) &( directory_table->entries[ 0 ] ) );
+
+	/* Test the last used directory entry
+	 */
+	result = libolecf_directory_table_get_entry_by_identifier(
+	          directory_table,
+	          1,
+	          &directory_entry,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT32(
+	 "directory_entry->directory_identifier",
+	 directory_entry->directory_identifier,
+	 1 );
+
+	/* Test an unused directory entry
+	 */
+	result = libolecf_directory_table_get_entry_by_identifier(
+	          directory_table,
+	          2,
+	          &directory_entry,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a directory identifier that is out of bounds
+	 */
+	result = libolecf_directory_table_get_entry_by_identifier(
+	          directory_table,
+	          3,
+	          &directory_entry,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the largest positive directory identifier
+	 */
+	result = libolecf_directory_table_get_entry_by_identifier(
+	          directory_table,
+	          0x7fffffffUL,
+	          &directory_entry,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test directory identifiers that are negative when interpreted as a signed integer
+	 */
+	result = libolecf_directory_table_get_entry_by_identifier(
+	          directory_table,
+	          0x80000000UL,
+	          &directory_entry,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_directory_table_get_entry_by_identifier(
+	          directory_table,
+	          (uint32_t) -1,
+	          &directory_entry,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_directory_table_get_entry_by_identifier(
+	          NULL,
+	          0,
+	          &directory_entry,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_directory_table_get_entry_by_identifier(
+	          directory_table,
+	          0,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_directory_table_free(
+	          &directory_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "directory_table",
+	 directory_table );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_table != NULL )
+	{
+		libolecf_directory_table_free(
+		 &directory_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_directory_table_set_sub_nodes_read function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_directory_table_set_sub_nodes_read(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libolecf_directory_table_t *directory_table = NULL;
+	int entry_index                             = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_directory_table_initialize(
+	          &directory_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_table",
+	 directory_table );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_directory_table_read_data(
+	          directory_table,
+	          olecf_test_directory_table_data1,
+	          384,
+	          LIBOLECF_ENDIAN_LITTLE,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < directory_table->number_of_entries;
+	     entry_index++ )
+	{
+		OLECF_TEST_ASSERT_EQUAL_UINT8(
+		 "directory_table->entries[ entry_index ].sub_nodes_read",
+		 directory_table->entries[ entry_index ].sub_nodes_read,
+		 0 );
+	}
+	/* Test regular cases
+	 */
+	result = libolecf_directory_table_set_sub_nodes_read(
+	          directory_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that all the directory entries, including the unused ones, are marked as read
+	 */
+	for( entry_index = 0;
+	     entry_index < directory_table->number_of_entries;
+	     entry_index++ )
+	{
+		OLECF_TEST_ASSERT_EQUAL_UINT8(
+		 "directory_table->entries[ entry_index ].sub_nodes_read",
+		 directory_table->entries[ entry_index ].sub_nodes_read,
+		 1 );
+	}
+	/* Test error cases
+	 */
+	result = libolecf_directory_table_set_sub_nodes_read(
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_directory_table_free(
+	          &directory_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "directory_table",
+	 directory_table );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_table != NULL )
+	{
+		libolecf_directory_table_free(
+		 &directory_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc OLECF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] OLECF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc OLECF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] OLECF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	OLECF_TEST_UNREFERENCED_PARAMETER( argc )
+	OLECF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+	OLECF_TEST_RUN(
+	 "libolecf_directory_table_initialize",
+	 olecf_test_directory_table_initialize );
+
+	OLECF_TEST_RUN(
+	 "libolecf_directory_table_free",
+	 olecf_test_directory_table_free );
+
+	OLECF_TEST_RUN(
+	 "libolecf_directory_table_read_data",
+	 olecf_test_directory_table_read_data );
+
+	OLECF_TEST_RUN(
+	 "libolecf_directory_table_get_number_of_entries",
+	 olecf_test_directory_table_get_number_of_entries );
+
+	OLECF_TEST_RUN(
+	 "libolecf_directory_table_get_entry_by_identifier",
+	 olecf_test_directory_table_get_entry_by_identifier );
+
+	OLECF_TEST_RUN(
+	 "libolecf_directory_table_set_sub_nodes_read",
+	 olecf_test_directory_table_set_sub_nodes_read );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+}
+
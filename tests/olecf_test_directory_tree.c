@@ -0,0 +1,1315 @@
+/*
+ * Library directory_tree functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "olecf_test_libcdata.h"
+#include "olecf_test_libcerror.h"
+#include "olecf_test_libolecf.h"
+#include "olecf_test_macros.h"
+#include "olecf_test_memory.h"
+#include "olecf_test_unused.h"
+
+#include "../libolecf/libolecf_directory_entry.h"
+#include "../libolecf/libolecf_directory_table.h"
+#include "../libolecf/libolecf_directory_tree.h"
+
+/* The directory identifier that indicates an unused directory entry reference
+ */
+#define OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER 0xffffffffUL
+
+/* The number of directory entries used to test deep previous and next chains
+ */
+#define OLECF_TEST_DIRECTORY_TREE_NUMBER_OF_ENTRIES 1024
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+/* Sets the data of a directory entry
+ */
+void olecf_test_directory_tree_set_directory_entry_data(
+      uint8_t *data,
+      uint8_t type,
+      uint32_t previous_directory_identifier,
+      uint32_t next_directory_identifier,
+      uint32_t sub_directory_identifier )
+{
+	memory_set(
+	 data,
+	 0,
+	 128 );
+
+	/* The name: "A" as UTF-16 little-endian with end-of-string character
+	 */
+	data[ 0 ] = (uint8_t) 'A';
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( data[ 64 ] ),
+	 4 );
+
+	data[ 66 ] = type;
+	data[ 67 ] = 1;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 68 ] ),
+	 previous_directory_identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 72 ] ),
+	 next_directory_identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 76 ] ),
+	 sub_directory_identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 116 ] ),
+	 0x00000020UL );
+}
+
+/* Creates a directory table and reads the directory entries data
+ * Returns 1 if successful or -1 on error
+ */
+int olecf_test_directory_tree_read_directory_table(
+     libolecf_directory_table_t **directory_table,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "olecf_test_directory_tree_read_directory_table";
+
+	if( libolecf_directory_table_initialize(
+	     directory_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libolecf_directory_table_read_data(
+	     *directory_table,
+	     data,
+	     data_size,
+	     LIBOLECF_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory table.",
+		 function );
+
+		libolecf_directory_table_free(
+		 directory_table,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a directory table and retrieves the sub directory entries of the root directory entry
+ * Returns 1 if successful or -1 on error
+ */
+int olecf_test_directory_tree_get_root_sub_directory_entries(
+     libolecf_directory_table_t **directory_table,
+     const uint8_t *data,
+     size_t data_size,
+     libolecf_directory_entry_t ***sub_directory_entries,
+     int *number_of_sub_directory_entries,
+     libcerror_error_t **error )
+{
+	libolecf_directory_entry_t *directory_entry = NULL;
+	int result                                  = 0;
+
+	if( olecf_test_directory_tree_read_directory_table(
+	     directory_table,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	result = libolecf_directory_table_get_entry_by_identifier(
+	          *directory_table,
+	          0,
+	          &directory_entry,
+	          error );
+
+	if( result == 1 )
+	{
+		result = libolecf_directory_tree_get_sub_directory_entries(
+		          *directory_table,
+		          directory_entry,
+		          sub_directory_entries,
+		          number_of_sub_directory_entries,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libolecf_directory_table_free(
+		 directory_table,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the libolecf_directory_tree_create function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_directory_tree_create(
+     void )
+{
+	uint8_t data[ 512 ];
+
+	libcdata_tree_node_t *directory_tree_root_node                           = NULL;
+	libcdata_tree_node_t *sub_directory_tree_node                            = NULL;
+	libcerror_error_t *error                                                 = NULL;
+	libolecf_directory_entry_t *document_summary_information_directory_entry = NULL;
+	libolecf_directory_entry_t *previous_sub_directory_entry                 = NULL;
+	libolecf_directory_entry_t *sub_directory_entry                          = NULL;
+	libolecf_directory_entry_t *summary_information_directory_entry          = NULL;
+	libolecf_directory_table_t *directory_table                              = NULL;
+	uint32_t short_sector_stream_start_sector_identifier                     = 0;
+	int number_of_sub_nodes                                                  = 0;
+	int result                                                               = 0;
+	int sub_node_index                                                       = 0;
+
+	/* Initialize test
+	 * The root storage refers to entry 2 that refers to entries 1 and 3
+	 */
+	olecf_test_directory_tree_set_directory_entry_data(
+	 &( data[ 0 ] ),
+	 LIBOLECF_ITEM_TYPE_ROOT_STORAGE,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER,
+	 2 );
+
+	olecf_test_directory_tree_set_directory_entry_data(
+	 &( data[ 128 ] ),
+	 LIBOLECF_ITEM_TYPE_STREAM,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER );
+
+	olecf_test_directory_tree_set_directory_entry_data(
+	 &( data[ 256 ] ),
+	 LIBOLECF_ITEM_TYPE_STORAGE,
+	 1,
+	 3,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER );
+
+	olecf_test_directory_tree_set_directory_entry_data(
+	 &( data[ 384 ] ),
+	 LIBOLECF_ITEM_TYPE_STREAM,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER );
+
+	result = olecf_test_directory_tree_read_directory_table(
+	          &directory_table,
+	          data,
+	          512,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libolecf_directory_tree_create(
+	          &directory_tree_root_node,
+	          &short_sector_stream_start_sector_identifier,
+	          &document_summary_information_directory_entry,
+	          &summary_information_directory_entry,
+	          directory_table,
+	          LIBOLECF_ENDIAN_LITTLE,
+	          0,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_tree_root_node",
+	 directory_tree_root_node );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT32(
+	 "short_sector_stream_start_sector_identifier",
+	 short_sector_stream_start_sector_identifier,
+	 (uint32_t) 0x00000020UL );
+
+	result = libcdata_tree_node_get_number_of_sub_nodes(
+	          directory_tree_root_node,
+	          &number_of_sub_nodes,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_nodes",
+	 number_of_sub_nodes,
+	 3 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the sub nodes are sorted by directory identifier
+	 */
+	for( sub_node_index = 0;
+	     sub_node_index < number_of_sub_nodes;
+	     sub_node_index++ )
+	{
+		result = libcdata_tree_node_get_sub_node_by_index(
+		          directory_tree_root_node,
+		          sub_node_index,
+		          &sub_directory_tree_node,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcdata_tree_node_get_value(
+		          sub_directory_tree_node,
+		          (intptr_t **) &sub_directory_entry,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NOT_NULL(
+		 "sub_directory_entry",
+		 sub_directory_entry );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		OLECF_TEST_ASSERT_EQUAL_UINT32(
+		 "sub_directory_entry->directory_identifier",
+		 sub_directory_entry->directory_identifier,
+		 (uint32_t) ( sub_node_index + 1 ) );
+
+		if( previous_sub_directory_entry != NULL )
+		{
+			result = libolecf_directory_entry_compare(
+			          previous_sub_directory_entry,
+			          sub_directory_entry,
+			          &error );
+
+			OLECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 LIBCDATA_COMPARE_LESS );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		previous_sub_directory_entry = sub_directory_entry;
+	}
+	/* The directory entries are managed by the directory table
+	 */
+	result = libcdata_tree_node_free(
+	          &directory_tree_root_node,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_directory_table_free(
+	          &directory_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a directory table without directory entries
+	 */
+	result = olecf_test_directory_tree_read_directory_table(
+	          &directory_table,
+	          data,
+	          0,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_directory_tree_create(
+	          &directory_tree_root_node,
+	          &short_sector_stream_start_sector_identifier,
+	          &document_summary_information_directory_entry,
+	          &summary_information_directory_entry,
+	          directory_table,
+	          LIBOLECF_ENDIAN_LITTLE,
+	          0,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "directory_tree_root_node",
+	 directory_tree_root_node );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_directory_table_free(
+	          &directory_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = olecf_test_directory_tree_read_directory_table(
+	          &directory_table,
+	          data,
+	          512,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_directory_tree_create(
+	          NULL,
+	          &short_sector_stream_start_sector_identifier,
+	          &document_summary_information_directory_entry,
+	          &summary_information_directory_entry,
+	          directory_table,
+	          LIBOLECF_ENDIAN_LITTLE,
+	          0,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	directory_tree_root_node = (libcdata_tree_node_t *) 0x12345678UL;
+
+	result = libolecf_directory_tree_create(
+	          &directory_tree_root_node,
+	          &short_sector_stream_start_sector_identifier,
+	          &document_summary_information_directory_entry,
+	          &summary_information_directory_entry,
+	          directory_table,
+	          LIBOLECF_ENDIAN_LITTLE,
+	          0,
+	          &error );
+
+	directory_tree_root_node = NULL;
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_directory_tree_create(
+	          &directory_tree_root_node,
+	          NULL,
+	          &document_summary_information_directory_entry,
+	          &summary_information_directory_entry,
+	          directory_table,
+	          LIBOLECF_ENDIAN_LITTLE,
+	          0,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_directory_table_free(
+	          &directory_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a sibling directory identifier that refers back to the root storage
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 384 + 72 ] ),
+	 0 );
+
+	result = olecf_test_directory_tree_read_directory_table(
+	          &directory_table,
+	          data,
+	          512,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_directory_tree_create(
+	          &directory_tree_root_node,
+	          &short_sector_stream_start_sector_identifier,
+	          &document_summary_information_directory_entry,
+	          &summary_information_directory_entry,
+	          directory_table,
+	          LIBOLECF_ENDIAN_LITTLE,
+	          0,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "directory_tree_root_node",
+	 directory_tree_root_node );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_directory_table_free(
+	          &directory_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_tree_root_node != NULL )
+	{
+		libcdata_tree_node_free(
+		 &directory_tree_root_node,
+		 NULL,
+		 NULL );
+	}
+	if( directory_table != NULL )
+	{
+		libolecf_directory_table_free(
+		 &directory_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_directory_tree_get_sub_directory_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_directory_tree_get_sub_directory_entries(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libolecf_directory_entry_t **sub_directory_entries = NULL;
+	libolecf_directory_entry_t directory_entry;
+	libolecf_directory_table_t *directory_table        = NULL;
+	uint8_t *data                                      = NULL;
+	size_t data_size                                   = 0;
+	uint32_t directory_identifier                      = 0;
+	int entry_index                                    = 0;
+	int number_of_sub_directory_entries                = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	data_size = 128 * OLECF_TEST_DIRECTORY_TREE_NUMBER_OF_ENTRIES;
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	/* Test a deep chain of next directory identifiers
+	 */
+	olecf_test_directory_tree_set_directory_entry_data(
+	 data,
+	 LIBOLECF_ITEM_TYPE_ROOT_STORAGE,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER,
+	 1 );
+
+	for( entry_index = 1;
+	     entry_index < OLECF_TEST_DIRECTORY_TREE_NUMBER_OF_ENTRIES;
+	     entry_index++ )
+	{
+		directory_identifier = (uint32_t) entry_index + 1;
+
+		if( directory_identifier >= OLECF_TEST_DIRECTORY_TREE_NUMBER_OF_ENTRIES )
+		{
+			directory_identifier = OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER;
+		}
+		olecf_test_directory_tree_set_directory_entry_data(
+		 &( data[ entry_index * 128 ] ),
+		 LIBOLECF_ITEM_TYPE_STREAM,
+		 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER,
+		 directory_identifier,
+		 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER );
+	}
+	result = olecf_test_directory_tree_get_root_sub_directory_entries(
+	          &directory_table,
+	          data,
+	          data_size,
+	          &sub_directory_entries,
+	          &number_of_sub_directory_entries,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_directory_entries",
+	 sub_directory_entries );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_directory_entries",
+	 number_of_sub_directory_entries,
+	 OLECF_TEST_DIRECTORY_TREE_NUMBER_OF_ENTRIES - 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 sub_directory_entries );
+
+	sub_directory_entries = NULL;
+
+	result = libolecf_directory_table_free(
+	          &directory_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a deep chain of previous directory identifiers
+	 */
+	for( entry_index = 1;
+	     entry_index < OLECF_TEST_DIRECTORY_TREE_NUMBER_OF_ENTRIES;
+	     entry_index++ )
+	{
+		directory_identifier = (uint32_t) entry_index + 1;
+
+		if( directory_identifier >= OLECF_TEST_DIRECTORY_TREE_NUMBER_OF_ENTRIES )
+		{
+			directory_identifier = OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER;
+		}
+		olecf_test_directory_tree_set_directory_entry_data(
+		 &( data[ entry_index * 128 ] ),
+		 LIBOLECF_ITEM_TYPE_STREAM,
+		 directory_identifier,
+		 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER,
+		 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER );
+	}
+	result = olecf_test_directory_tree_get_root_sub_directory_entries(
+	          &directory_table,
+	          data,
+	          data_size,
+	          &sub_directory_entries,
+	          &number_of_sub_directory_entries,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_directory_entries",
+	 sub_directory_entries );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_directory_entries",
+	 number_of_sub_directory_entries,
+	 OLECF_TEST_DIRECTORY_TREE_NUMBER_OF_ENTRIES - 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the sub directory entries are sorted by directory identifier
+	 */
+	for( entry_index = 0;
+	     entry_index < number_of_sub_directory_entries;
+	     entry_index++ )
+	{
+		OLECF_TEST_ASSERT_EQUAL_UINT32(
+		 "sub_directory_entries[ entry_index ]->directory_identifier",
+		 sub_directory_entries[ entry_index ]->directory_identifier,
+		 (uint32_t) ( entry_index + 1 ) );
+	}
+	memory_free(
+	 sub_directory_entries );
+
+	sub_directory_entries = NULL;
+
+	result = libolecf_directory_table_free(
+	          &directory_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test out of range directory identifiers
+	 * A previous directory identifier that refers to a missing directory entry is ignored
+	 */
+	olecf_test_directory_tree_set_directory_entry_data(
+	 &( data[ 128 ] ),
+	 LIBOLECF_ITEM_TYPE_STREAM,
+	 OLECF_TEST_DIRECTORY_TREE_NUMBER_OF_ENTRIES + 16,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER );
+
+	result = olecf_test_directory_tree_get_root_sub_directory_entries(
+	          &directory_table,
+	          data,
+	          data_size,
+	          &sub_directory_entries,
+	          &number_of_sub_directory_entries,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_directory_entries",
+	 number_of_sub_directory_entries,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 sub_directory_entries );
+
+	sub_directory_entries = NULL;
+
+	result = libolecf_directory_table_free(
+	          &directory_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A next directory identifier that refers to a missing directory entry is an error
+	 */
+	olecf_test_directory_tree_set_directory_entry_data(
+	 &( data[ 128 ] ),
+	 LIBOLECF_ITEM_TYPE_STREAM,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER,
+	 OLECF_TEST_DIRECTORY_TREE_NUMBER_OF_ENTRIES + 16,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER );
+
+	result = olecf_test_directory_tree_get_root_sub_directory_entries(
+	          &directory_table,
+	          data,
+	          data_size,
+	          &sub_directory_entries,
+	          &number_of_sub_directory_entries,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "sub_directory_entries",
+	 sub_directory_entries );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* A sub directory identifier that refers to a missing directory entry is ignored
+	 */
+	olecf_test_directory_tree_set_directory_entry_data(
+	 data,
+	 LIBOLECF_ITEM_TYPE_ROOT_STORAGE,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER,
+	 OLECF_TEST_DIRECTORY_TREE_NUMBER_OF_ENTRIES + 16 );
+
+	result = olecf_test_directory_tree_get_root_sub_directory_entries(
+	          &directory_table,
+	          data,
+	          data_size,
+	          &sub_directory_entries,
+	          &number_of_sub_directory_entries,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "sub_directory_entries",
+	 sub_directory_entries );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_directory_entries",
+	 number_of_sub_directory_entries,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_directory_table_free(
+	          &directory_table,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a cycle of directory identifiers
+	 */
+	olecf_test_directory_tree_set_directory_entry_data(
+	 data,
+	 LIBOLECF_ITEM_TYPE_ROOT_STORAGE,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER,
+	 1 );
+
+	olecf_test_directory_tree_set_directory_entry_data(
+	 &( data[ 128 ] ),
+	 LIBOLECF_ITEM_TYPE_STREAM,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER,
+	 2,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER );
+
+	olecf_test_directory_tree_set_directory_entry_data(
+	 &( data[ 256 ] ),
+	 LIBOLECF_ITEM_TYPE_STREAM,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER,
+	 1,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER );
+
+	result = olecf_test_directory_tree_get_root_sub_directory_entries(
+	          &directory_table,
+	          data,
+	          data_size,
+	          &sub_directory_entries,
+	          &number_of_sub_directory_entries,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "sub_directory_entries",
+	 sub_directory_entries );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a directory entry that is referred to more than once
+	 */
+	olecf_test_directory_tree_set_directory_entry_data(
+	 &( data[ 128 ] ),
+	 LIBOLECF_ITEM_TYPE_STREAM,
+	 2,
+	 2,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER );
+
+	olecf_test_directory_tree_set_directory_entry_data(
+	 &( data[ 256 ] ),
+	 LIBOLECF_ITEM_TYPE_STREAM,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER,
+	 OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER );
+
+	result = olecf_test_directory_tree_get_root_sub_directory_entries(
+	          &directory_table,
+	          data,
+	          data_size,
+	          &sub_directory_entries,
+	          &number_of_sub_directory_entries,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "sub_directory_entries",
+	 sub_directory_entries );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	memory_set(
+	 &directory_entry,
+	 0,
+	 sizeof( libolecf_directory_entry_t ) );
+
+	directory_entry.sub_directory_identifier = OLECF_TEST_DIRECTORY_TREE_UNUSED_IDENTIFIER;
+
+	result = libolecf_directory_tree_get_sub_directory_entries(
+	          NULL,
+	          NULL,
+	          &sub_directory_entries,
+	          &number_of_sub_directory_entries,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_directory_tree_get_sub_directory_entries(
+	          NULL,
+	          &directory_entry,
+	          NULL,
+	          &number_of_sub_directory_entries,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_directory_tree_get_sub_directory_entries(
+	          NULL,
+	          &directory_entry,
+	          &sub_directory_entries,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sub_directory_entries != NULL )
+	{
+		memory_free(
+		 sub_directory_entries );
+	}
+	if( directory_table != NULL )
+	{
+		libolecf_directory_table_free(
+		 &directory_table,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_directory_tree_sort_directory_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_directory_tree_sort_directory_entries(
+     void )
+{
+	libolecf_directory_entry_t directory_entries[ 64 ];
+	libolecf_directory_entry_t *sorted_directory_entries[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int entry_index          = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 * The directory identifiers are not ordered and contain duplicates
+	 */
+	memory_set(
+	 directory_entries,
+	 0,
+	 sizeof( libolecf_directory_entry_t ) * 64 );
+
+	for( entry_index = 0;
+	     entry_index < 64;
+	     entry_index++ )
+	{
+		directory_entries[ entry_index ].directory_identifier = (uint32_t) ( ( entry_index * 29 ) % 48 );
+
+		sorted_directory_entries[ entry_index ] = &( directory_entries[ entry_index ] );
+	}
+	/* Test regular cases
+	 */
+	result = libolecf_directory_tree_sort_directory_entries(
+	          sorted_directory_entries,
+	          64,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 1;
+	     entry_index < 64;
+	     entry_index++ )
+	{
+		result = libolecf_directory_entry_compare(
+		          sorted_directory_entries[ entry_index - 1 ],
+		          sorted_directory_entries[ entry_index ],
+		          &error );
+
+		OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 LIBCDATA_COMPARE_GREATER );
+
+		OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test that directory entries with the same directory identifier keep their order
+	 */
+	for( entry_index = 1;
+	     entry_index < 64;
+	     entry_index++ )
+	{
+		if( sorted_directory_entries[ entry_index - 1 ]->directory_identifier == sorted_directory_entries[ entry_index ]->directory_identifier )
+		{
+			OLECF_TEST_ASSERT_LESS_THAN_INT(
+			 "sorted_directory_entries[ entry_index - 1 ]",
+			 (int) ( sorted_directory_entries[ entry_index - 1 ] - directory_entries ),
+			 (int) ( sorted_directory_entries[ entry_index ] - directory_entries ) );
+		}
+	}
+	result = libolecf_directory_tree_sort_directory_entries(
+	          sorted_directory_entries,
+	          0,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_directory_tree_sort_directory_entries(
+	          NULL,
+	          64,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_directory_tree_sort_directory_entries(
+	          sorted_directory_entries,
+	          -1,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc OLECF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] OLECF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc OLECF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] OLECF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	OLECF_TEST_UNREFERENCED_PARAMETER( argc )
+	OLECF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+	OLECF_TEST_RUN(
+	 "libolecf_directory_tree_create",
+	 olecf_test_directory_tree_create );
+
+	/* TODO: add tests for libolecf_directory_tree_append_sub_directory_entry */
+
+	OLECF_TEST_RUN(
+	 "libolecf_directory_tree_get_sub_directory_entries",
+	 olecf_test_directory_tree_get_sub_directory_entries );
+
+	OLECF_TEST_RUN(
+	 "libolecf_directory_tree_sort_directory_entries",
+	 olecf_test_directory_tree_sort_directory_entries );
+
+	/* TODO: add tests for libolecf_directory_tree_create_sub_nodes */
+
+	/* TODO: add tests for libolecf_directory_tree_read_sub_nodes */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+}
+
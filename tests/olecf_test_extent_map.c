@@ -0,0 +1,991 @@
+/*
+ * Library extent_map type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "olecf_test_libcerror.h"
+#include "olecf_test_libolecf.h"
+#include "olecf_test_macros.h"
+#include "olecf_test_memory.h"
+#include "olecf_test_unused.h"
+
+#include "../libolecf/libolecf_extent_map.h"
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+/* Tests the libolecf_extent_map_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_extent_map_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libolecf_extent_map_t *extent_map = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_OLECF_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 1;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libolecf_extent_map_initialize(
+	          &extent_map,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_map",
+	 extent_map );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_extent_map_free(
+	          &extent_map,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "extent_map",
+	 extent_map );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_extent_map_initialize(
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	extent_map = (libolecf_extent_map_t *) 0x12345678UL;
+
+	result = libolecf_extent_map_initialize(
+	          &extent_map,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	extent_map = NULL;
+
+#if defined( HAVE_OLECF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libolecf_extent_map_initialize with malloc failing
+		 */
+		olecf_test_malloc_attempts_before_fail = test_number;
+
+		result = libolecf_extent_map_initialize(
+		          &extent_map,
+		          &error );
+
+		if( olecf_test_malloc_attempts_before_fail != -1 )
+		{
+			olecf_test_malloc_attempts_before_fail = -1;
+
+			if( extent_map != NULL )
+			{
+				libolecf_extent_map_free(
+				 &extent_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			OLECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "extent_map",
+			 extent_map );
+
+			OLECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libolecf_extent_map_initialize with memset failing
+		 */
+		olecf_test_memset_attempts_before_fail = test_number;
+
+		result = libolecf_extent_map_initialize(
+		          &extent_map,
+		          &error );
+
+		if( olecf_test_memset_attempts_before_fail != -1 )
+		{
+			olecf_test_memset_attempts_before_fail = -1;
+
+			if( extent_map != NULL )
+			{
+				libolecf_extent_map_free(
+				 &extent_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			OLECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "extent_map",
+			 extent_map );
+
+			OLECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_OLECF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_map != NULL )
+	{
+		libolecf_extent_map_free(
+		 &extent_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_extent_map_free function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_extent_map_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libolecf_extent_map_free(
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_extent_map_append_extent function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_extent_map_append_extent(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libolecf_extent_map_t *extent_map = NULL;
+	int number_of_extents             = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_extent_map_initialize(
+	          &extent_map,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_map",
+	 extent_map );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libolecf_extent_map_append_extent(
+	          extent_map,
+	          512,
+	          -1,
+	          512,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if an extent that is contiguous in the file is merged
+	 */
+	result = libolecf_extent_map_append_extent(
+	          extent_map,
+	          1024,
+	          -1,
+	          512,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_extent_map_append_extent(
+	          extent_map,
+	          4096,
+	          -1,
+	          512,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_extent_map_get_number_of_extents(
+	          extent_map,
+	          &number_of_extents,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 2 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_map->size",
+	 (uint64_t) extent_map->size,
+	 (uint64_t) 1536 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_extent_map_append_extent(
+	          NULL,
+	          512,
+	          -1,
+	          512,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_extent_map_append_extent(
+	          extent_map,
+	          -1,
+	          -1,
+	          512,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_extent_map_append_extent(
+	          extent_map,
+	          512,
+	          -1,
+	          0,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_extent_map_free(
+	          &extent_map,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "extent_map",
+	 extent_map );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_map != NULL )
+	{
+		libolecf_extent_map_free(
+		 &extent_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_extent_map_get_extent_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_extent_map_get_extent_by_index(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libolecf_extent_map_t *extent_map = NULL;
+	size64_t extent_size              = 0;
+	off64_t extent_file_offset        = 0;
+	off64_t extent_offset             = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_extent_map_initialize(
+	          &extent_map,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_map",
+	 extent_map );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_extent_map_append_extent(
+	          extent_map,
+	          4096,
+	          -1,
+	          512,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_extent_map_append_extent(
+	          extent_map,
+	          1024,
+	          -1,
+	          1024,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libolecf_extent_map_get_extent_by_index(
+	          extent_map,
+	          1,
+	          &extent_offset,
+	          &extent_file_offset,
+	          &extent_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT64(
+	 "extent_offset",
+	 (int64_t) extent_offset,
+	 (int64_t) 512 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT64(
+	 "extent_file_offset",
+	 (int64_t) extent_file_offset,
+	 (int64_t) 1024 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_size",
+	 (uint64_t) extent_size,
+	 (uint64_t) 1024 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_extent_map_get_extent_by_index(
+	          NULL,
+	          0,
+	          &extent_offset,
+	          &extent_file_offset,
+	          &extent_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_extent_map_get_extent_by_index(
+	          extent_map,
+	          2,
+	          &extent_offset,
+	          &extent_file_offset,
+	          &extent_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_extent_map_get_extent_by_index(
+	          extent_map,
+	          0,
+	          NULL,
+	          &extent_file_offset,
+	          &extent_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_extent_map_get_extent_by_index(
+	          extent_map,
+	          0,
+	          &extent_offset,
+	          NULL,
+	          &extent_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_extent_map_get_extent_by_index(
+	          extent_map,
+	          0,
+	          &extent_offset,
+	          &extent_file_offset,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_extent_map_free(
+	          &extent_map,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "extent_map",
+	 extent_map );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_map != NULL )
+	{
+		libolecf_extent_map_free(
+		 &extent_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_extent_map_get_extent_index_by_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_extent_map_get_extent_index_by_offset(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libolecf_extent_map_t *extent_map = NULL;
+	int extent_index                  = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_extent_map_initialize(
+	          &extent_map,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_map",
+	 extent_map );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_extent_map_append_extent(
+	          extent_map,
+	          4096,
+	          -1,
+	          512,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_extent_map_append_extent(
+	          extent_map,
+	          1024,
+	          -1,
+	          1024,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_extent_map_append_extent(
+	          extent_map,
+	          8192,
+	          -1,
+	          512,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libolecf_extent_map_get_extent_index_by_offset(
+	          extent_map,
+	          0,
+	          &extent_index,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "extent_index",
+	 extent_index,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_extent_map_get_extent_index_by_offset(
+	          extent_map,
+	          1535,
+	          &extent_index,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "extent_index",
+	 extent_index,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_extent_map_get_extent_index_by_offset(
+	          extent_map,
+	          1536,
+	          &extent_index,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "extent_index",
+	 extent_index,
+	 2 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_extent_map_get_extent_index_by_offset(
+	          extent_map,
+	          2048,
+	          &extent_index,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_extent_map_get_extent_index_by_offset(
+	          NULL,
+	          0,
+	          &extent_index,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_extent_map_get_extent_index_by_offset(
+	          extent_map,
+	          0,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_extent_map_free(
+	          &extent_map,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "extent_map",
+	 extent_map );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_map != NULL )
+	{
+		libolecf_extent_map_free(
+		 &extent_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc OLECF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] OLECF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc OLECF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] OLECF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	OLECF_TEST_UNREFERENCED_PARAMETER( argc )
+	OLECF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+	OLECF_TEST_RUN(
+	 "libolecf_extent_map_initialize",
+	 olecf_test_extent_map_initialize );
+
+	OLECF_TEST_RUN(
+	 "libolecf_extent_map_free",
+	 olecf_test_extent_map_free );
+
+	OLECF_TEST_RUN(
+	 "libolecf_extent_map_append_extent",
+	 olecf_test_extent_map_append_extent );
+
+	/* TODO: add tests for libolecf_extent_map_get_number_of_extents */
+
+	OLECF_TEST_RUN(
+	 "libolecf_extent_map_get_extent_by_index",
+	 olecf_test_extent_map_get_extent_by_index );
+
+	OLECF_TEST_RUN(
+	 "libolecf_extent_map_get_extent_index_by_offset",
+	 olecf_test_extent_map_get_extent_index_by_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+}
+
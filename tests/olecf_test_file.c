@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -34,6 +35,7 @@
 #include "olecf_test_getopt.h"
 #include "olecf_test_libbfio.h"
 #include "olecf_test_libcerror.h"
+#include "olecf_test_libcthreads.h"
 #include "olecf_test_libolecf.h"
 #include "olecf_test_macros.h"
 #include "olecf_test_memory.h"
@@ -48,6 +50,8 @@
 #define OLECF_TEST_FILE_VERBOSE
  */
 
+#define OLECF_TEST_FILE_NUMBER_OF_THREADS 4
+
 #if !defined( LIBOLECF_HAVE_BFIO )
 
 LIBOLECF_EXTERN \
@@ -1595,21 +1599,21 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libolecf_file_get_number_of_unallocated_blocks function
+/* Tests the libolecf_file_get_maximum_short_sector_stream_cache_size function
  * Returns 1 if successful or 0 if not
  */
-int olecf_test_file_get_number_of_unallocated_blocks(
+int olecf_test_file_get_maximum_short_sector_stream_cache_size(
      libolecf_file_t *file )
 {
-	libcerror_error_t *error         = NULL;
-	int number_of_unallocated_blocks = 0;
-	int result                       = 0;
+	libcerror_error_t *error  = NULL;
+	size_t maximum_cache_size = 0;
+	int result                = 0;
 
 	/* Test regular cases
 	 */
-	result = libolecf_file_get_number_of_unallocated_blocks(
+	result = libolecf_file_get_maximum_short_sector_stream_cache_size(
 	          file,
-	          &number_of_unallocated_blocks,
+	          &maximum_cache_size,
 	          &error );
 
 	OLECF_TEST_ASSERT_EQUAL_INT(
@@ -1623,9 +1627,9 @@ int olecf_test_file_get_number_of_unallocated_blocks(
 
 	/* Test error cases
 	 */
-	result = libolecf_file_get_number_of_unallocated_blocks(
+	result = libolecf_file_get_maximum_short_sector_stream_cache_size(
 	          NULL,
-	          &number_of_unallocated_blocks,
+	          &maximum_cache_size,
 	          &error );
 
 	OLECF_TEST_ASSERT_EQUAL_INT(
@@ -1640,7 +1644,7 @@ int olecf_test_file_get_number_of_unallocated_blocks(
 	libcerror_error_free(
 	 &error );
 
-	result = libolecf_file_get_number_of_unallocated_blocks(
+	result = libolecf_file_get_maximum_short_sector_stream_cache_size(
 	          file,
 	          NULL,
 	          &error );
@@ -1668,59 +1672,51 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libolecf_file_get_root_item function
+/* Tests the libolecf_file_set_maximum_short_sector_stream_cache_size function
  * Returns 1 if successful or 0 if not
  */
-int olecf_test_file_get_root_item(
+int olecf_test_file_set_maximum_short_sector_stream_cache_size(
      libolecf_file_t *file )
 {
-	libcerror_error_t *error   = NULL;
-	libolecf_item_t *root_item = NULL;
-	int result                 = 0;
-	int root_item_is_set       = 0;
+	libcerror_error_t *error  = NULL;
+	size_t maximum_cache_size = 0;
+	int result                = 0;
 
 	/* Test regular cases
 	 */
-	result = libolecf_file_get_root_item(
+	result = libolecf_file_get_maximum_short_sector_stream_cache_size(
 	          file,
-	          &root_item,
+	          &maximum_cache_size,
 	          &error );
 
-	OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+	OLECF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	OLECF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	root_item_is_set = result;
-
-	if( root_item_is_set != 0 )
-	{
-		OLECF_TEST_ASSERT_IS_NOT_NULL(
-		 "root_item",
-		 root_item );
+	result = libolecf_file_set_maximum_short_sector_stream_cache_size(
+	          file,
+	          0,
+	          &error );
 
-		result = libolecf_item_free(
-		          &root_item,
-		          &error );
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		OLECF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		OLECF_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
 	/* Test error cases
 	 */
-	result = libolecf_file_get_root_item(
+	result = libolecf_file_set_maximum_short_sector_stream_cache_size(
 	          NULL,
-	          &root_item,
+	          0,
 	          &error );
 
 	OLECF_TEST_ASSERT_EQUAL_INT(
@@ -1728,10 +1724,6 @@ int olecf_test_file_get_root_item(
 	 result,
 	 -1 );
 
-	OLECF_TEST_ASSERT_IS_NULL(
-	 "root_item",
-	 root_item );
-
 	OLECF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1739,29 +1731,22 @@ int olecf_test_file_get_root_item(
 	libcerror_error_free(
 	 &error );
 
-	if( root_item_is_set != 0 )
-	{
-		result = libolecf_file_get_root_item(
-		          file,
-		          NULL,
-		          &error );
-
-		OLECF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	/* Clean up
+	 */
+	result = libolecf_file_set_maximum_short_sector_stream_cache_size(
+	          file,
+	          maximum_cache_size,
+	          &error );
 
-		OLECF_TEST_ASSERT_IS_NULL(
-		 "root_item",
-		 root_item );
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		OLECF_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	return( 1 );
 
 on_error:
@@ -1770,140 +1755,3631 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( root_item != NULL )
-	{
-		libolecf_item_free(
-		 &root_item,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* The main program
+/* Tests the libolecf_file_get_maximum_block_cache_size function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc,
-     wchar_t * const argv[] )
-#else
-int main(
-     int argc,
-     char * const argv[] )
-#endif
+int olecf_test_file_get_maximum_block_cache_size(
+     libolecf_file_t *file )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	libcerror_error_t *error         = NULL;
-	libolecf_file_t *file            = NULL;
-	system_character_t *source       = NULL;
-	system_integer_t option          = 0;
-	size_t string_length             = 0;
-	int result                       = 0;
+	libcerror_error_t *error  = NULL;
+	size_t maximum_cache_size = 0;
+	int result                = 0;
 
-	while( ( option = olecf_test_getopt(
-	                   argc,
-	                   argv,
-	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
-	{
-		switch( option )
-		{
-			case (system_integer_t) '?':
-			default:
-				fprintf(
-				 stderr,
-				 "Invalid argument: %" PRIs_SYSTEM ".\n",
-				 argv[ optind - 1 ] );
+	/* Test regular cases
+	 */
+	result = libolecf_file_get_maximum_block_cache_size(
+	          file,
+	          &maximum_cache_size,
+	          &error );
 
-				return( EXIT_FAILURE );
-		}
-	}
-	if( optind < argc )
-	{
-		source = argv[ optind ];
-	}
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( OLECF_TEST_FILE_VERBOSE )
-	libolecf_notify_set_verbose(
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
 	 1 );
-	libolecf_notify_set_stream(
-	 stderr,
-	 NULL );
-#endif
-
-	OLECF_TEST_RUN(
-	 "libolecf_file_initialize",
-	 olecf_test_file_initialize );
 
-	OLECF_TEST_RUN(
-	 "libolecf_file_free",
-	 olecf_test_file_free );
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
-	if( source != NULL )
-	{
-		result = libbfio_file_initialize(
-		          &file_io_handle,
-		          &error );
+	/* Test error cases
+	 */
+	result = libolecf_file_get_maximum_block_cache_size(
+	          NULL,
+	          &maximum_cache_size,
+	          &error );
 
-		OLECF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	        OLECF_TEST_ASSERT_IS_NOT_NULL(
-	         "file_io_handle",
-	         file_io_handle );
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	        OLECF_TEST_ASSERT_IS_NULL(
-	         "error",
-	         error );
+	libcerror_error_free(
+	 &error );
 
-		string_length = system_string_length(
-		                 source );
+	result = libolecf_file_get_maximum_block_cache_size(
+	          file,
+	          NULL,
+	          &error );
 
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libbfio_file_set_name_wide(
-		          file_io_handle,
-		          source,
-		          string_length,
-		          &error );
-#else
-		result = libbfio_file_set_name(
-		          file_io_handle,
-		          source,
-		          string_length,
-		          &error );
-#endif
-		OLECF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	        OLECF_TEST_ASSERT_IS_NULL(
-	         "error",
-	         error );
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		result = libolecf_check_file_signature_file_io_handle(
-		          file_io_handle,
-		          &error );
+	libcerror_error_free(
+	 &error );
 
-		OLECF_TEST_ASSERT_NOT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	return( 1 );
 
-		OLECF_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-	if( result != 0 )
+on_error:
+	if( error != NULL )
 	{
-		OLECF_TEST_RUN_WITH_ARGS(
-		 "libolecf_file_open",
-		 olecf_test_file_open,
-		 source );
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
+/* Tests the libolecf_file_set_maximum_block_cache_size function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_file_set_maximum_block_cache_size(
+     libolecf_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	size_t maximum_cache_size = 0;
+	int result                = 0;
 
-		OLECF_TEST_RUN_WITH_ARGS(
+	/* Test regular cases
+	 */
+	result = libolecf_file_get_maximum_block_cache_size(
+	          file,
+	          &maximum_cache_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_file_set_maximum_block_cache_size(
+	          file,
+	          0,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_file_set_maximum_block_cache_size(
+	          NULL,
+	          0,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_file_set_maximum_block_cache_size(
+	          file,
+	          maximum_cache_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_file_get_allocation_table_memory_size function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_file_get_allocation_table_memory_size(
+     libolecf_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	size64_t memory_size     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libolecf_file_get_allocation_table_memory_size(
+	          file,
+	          &memory_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "memory_size",
+	 (int64_t) memory_size,
+	 (int64_t) 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_file_get_allocation_table_memory_size(
+	          NULL,
+	          &memory_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_file_get_allocation_table_memory_size(
+	          file,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_file_get_number_of_unallocated_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_file_get_number_of_unallocated_blocks(
+     libolecf_file_t *file )
+{
+	libcerror_error_t *error         = NULL;
+	int number_of_unallocated_blocks = 0;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = libolecf_file_get_number_of_unallocated_blocks(
+	          file,
+	          &number_of_unallocated_blocks,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_file_get_number_of_unallocated_blocks(
+	          NULL,
+	          &number_of_unallocated_blocks,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_file_get_number_of_unallocated_blocks(
+	          file,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_file_get_root_item function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_file_get_root_item(
+     libolecf_file_t *file )
+{
+	libcerror_error_t *error   = NULL;
+	libolecf_item_t *root_item = NULL;
+	int result                 = 0;
+	int root_item_is_set       = 0;
+
+	/* Test regular cases
+	 */
+	result = libolecf_file_get_root_item(
+	          file,
+	          &root_item,
+	          &error );
+
+	OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	root_item_is_set = result;
+
+	if( root_item_is_set != 0 )
+	{
+		OLECF_TEST_ASSERT_IS_NOT_NULL(
+		 "root_item",
+		 root_item );
+
+		result = libolecf_item_free(
+		          &root_item,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libolecf_file_get_root_item(
+	          NULL,
+	          &root_item,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "root_item",
+	 root_item );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( root_item_is_set != 0 )
+	{
+		result = libolecf_file_get_root_item(
+		          file,
+		          NULL,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "root_item",
+		 root_item );
+
+		OLECF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( root_item != NULL )
+	{
+		libolecf_item_free(
+		 &root_item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_file_clone function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_file_clone(
+     libolecf_file_t *file )
+{
+	libcerror_error_t *error          = NULL;
+	libolecf_file_t *destination_file = NULL;
+	libolecf_item_t *root_item        = NULL;
+	size32_t destination_sector_size  = 0;
+	size32_t sector_size              = 0;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libolecf_file_clone(
+	          &destination_file,
+	          file,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_file",
+	 destination_file );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_file_get_sector_size(
+	          file,
+	          &sector_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_file_get_sector_size(
+	          destination_file,
+	          &destination_sector_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT32(
+	 "destination_sector_size",
+	 (uint32_t) destination_sector_size,
+	 (uint32_t) sector_size );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_file_get_root_item(
+	          destination_file,
+	          &root_item,
+	          &error );
+
+	OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( root_item != NULL )
+	{
+		result = libolecf_item_free(
+		          &root_item,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libolecf_file_close(
+	          destination_file,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_file_free(
+	          &destination_file,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "destination_file",
+	 destination_file );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_file_clone(
+	          NULL,
+	          file,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	destination_file = (libolecf_file_t *) 0x12345678UL;
+
+	result = libolecf_file_clone(
+	          &destination_file,
+	          file,
+	          &error );
+
+	destination_file = NULL;
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_file_clone(
+	          &destination_file,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "destination_file",
+	 destination_file );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( root_item != NULL )
+	{
+		libolecf_item_free(
+		 &root_item,
+		 NULL );
+	}
+	if( destination_file != NULL )
+	{
+		libolecf_file_free(
+		 &destination_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Calculates a checksum of the names, sizes and stream data of an item and its sub items
+ * Returns 1 if successful or -1 on error
+ */
+int olecf_test_file_get_item_checksum(
+     libolecf_item_t *item,
+     uint32_t *checksum,
+     libcerror_error_t **error )
+{
+	uint8_t data[ 512 ];
+	uint8_t utf8_name[ 256 ];
+
+	libolecf_item_t *sub_item = NULL;
+	static char *function     = "olecf_test_file_get_item_checksum";
+	size_t data_index         = 0;
+	size_t utf8_name_size     = 0;
+	ssize_t read_count        = 0;
+	uint32_t item_size        = 0;
+	uint32_t read_offset      = 0;
+	uint8_t item_type         = 0;
+	int number_of_sub_items   = 0;
+	int sub_item_index        = 0;
+
+	if( checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libolecf_item_get_utf8_name_size(
+	     item,
+	     &utf8_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 name size.",
+		 function );
+
+		goto on_error;
+	}
+	if( utf8_name_size > 256 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 name size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libolecf_item_get_utf8_name(
+	     item,
+	     utf8_name,
+	     256,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 name.",
+		 function );
+
+		goto on_error;
+	}
+	for( data_index = 0;
+	     data_index < utf8_name_size;
+	     data_index++ )
+	{
+		*checksum = ( *checksum * 31 ) + utf8_name[ data_index ];
+	}
+	if( libolecf_item_get_type(
+	     item,
+	     &item_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve type.",
+		 function );
+
+		goto on_error;
+	}
+	if( libolecf_item_get_size(
+	     item,
+	     &item_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		goto on_error;
+	}
+	*checksum = ( *checksum * 31 ) + item_size;
+
+	if( item_type == LIBOLECF_ITEM_TYPE_STREAM )
+	{
+		while( read_offset < item_size )
+		{
+			read_count = libolecf_stream_read_buffer_at_offset(
+			              item,
+			              data,
+			              512,
+			              (off64_t) read_offset,
+			              error );
+
+			if( read_count <= 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read stream data at offset: %" PRIu32 ".",
+				 function,
+				 read_offset );
+
+				goto on_error;
+			}
+			for( data_index = 0;
+			     data_index < (size_t) read_count;
+			     data_index++ )
+			{
+				*checksum = ( *checksum * 31 ) + data[ data_index ];
+			}
+			read_offset += (uint32_t) read_count;
+		}
+	}
+	if( libolecf_item_get_number_of_sub_items(
+	     item,
+	     &number_of_sub_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub items.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_item_index = 0;
+	     sub_item_index < number_of_sub_items;
+	     sub_item_index++ )
+	{
+		if( libolecf_item_get_sub_item(
+		     item,
+		     sub_item_index,
+		     &sub_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		if( olecf_test_file_get_item_checksum(
+		     sub_item,
+		     checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve checksum of sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		if( libolecf_item_free(
+		     &sub_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( sub_item != NULL )
+	{
+		libolecf_item_free(
+		 &sub_item,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compares the sub items of an item with the items retrieved by path from another file
+ * Returns 1 if successful or -1 on error
+ */
+int olecf_test_file_compare_sub_items_by_path(
+     libolecf_item_t *item,
+     libolecf_file_t *compare_file,
+     uint8_t *utf8_path,
+     size_t utf8_path_size,
+     size_t utf8_path_length,
+     libcerror_error_t **error )
+{
+	libolecf_item_t *compare_item   = NULL;
+	libolecf_item_t *sub_item       = NULL;
+	static char *function           = "olecf_test_file_compare_sub_items_by_path";
+	size_t utf8_name_size           = 0;
+	uint32_t compare_item_size      = 0;
+	uint32_t sub_item_size          = 0;
+	uint8_t compare_item_type       = 0;
+	uint8_t sub_item_type           = 0;
+	int compare_number_of_sub_items = 0;
+	int number_of_sub_items         = 0;
+	int result                      = 0;
+	int sub_item_index              = 0;
+	int sub_number_of_sub_items     = 0;
+
+	if( utf8_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 path.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_path_length >= utf8_path_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libolecf_item_get_number_of_sub_items(
+	     item,
+	     &number_of_sub_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub items.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_item_index = 0;
+	     sub_item_index < number_of_sub_items;
+	     sub_item_index++ )
+	{
+		if( libolecf_item_get_sub_item(
+		     item,
+		     sub_item_index,
+		     &sub_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		if( libolecf_item_get_utf8_name_size(
+		     sub_item,
+		     &utf8_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 name size of sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		if( ( utf8_name_size == 0 )
+		 || ( utf8_name_size > ( utf8_path_size - utf8_path_length - 1 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-8 name size of sub item: %d value out of bounds.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		utf8_path[ utf8_path_length ] = (uint8_t) '\\';
+
+		if( libolecf_item_get_utf8_name(
+		     sub_item,
+		     &( utf8_path[ utf8_path_length + 1 ] ),
+		     utf8_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 name of sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		/* The UTF-8 name size includes the end-of-string character
+		 */
+		result = libolecf_file_get_item_by_utf8_path(
+		          compare_file,
+		          utf8_path,
+		          utf8_path_length + utf8_name_size,
+		          &compare_item,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve item by path: %s.",
+			 function,
+			 (char *) utf8_path );
+
+			goto on_error;
+		}
+		if( libolecf_item_get_type(
+		     sub_item,
+		     &sub_item_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve type of sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		if( libolecf_item_get_type(
+		     compare_item,
+		     &compare_item_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve type of item: %s.",
+			 function,
+			 (char *) utf8_path );
+
+			goto on_error;
+		}
+		if( libolecf_item_get_size(
+		     sub_item,
+		     &sub_item_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		if( libolecf_item_get_size(
+		     compare_item,
+		     &compare_item_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of item: %s.",
+			 function,
+			 (char *) utf8_path );
+
+			goto on_error;
+		}
+		if( libolecf_item_get_number_of_sub_items(
+		     sub_item,
+		     &sub_number_of_sub_items,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of sub items of sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		if( libolecf_item_get_number_of_sub_items(
+		     compare_item,
+		     &compare_number_of_sub_items,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of sub items of item: %s.",
+			 function,
+			 (char *) utf8_path );
+
+			goto on_error;
+		}
+		if( ( sub_item_type != compare_item_type )
+		 || ( sub_item_size != compare_item_size )
+		 || ( sub_number_of_sub_items != compare_number_of_sub_items ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISMATCH,
+			 "%s: mismatch in item: %s.",
+			 function,
+			 (char *) utf8_path );
+
+			goto on_error;
+		}
+		if( libolecf_item_free(
+		     &compare_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free item: %s.",
+			 function,
+			 (char *) utf8_path );
+
+			goto on_error;
+		}
+		if( olecf_test_file_compare_sub_items_by_path(
+		     sub_item,
+		     compare_file,
+		     utf8_path,
+		     utf8_path_size,
+		     utf8_path_length + utf8_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare sub items of sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		if( libolecf_item_free(
+		     &sub_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( compare_item != NULL )
+	{
+		libolecf_item_free(
+		 &compare_item,
+		 NULL );
+	}
+	if( sub_item != NULL )
+	{
+		libolecf_item_free(
+		 &sub_item,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests opening a file with read on demand and compares its items with those of a file opened with read
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_file_open_read_on_demand(
+     libolecf_file_t *file,
+     libbfio_handle_t *file_io_handle )
+{
+	uint8_t utf8_path[ 4096 ];
+
+	libcerror_error_t *error                  = NULL;
+	libolecf_file_t *read_on_demand_file      = NULL;
+	libolecf_item_t *read_on_demand_root_item = NULL;
+	libolecf_item_t *root_item                = NULL;
+	uint32_t checksum                         = 0;
+	uint32_t read_on_demand_checksum          = 0;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_file_get_root_item(
+	          file,
+	          &root_item,
+	          &error );
+
+	OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result == 0 )
+	{
+		return( 1 );
+	}
+	result = libolecf_file_initialize(
+	          &read_on_demand_file,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "read_on_demand_file",
+	 read_on_demand_file );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_file_open_file_io_handle(
+	          read_on_demand_file,
+	          file_io_handle,
+	          LIBOLECF_OPEN_READ_ON_DEMAND,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test retrieving the items by path before their storages were read by index
+	 */
+	result = olecf_test_file_compare_sub_items_by_path(
+	          root_item,
+	          read_on_demand_file,
+	          utf8_path,
+	          4096,
+	          0,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test retrieving the items by index
+	 */
+	result = libolecf_file_get_root_item(
+	          read_on_demand_file,
+	          &read_on_demand_root_item,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "read_on_demand_root_item",
+	 read_on_demand_root_item );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = olecf_test_file_get_item_checksum(
+	          root_item,
+	          &checksum,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = olecf_test_file_get_item_checksum(
+	          read_on_demand_root_item,
+	          &read_on_demand_checksum,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT32(
+	 "read_on_demand_checksum",
+	 read_on_demand_checksum,
+	 checksum );
+
+	/* Clean up
+	 */
+	result = libolecf_item_free(
+	          &read_on_demand_root_item,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_item_free(
+	          &root_item,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_file_close(
+	          read_on_demand_file,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_file_free(
+	          &read_on_demand_file,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_on_demand_root_item != NULL )
+	{
+		libolecf_item_free(
+		 &read_on_demand_root_item,
+		 NULL );
+	}
+	if( root_item != NULL )
+	{
+		libolecf_item_free(
+		 &root_item,
+		 NULL );
+	}
+	if( read_on_demand_file != NULL )
+	{
+		libolecf_file_close(
+		 read_on_demand_file,
+		 NULL );
+		libolecf_file_free(
+		 &read_on_demand_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Retrieves the first stream with a size within a range from an item and its sub items
+ * Returns 1 if successful, 0 if no such stream or -1 on error
+ */
+int olecf_test_file_get_stream_by_size(
+     libolecf_item_t *item,
+     uint32_t minimum_size,
+     uint32_t maximum_size,
+     libolecf_item_t **stream,
+     libcerror_error_t **error )
+{
+	libolecf_item_t *sub_item = NULL;
+	static char *function     = "olecf_test_file_get_stream_by_size";
+	uint32_t item_size        = 0;
+	uint8_t item_type         = 0;
+	int number_of_sub_items   = 0;
+	int result                = 0;
+	int sub_item_index        = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libolecf_item_get_number_of_sub_items(
+	     item,
+	     &number_of_sub_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub items.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_item_index = 0;
+	     sub_item_index < number_of_sub_items;
+	     sub_item_index++ )
+	{
+		if( libolecf_item_get_sub_item(
+		     item,
+		     sub_item_index,
+		     &sub_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		if( libolecf_item_get_type(
+		     sub_item,
+		     &item_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve type of sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		if( libolecf_item_get_size(
+		     sub_item,
+		     &item_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		if( ( item_type == LIBOLECF_ITEM_TYPE_STREAM )
+		 && ( item_size >= minimum_size )
+		 && ( item_size <= maximum_size ) )
+		{
+			*stream = sub_item;
+
+			return( 1 );
+		}
+		result = olecf_test_file_get_stream_by_size(
+		          sub_item,
+		          minimum_size,
+		          maximum_size,
+		          stream,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve stream from sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		if( libolecf_item_free(
+		     &sub_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		if( result != 0 )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+
+on_error:
+	if( sub_item != NULL )
+	{
+		libolecf_item_free(
+		 &sub_item,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the first stream that contains data from an item and its sub items
+ * Returns 1 if successful, 0 if no such stream or -1 on error
+ */
+int olecf_test_file_get_stream_with_data(
+     libolecf_item_t *item,
+     libolecf_item_t **stream,
+     libcerror_error_t **error )
+{
+	return( olecf_test_file_get_stream_by_size(
+	         item,
+	         1,
+	         0xffffffffUL,
+	         stream,
+	         error ) );
+}
+
+/* Tests opening a file memory mapped and compares its items and stream data with those of a file opened with read
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_file_open_memory_mapped(
+     libolecf_file_t *file,
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+	uint8_t data[ 512 ];
+
+	libcerror_error_t *error                 = NULL;
+	libolecf_file_t *memory_mapped_file      = NULL;
+	libolecf_item_t *memory_mapped_root_item = NULL;
+	libolecf_item_t *memory_mapped_stream    = NULL;
+	libolecf_item_t *root_item               = NULL;
+	const uint8_t *view_data                 = NULL;
+	off64_t offset                           = 0;
+	size_t compare_size                      = 0;
+	size_t view_data_size                    = 0;
+	ssize_t read_count                       = 0;
+	uint32_t checksum                        = 0;
+	uint32_t memory_mapped_checksum          = 0;
+	uint32_t stream_size                     = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_file_get_root_item(
+	          file,
+	          &root_item,
+	          &error );
+
+	OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result == 0 )
+	{
+		return( 1 );
+	}
+	result = olecf_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_file_initialize(
+	          &memory_mapped_file,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_mapped_file",
+	 memory_mapped_file );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_file_open(
+	          memory_mapped_file,
+	          narrow_source,
+	          LIBOLECF_OPEN_READ_MEMORY_MAPPED,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_file_get_root_item(
+	          memory_mapped_file,
+	          &memory_mapped_root_item,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_mapped_root_item",
+	 memory_mapped_root_item );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading the items from the memory mapped file
+	 */
+	result = olecf_test_file_get_item_checksum(
+	          root_item,
+	          &checksum,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = olecf_test_file_get_item_checksum(
+	          memory_mapped_root_item,
+	          &memory_mapped_checksum,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT32(
+	 "memory_mapped_checksum",
+	 memory_mapped_checksum,
+	 checksum );
+
+	/* Test retrieving the stream data views
+	 */
+	result = olecf_test_file_get_stream_with_data(
+	          memory_mapped_root_item,
+	          &memory_mapped_stream,
+	          &error );
+
+	OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result != 0 )
+	{
+		result = libolecf_item_get_size(
+		          memory_mapped_stream,
+		          &stream_size,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		offset = 0;
+
+		while( offset < (off64_t) stream_size )
+		{
+			result = libolecf_stream_get_data_view_at_offset(
+			          memory_mapped_stream,
+			          offset,
+			          &view_data,
+			          &view_data_size,
+			          &error );
+
+			OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			if( result == 0 )
+			{
+				break;
+			}
+			OLECF_TEST_ASSERT_IS_NOT_NULL(
+			 "view_data",
+			 view_data );
+
+			OLECF_TEST_ASSERT_NOT_EQUAL_SSIZE(
+			 "view_data_size",
+			 (ssize_t) view_data_size,
+			 (ssize_t) 0 );
+
+			OLECF_TEST_ASSERT_LESS_THAN_UINT64(
+			 "offset + view_data_size",
+			 (uint64_t) offset + view_data_size,
+			 (uint64_t) stream_size + 1 );
+
+			compare_size = view_data_size;
+
+			if( compare_size > 512 )
+			{
+				compare_size = 512;
+			}
+			read_count = libolecf_stream_read_buffer_at_offset_without_seek(
+			              memory_mapped_stream,
+			              data,
+			              compare_size,
+			              offset,
+			              &error );
+
+			OLECF_TEST_ASSERT_EQUAL_SSIZE(
+			 "read_count",
+			 read_count,
+			 (ssize_t) compare_size );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          view_data,
+			          data,
+			          compare_size );
+
+			OLECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			offset += (off64_t) view_data_size;
+		}
+		result = libolecf_item_free(
+		          &memory_mapped_stream,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libolecf_item_free(
+	          &memory_mapped_root_item,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_item_free(
+	          &root_item,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_file_close(
+	          memory_mapped_file,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_file_free(
+	          &memory_mapped_file,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_mapped_stream != NULL )
+	{
+		libolecf_item_free(
+		 &memory_mapped_stream,
+		 NULL );
+	}
+	if( memory_mapped_root_item != NULL )
+	{
+		libolecf_item_free(
+		 &memory_mapped_root_item,
+		 NULL );
+	}
+	if( root_item != NULL )
+	{
+		libolecf_item_free(
+		 &root_item,
+		 NULL );
+	}
+	if( memory_mapped_file != NULL )
+	{
+		libolecf_file_close(
+		 memory_mapped_file,
+		 NULL );
+		libolecf_file_free(
+		 &memory_mapped_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_stream_read_buffer_at_offset_without_seek function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_file_read_buffer_at_offset_without_seek(
+     libolecf_file_t *file )
+{
+	uint8_t data[ 512 ];
+	uint8_t expected_data[ 512 ];
+
+	libcerror_error_t *error   = NULL;
+	libolecf_item_t *root_item = NULL;
+	libolecf_item_t *stream    = NULL;
+	off64_t offset             = 0;
+	size_t read_size           = 0;
+	ssize_t read_count         = 0;
+	uint32_t stream_size       = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_file_get_root_item(
+	          file,
+	          &root_item,
+	          &error );
+
+	OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result != 0 )
+	{
+		result = olecf_test_file_get_stream_with_data(
+		          root_item,
+		          &stream,
+		          &error );
+
+		OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( result == 0 )
+	{
+		if( root_item != NULL )
+		{
+			libolecf_item_free(
+			 &root_item,
+			 NULL );
+		}
+		return( 1 );
+	}
+	result = libolecf_item_get_size(
+	          stream,
+	          &stream_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_size = 512;
+
+	if( read_size > (size_t) stream_size )
+	{
+		read_size = (size_t) stream_size;
+	}
+	read_count = libolecf_stream_read_buffer_at_offset(
+	              stream,
+	              expected_data,
+	              read_size,
+	              0,
+	              &error );
+
+	OLECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) read_size );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libolecf_stream_seek_offset(
+	          stream,
+	          (off64_t) ( stream_size / 2 ),
+	          SEEK_SET,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) ( stream_size / 2 ) );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libolecf_stream_read_buffer_at_offset_without_seek(
+	              stream,
+	              data,
+	              read_size,
+	              0,
+	              &error );
+
+	OLECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) read_size );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          expected_data,
+	          read_size );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that the current offset is not changed
+	 */
+	result = libolecf_stream_get_offset(
+	          stream,
+	          &offset,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) ( stream_size / 2 ) );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading at the end of the stream
+	 */
+	read_count = libolecf_stream_read_buffer_at_offset_without_seek(
+	              stream,
+	              data,
+	              read_size,
+	              (off64_t) stream_size,
+	              &error );
+
+	OLECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libolecf_stream_read_buffer_at_offset_without_seek(
+	              NULL,
+	              data,
+	              read_size,
+	              0,
+	              &error );
+
+	OLECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libolecf_stream_read_buffer_at_offset_without_seek(
+	              stream,
+	              NULL,
+	              read_size,
+	              0,
+	              &error );
+
+	OLECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libolecf_stream_read_buffer_at_offset_without_seek(
+	              stream,
+	              data,
+	              read_size,
+	              -1,
+	              &error );
+
+	OLECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that the current offset is not changed by a failed read
+	 */
+	result = libolecf_stream_get_offset(
+	          stream,
+	          &offset,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) ( stream_size / 2 ) );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libolecf_item_free(
+	          &stream,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_item_free(
+	          &root_item,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		libolecf_item_free(
+		 &stream,
+		 NULL );
+	}
+	if( root_item != NULL )
+	{
+		libolecf_item_free(
+		 &root_item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Compares stream data read with libolecf_stream_read_ranges with the same ranges read one at a time
+ * The stream must be at least 16 bytes in size
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_file_compare_stream_ranges(
+     libolecf_item_t *stream )
+{
+	uint8_t range_data[ 4 ][ 1000 ];
+	uint8_t expected_data[ 1000 ];
+	uint8_t *buffers[ 5 ];
+	size_t buffer_sizes[ 5 ];
+	off64_t offsets[ 5 ];
+
+	libcerror_error_t *error = NULL;
+	size_t range_size        = 0;
+	ssize_t read_count       = 0;
+	uint32_t stream_size     = 0;
+	int range_index          = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_item_get_size(
+	          stream,
+	          &stream_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	range_size = (size_t) ( stream_size / 4 );
+
+	if( range_size > 1000 )
+	{
+		range_size = 1000;
+	}
+	/* The ranges are not sorted by offset, the first range is far apart from the others,
+	 * the third is adjacent to the second, the fourth overlaps both and the fifth is empty
+	 */
+	buffers[ 0 ]      = range_data[ 0 ];
+	buffer_sizes[ 0 ] = range_size;
+	offsets[ 0 ]      = (off64_t) ( stream_size - range_size );
+
+	buffers[ 1 ]      = range_data[ 1 ];
+	buffer_sizes[ 1 ] = range_size;
+	offsets[ 1 ]      = 0;
+
+	buffers[ 2 ]      = range_data[ 2 ];
+	buffer_sizes[ 2 ] = range_size;
+	offsets[ 2 ]      = (off64_t) range_size;
+
+	buffers[ 3 ]      = range_data[ 3 ];
+	buffer_sizes[ 3 ] = range_size;
+	offsets[ 3 ]      = (off64_t) ( range_size / 2 );
+
+	buffers[ 4 ]      = NULL;
+	buffer_sizes[ 4 ] = 0;
+	offsets[ 4 ]      = (off64_t) stream_size;
+
+	/* Test regular cases
+	 */
+	result = libolecf_stream_read_ranges(
+	          stream,
+	          buffers,
+	          buffer_sizes,
+	          offsets,
+	          5,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( range_index = 0;
+	     range_index < 4;
+	     range_index++ )
+	{
+		read_count = libolecf_stream_read_buffer_at_offset_without_seek(
+		              stream,
+		              expected_data,
+		              buffer_sizes[ range_index ],
+		              offsets[ range_index ],
+		              &error );
+
+		OLECF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) buffer_sizes[ range_index ] );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          buffers[ range_index ],
+		          expected_data,
+		          buffer_sizes[ range_index ] );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error case where a range crosses the end of the stream
+	 */
+	offsets[ 0 ] = (off64_t) ( stream_size - ( range_size / 2 ) );
+
+	result = libolecf_stream_read_ranges(
+	          stream,
+	          buffers,
+	          buffer_sizes,
+	          offsets,
+	          5,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_stream_read_ranges function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_file_stream_read_ranges(
+     libolecf_file_t *file )
+{
+	uint8_t data[ 16 ];
+	uint8_t *buffers[ 1 ];
+	size_t buffer_sizes[ 1 ];
+	off64_t offsets[ 1 ];
+
+	libcerror_error_t *error      = NULL;
+	libolecf_item_t *root_item    = NULL;
+	libolecf_item_t *short_stream = NULL;
+	libolecf_item_t *stream       = NULL;
+	libolecf_item_t *test_stream  = NULL;
+	size_t maximum_cache_size     = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_file_get_root_item(
+	          file,
+	          &root_item,
+	          &error );
+
+	OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result == 0 )
+	{
+		return( 1 );
+	}
+	/* Streams smaller than the sector stream minimum data size of 4096 bytes
+	 * are stored in the short-sector stream
+	 */
+	result = olecf_test_file_get_stream_by_size(
+	          root_item,
+	          4096,
+	          0xffffffffUL,
+	          &stream,
+	          &error );
+
+	OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = olecf_test_file_get_stream_by_size(
+	          root_item,
+	          16,
+	          4095,
+	          &short_stream,
+	          &error );
+
+	OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	if( stream != NULL )
+	{
+		result = olecf_test_file_compare_stream_ranges(
+		          stream );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		test_stream = stream;
+	}
+	if( short_stream != NULL )
+	{
+		result = olecf_test_file_compare_stream_ranges(
+		          short_stream );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		/* Test reading the ranges from the file without the short-sector stream cache
+		 */
+		result = libolecf_file_get_maximum_short_sector_stream_cache_size(
+		          file,
+		          &maximum_cache_size,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libolecf_file_set_maximum_short_sector_stream_cache_size(
+		          file,
+		          0,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = olecf_test_file_compare_stream_ranges(
+		          short_stream );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libolecf_file_set_maximum_short_sector_stream_cache_size(
+		          file,
+		          maximum_cache_size,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		test_stream = short_stream;
+	}
+	if( test_stream != NULL )
+	{
+		buffers[ 0 ]      = data;
+		buffer_sizes[ 0 ] = 16;
+		offsets[ 0 ]      = 0;
+
+		result = libolecf_stream_read_ranges(
+		          test_stream,
+		          buffers,
+		          buffer_sizes,
+		          offsets,
+		          0,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test error cases
+		 */
+		result = libolecf_stream_read_ranges(
+		          NULL,
+		          buffers,
+		          buffer_sizes,
+		          offsets,
+		          1,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		OLECF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libolecf_stream_read_ranges(
+		          test_stream,
+		          NULL,
+		          buffer_sizes,
+		          offsets,
+		          1,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		OLECF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libolecf_stream_read_ranges(
+		          test_stream,
+		          buffers,
+		          NULL,
+		          offsets,
+		          1,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		OLECF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libolecf_stream_read_ranges(
+		          test_stream,
+		          buffers,
+		          buffer_sizes,
+		          NULL,
+		          1,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		OLECF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libolecf_stream_read_ranges(
+		          test_stream,
+		          buffers,
+		          buffer_sizes,
+		          offsets,
+		          -1,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		OLECF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		offsets[ 0 ] = -1;
+
+		result = libolecf_stream_read_ranges(
+		          test_stream,
+		          buffers,
+		          buffer_sizes,
+		          offsets,
+		          1,
+		          &error );
+
+		offsets[ 0 ] = 0;
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		OLECF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		buffers[ 0 ] = NULL;
+
+		result = libolecf_stream_read_ranges(
+		          test_stream,
+		          buffers,
+		          buffer_sizes,
+		          offsets,
+		          1,
+		          &error );
+
+		buffers[ 0 ] = data;
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		OLECF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	if( short_stream != NULL )
+	{
+		result = libolecf_item_free(
+		          &short_stream,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( stream != NULL )
+	{
+		result = libolecf_item_free(
+		          &stream,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libolecf_item_free(
+	          &root_item,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( short_stream != NULL )
+	{
+		libolecf_item_free(
+		 &short_stream,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		libolecf_item_free(
+		 &stream,
+		 NULL );
+	}
+	if( root_item != NULL )
+	{
+		libolecf_item_free(
+		 &root_item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Reads data from the start of a stream for the block cache statistics tests
+ * Returns 1 if successful or -1 on error
+ */
+int olecf_test_file_read_stream_start(
+     libolecf_item_t *stream,
+     size_t read_size,
+     libcerror_error_t **error )
+{
+	uint8_t data[ 16 ];
+
+	static char *function = "olecf_test_file_read_stream_start";
+	ssize_t read_count    = 0;
+
+	if( read_size > 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libolecf_stream_read_buffer_at_offset_without_seek(
+	              stream,
+	              data,
+	              read_size,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read stream data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the libolecf_file_get_block_cache_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_file_get_block_cache_statistics(
+     libolecf_file_t *file )
+{
+	libcerror_error_t *error                      = NULL;
+	libolecf_item_t *root_item                    = NULL;
+	libolecf_item_t *stream                       = NULL;
+	size_t cache_size                             = 0;
+	size_t maximum_cache_size                     = 0;
+	size_t maximum_short_sector_stream_cache_size = 0;
+	size_t read_size                              = 0;
+	uint64_t number_of_hits                       = 0;
+	uint64_t number_of_misses                     = 0;
+	uint32_t stream_size                          = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_file_get_root_item(
+	          file,
+	          &root_item,
+	          &error );
+
+	OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result != 0 )
+	{
+		result = olecf_test_file_get_stream_with_data(
+		          root_item,
+		          &stream,
+		          &error );
+
+		OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( result == 0 )
+	{
+		if( root_item != NULL )
+		{
+			libolecf_item_free(
+			 &root_item,
+			 NULL );
+		}
+		return( 1 );
+	}
+	result = libolecf_item_get_size(
+	          stream,
+	          &stream_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_size = 16;
+
+	if( read_size > (size_t) stream_size )
+	{
+		read_size = (size_t) stream_size;
+	}
+	result = libolecf_file_get_maximum_block_cache_size(
+	          file,
+	          &maximum_cache_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_file_get_maximum_short_sector_stream_cache_size(
+	          file,
+	          &maximum_short_sector_stream_cache_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Disable the short-sector stream cache so that short-sector streams
+	 * are read using the block cache as well
+	 */
+	result = libolecf_file_set_maximum_short_sector_stream_cache_size(
+	          file,
+	          0,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that setting the maximum block cache size clears the statistics
+	 */
+	result = libolecf_file_set_maximum_block_cache_size(
+	          file,
+	          4 * 4096,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_file_get_block_cache_statistics(
+	          file,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 0 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the first small read is a miss
+	 */
+	result = olecf_test_file_read_stream_start(
+	          stream,
+	          read_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_file_get_block_cache_statistics(
+	          file,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 0 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that repeated small reads of the same block are hits
+	 */
+	result = olecf_test_file_read_stream_start(
+	          stream,
+	          read_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = olecf_test_file_read_stream_start(
+	          stream,
+	          read_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_file_get_block_cache_statistics(
+	          file,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 2 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a maximum block cache size of 0 disables the block cache
+	 */
+	result = libolecf_file_set_maximum_block_cache_size(
+	          file,
+	          0,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_file_get_maximum_block_cache_size(
+	          file,
+	          &cache_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_SIZE(
+	 "cache_size",
+	 cache_size,
+	 (size_t) 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = olecf_test_file_read_stream_start(
+	          stream,
+	          read_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_file_get_block_cache_statistics(
+	          file,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 0 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_file_get_block_cache_statistics(
+	          NULL,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_file_get_block_cache_statistics(
+	          file,
+	          NULL,
+	          &number_of_misses,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_file_get_block_cache_statistics(
+	          file,
+	          &number_of_hits,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_file_set_maximum_block_cache_size(
+	          file,
+	          maximum_cache_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_file_set_maximum_short_sector_stream_cache_size(
+	          file,
+	          maximum_short_sector_stream_cache_size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_item_free(
+	          &stream,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_item_free(
+	          &root_item,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		libolecf_item_free(
+		 &stream,
+		 NULL );
+	}
+	if( root_item != NULL )
+	{
+		libolecf_item_free(
+		 &root_item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The values of a thread that reads the items of a file
+ */
+typedef struct olecf_test_file_thread_values olecf_test_file_thread_values_t;
+
+struct olecf_test_file_thread_values
+{
+	/* The file
+	 */
+	libolecf_file_t *file;
+
+	/* The checksum of the items
+	 */
+	uint32_t checksum;
+
+	/* The result
+	 */
+	int result;
+};
+
+/* Reads the items of a file in a thread
+ * Returns 1 if successful or -1 on error
+ */
+int olecf_test_file_read_items_thread_callback(
+     void *arguments )
+{
+	olecf_test_file_thread_values_t *thread_values = NULL;
+	libolecf_item_t *root_item                     = NULL;
+
+	thread_values = (olecf_test_file_thread_values_t *) arguments;
+
+	if( thread_values == NULL )
+	{
+		return( -1 );
+	}
+	thread_values->checksum = 0;
+	thread_values->result   = libolecf_file_get_root_item(
+	                           thread_values->file,
+	                           &root_item,
+	                           NULL );
+
+	if( thread_values->result == 1 )
+	{
+		thread_values->result = olecf_test_file_get_item_checksum(
+		                         root_item,
+		                         &( thread_values->checksum ),
+		                         NULL );
+	}
+	if( root_item != NULL )
+	{
+		if( libolecf_item_free(
+		     &root_item,
+		     NULL ) != 1 )
+		{
+			thread_values->result = -1;
+		}
+	}
+	return( thread_values->result );
+}
+
+/* Tests reading the items of a file from multiple threads
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_file_read_items_multi_threaded(
+     libolecf_file_t *file )
+{
+	olecf_test_file_thread_values_t thread_values[ OLECF_TEST_FILE_NUMBER_OF_THREADS ];
+	libcthreads_thread_t *threads[ OLECF_TEST_FILE_NUMBER_OF_THREADS ];
+
+	libcerror_error_t *error   = NULL;
+	libolecf_item_t *root_item = NULL;
+	uint32_t checksum          = 0;
+	int result                 = 0;
+	int thread_index           = 0;
+
+	for( thread_index = 0;
+	     thread_index < OLECF_TEST_FILE_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		threads[ thread_index ] = NULL;
+	}
+	/* Determine the checksum of the items read from a single thread
+	 */
+	result = libolecf_file_get_root_item(
+	          file,
+	          &root_item,
+	          &error );
+
+	OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result == 0 )
+	{
+		return( 1 );
+	}
+	result = olecf_test_file_get_item_checksum(
+	          root_item,
+	          &checksum,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_item_free(
+	          &root_item,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading the same file from multiple threads
+	 */
+	for( thread_index = 0;
+	     thread_index < OLECF_TEST_FILE_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		thread_values[ thread_index ].file     = file;
+		thread_values[ thread_index ].checksum = 0;
+		thread_values[ thread_index ].result   = 0;
+
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          olecf_test_file_read_items_thread_callback,
+		          (void *) &( thread_values[ thread_index ] ),
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < OLECF_TEST_FILE_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "thread_values[ thread_index ].result",
+		 thread_values[ thread_index ].result,
+		 1 );
+
+		OLECF_TEST_ASSERT_EQUAL_UINT32(
+		 "thread_values[ thread_index ].checksum",
+		 thread_values[ thread_index ].checksum,
+		 checksum );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < OLECF_TEST_FILE_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	if( root_item != NULL )
+	{
+		libolecf_item_free(
+		 &root_item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libolecf_file_t *file            = NULL;
+	system_character_t *source       = NULL;
+	system_integer_t option          = 0;
+	size_t string_length             = 0;
+	int result                       = 0;
+
+	while( ( option = olecf_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( OLECF_TEST_FILE_VERBOSE )
+	libolecf_notify_set_verbose(
+	 1 );
+	libolecf_notify_set_stream(
+	 stderr,
+	 NULL );
+#endif
+
+	OLECF_TEST_RUN(
+	 "libolecf_file_initialize",
+	 olecf_test_file_initialize );
+
+	OLECF_TEST_RUN(
+	 "libolecf_file_free",
+	 olecf_test_file_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		result = libbfio_file_initialize(
+		          &file_io_handle,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+	        OLECF_TEST_ASSERT_IS_NOT_NULL(
+	         "file_io_handle",
+	         file_io_handle );
+
+	        OLECF_TEST_ASSERT_IS_NULL(
+	         "error",
+	         error );
+
+		string_length = system_string_length(
+		                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libbfio_file_set_name_wide(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#else
+		result = libbfio_file_set_name(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#endif
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+	        OLECF_TEST_ASSERT_IS_NULL(
+	         "error",
+	         error );
+
+		result = libolecf_check_file_signature_file_io_handle(
+		          file_io_handle,
+		          &error );
+
+		OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( result != 0 )
+	{
+		OLECF_TEST_RUN_WITH_ARGS(
+		 "libolecf_file_open",
+		 olecf_test_file_open,
+		 source );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+		OLECF_TEST_RUN_WITH_ARGS(
 		 "libolecf_file_open_wide",
 		 olecf_test_file_open_wide,
 		 source );
@@ -1975,6 +5451,31 @@ int main(
 		 olecf_test_file_set_ascii_codepage,
 		 file );
 
+		OLECF_TEST_RUN_WITH_ARGS(
+		 "libolecf_file_get_maximum_short_sector_stream_cache_size",
+		 olecf_test_file_get_maximum_short_sector_stream_cache_size,
+		 file );
+
+		OLECF_TEST_RUN_WITH_ARGS(
+		 "libolecf_file_set_maximum_short_sector_stream_cache_size",
+		 olecf_test_file_set_maximum_short_sector_stream_cache_size,
+		 file );
+
+		OLECF_TEST_RUN_WITH_ARGS(
+		 "libolecf_file_get_maximum_block_cache_size",
+		 olecf_test_file_get_maximum_block_cache_size,
+		 file );
+
+		OLECF_TEST_RUN_WITH_ARGS(
+		 "libolecf_file_set_maximum_block_cache_size",
+		 olecf_test_file_set_maximum_block_cache_size,
+		 file );
+
+		OLECF_TEST_RUN_WITH_ARGS(
+		 "libolecf_file_get_allocation_table_memory_size",
+		 olecf_test_file_get_allocation_table_memory_size,
+		 file );
+
 		/* TODO: add tests for libolecf_file_get_format_version */
 
 		OLECF_TEST_RUN_WITH_ARGS(
@@ -1993,6 +5494,47 @@ int main(
 
 		/* TODO: add tests for libolecf_file_get_item_by_utf16_path */
 
+		OLECF_TEST_RUN_WITH_ARGS(
+		 "libolecf_file_clone",
+		 olecf_test_file_clone,
+		 file );
+
+		OLECF_TEST_RUN_WITH_ARGS(
+		 "libolecf_stream_read_buffer_at_offset_without_seek",
+		 olecf_test_file_read_buffer_at_offset_without_seek,
+		 file );
+
+		OLECF_TEST_RUN_WITH_ARGS(
+		 "libolecf_stream_read_ranges",
+		 olecf_test_file_stream_read_ranges,
+		 file );
+
+		OLECF_TEST_RUN_WITH_ARGS(
+		 "libolecf_file_get_block_cache_statistics",
+		 olecf_test_file_get_block_cache_statistics,
+		 file );
+
+		OLECF_TEST_RUN_WITH_ARGS(
+		 "libolecf_file_open_read_on_demand",
+		 olecf_test_file_open_read_on_demand,
+		 file,
+		 file_io_handle );
+
+		OLECF_TEST_RUN_WITH_ARGS(
+		 "libolecf_file_open_memory_mapped",
+		 olecf_test_file_open_memory_mapped,
+		 file,
+		 source );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+		OLECF_TEST_RUN_WITH_ARGS(
+		 "libolecf_file_read_items_multi_threaded",
+		 olecf_test_file_read_items_multi_threaded,
+		 file );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 		/* Clean up
 		 */
 		result = olecf_test_file_close_source(
@@ -21,12 +21,15 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "olecf_test_functions.h"
+#include "olecf_test_libbfio.h"
 #include "olecf_test_libcerror.h"
 #include "olecf_test_libolecf.h"
 #include "olecf_test_macros.h"
@@ -398,6 +401,488 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libolecf_io_handle_read_block_cache_data function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_io_handle_read_block_cache_data(
+     void )
+{
+	uint8_t buffer[ 128 ];
+	uint8_t data[ 12388 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libolecf_io_handle_t *io_handle  = NULL;
+	ssize_t read_count               = 0;
+	size_t data_index                = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 * The data consists of 3 blocks of 4096 bytes followed by a partial block of 100 bytes
+	 */
+	for( data_index = 0;
+	     data_index < 12388;
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t) ( data_index % 251 );
+	}
+	result = olecf_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          12388,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Limit the block cache to 2 blocks
+	 */
+	io_handle->maximum_block_cache_size = 2 * 4096;
+
+	/* Test regular cases
+	 */
+	/* Test that the first read of a block is a miss and creates the block cache
+	 */
+	read_count = libolecf_io_handle_read_block_cache_data(
+	          io_handle,
+	          file_io_handle,
+	          10,
+	          buffer,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ 10 ] ),
+	          16 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->block_cache->number_of_hits",
+	 io_handle->block_cache->number_of_hits,
+	 (uint64_t) 0 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->block_cache->number_of_misses",
+	 io_handle->block_cache->number_of_misses,
+	 (uint64_t) 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "io_handle->block_cache->number_of_entries",
+	 io_handle->block_cache->number_of_entries,
+	 2 );
+
+	/* Test that a subsequent read of the same block is a hit
+	 */
+	read_count = libolecf_io_handle_read_block_cache_data(
+	          io_handle,
+	          file_io_handle,
+	          20,
+	          buffer,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ 20 ] ),
+	          16 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->block_cache->number_of_hits",
+	 io_handle->block_cache->number_of_hits,
+	 (uint64_t) 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->block_cache->number_of_misses",
+	 io_handle->block_cache->number_of_misses,
+	 (uint64_t) 1 );
+
+	/* Test a read that spans 2 blocks, the first block is cached, the second is not
+	 */
+	read_count = libolecf_io_handle_read_block_cache_data(
+	          io_handle,
+	          file_io_handle,
+	          4090,
+	          buffer,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ 4090 ] ),
+	          16 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->block_cache->number_of_hits",
+	 io_handle->block_cache->number_of_hits,
+	 (uint64_t) 2 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->block_cache->number_of_misses",
+	 io_handle->block_cache->number_of_misses,
+	 (uint64_t) 2 );
+
+	/* Test that reading a third block replaces the least recently used block
+	 */
+	read_count = libolecf_io_handle_read_block_cache_data(
+	          io_handle,
+	          file_io_handle,
+	          8192,
+	          buffer,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ 8192 ] ),
+	          16 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->block_cache->number_of_hits",
+	 io_handle->block_cache->number_of_hits,
+	 (uint64_t) 2 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->block_cache->number_of_misses",
+	 io_handle->block_cache->number_of_misses,
+	 (uint64_t) 3 );
+
+	/* Test that the replaced block is no longer cached
+	 */
+	read_count = libolecf_io_handle_read_block_cache_data(
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          buffer,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ 0 ] ),
+	          16 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->block_cache->number_of_hits",
+	 io_handle->block_cache->number_of_hits,
+	 (uint64_t) 2 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->block_cache->number_of_misses",
+	 io_handle->block_cache->number_of_misses,
+	 (uint64_t) 4 );
+
+	/* Test that the most recently used block is still cached
+	 */
+	read_count = libolecf_io_handle_read_block_cache_data(
+	          io_handle,
+	          file_io_handle,
+	          8202,
+	          buffer,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ 8202 ] ),
+	          16 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->block_cache->number_of_hits",
+	 io_handle->block_cache->number_of_hits,
+	 (uint64_t) 3 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->block_cache->number_of_misses",
+	 io_handle->block_cache->number_of_misses,
+	 (uint64_t) 4 );
+
+	/* Test a read of the partial block at the end of the data
+	 */
+	read_count = libolecf_io_handle_read_block_cache_data(
+	          io_handle,
+	          file_io_handle,
+	          12338,
+	          buffer,
+	          100,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 50 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ 12338 ] ),
+	          50 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->block_cache->number_of_hits",
+	 io_handle->block_cache->number_of_hits,
+	 (uint64_t) 3 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->block_cache->number_of_misses",
+	 io_handle->block_cache->number_of_misses,
+	 (uint64_t) 5 );
+
+	/* Test error cases
+	 */
+	read_count = libolecf_io_handle_read_block_cache_data(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          buffer,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libolecf_io_handle_read_block_cache_data(
+	          io_handle,
+	          file_io_handle,
+	          -1,
+	          buffer,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libolecf_io_handle_read_block_cache_data(
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          NULL,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libolecf_io_handle_read_block_cache_data(
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = olecf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libolecf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
 
 /* The main program
@@ -429,6 +914,8 @@ int main(
 	 "libolecf_io_handle_clear",
 	 olecf_test_io_handle_clear );
 
+	/* TODO: add tests for libolecf_io_handle_copy_values */
+
 	/* TODO: add tests for libolecf_io_handle_read_msat */
 
 	/* TODO: add tests for libolecf_io_handle_read_sat */
@@ -437,6 +924,10 @@ int main(
 
 	/* TODO: add tests for libolecf_io_handle_read_directory_entries */
 
+	OLECF_TEST_RUN(
+	 "libolecf_io_handle_read_block_cache_data",
+	 olecf_test_io_handle_read_block_cache_data );
+
 	/* TODO: add tests for libolecf_io_handle_read_stream */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
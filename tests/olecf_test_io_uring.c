@@ -0,0 +1,919 @@
+/*
+ * Library io_uring type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "olecf_test_libcerror.h"
+#include "olecf_test_libolecf.h"
+#include "olecf_test_macros.h"
+#include "olecf_test_memory.h"
+#include "olecf_test_unused.h"
+
+#include "../libolecf/libolecf_io_uring.h"
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+/* Tests the libolecf_io_uring_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_io_uring_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libolecf_io_uring_t *io_uring   = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_OLECF_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libolecf_io_uring_initialize(
+	          &io_uring,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_uring",
+	 io_uring );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_io_uring_free(
+	          &io_uring,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "io_uring",
+	 io_uring );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_io_uring_initialize(
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_uring = (libolecf_io_uring_t *) 0x12345678UL;
+
+	result = libolecf_io_uring_initialize(
+	          &io_uring,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_uring = NULL;
+
+#if defined( HAVE_OLECF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libolecf_io_uring_initialize with malloc failing
+		 */
+		olecf_test_malloc_attempts_before_fail = test_number;
+
+		result = libolecf_io_uring_initialize(
+		          &io_uring,
+		          &error );
+
+		if( olecf_test_malloc_attempts_before_fail != -1 )
+		{
+			olecf_test_malloc_attempts_before_fail = -1;
+
+			if( io_uring != NULL )
+			{
+				libolecf_io_uring_free(
+				 &io_uring,
+				 NULL );
+			}
+		}
+		else
+		{
+			OLECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "io_uring",
+			 io_uring );
+
+			OLECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libolecf_io_uring_initialize with memset failing
+		 */
+		olecf_test_memset_attempts_before_fail = test_number;
+
+		result = libolecf_io_uring_initialize(
+		          &io_uring,
+		          &error );
+
+		if( olecf_test_memset_attempts_before_fail != -1 )
+		{
+			olecf_test_memset_attempts_before_fail = -1;
+
+			if( io_uring != NULL )
+			{
+				libolecf_io_uring_free(
+				 &io_uring,
+				 NULL );
+			}
+		}
+		else
+		{
+			OLECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "io_uring",
+			 io_uring );
+
+			OLECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_OLECF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_uring != NULL )
+	{
+		libolecf_io_uring_free(
+		 &io_uring,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_io_uring_free function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_io_uring_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libolecf_io_uring_free(
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_io_uring_open function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_io_uring_open(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libolecf_io_uring_t *io_uring = NULL;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_io_uring_initialize(
+	          &io_uring,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_uring",
+	 io_uring );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libolecf_io_uring_open(
+	          io_uring,
+	          8,
+	          &error );
+
+	OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result == 0 )
+	{
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "io_uring->file_descriptor",
+		 io_uring->file_descriptor,
+		 -1 );
+	}
+	else
+	{
+		OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+		 "io_uring->file_descriptor",
+		 io_uring->file_descriptor,
+		 -1 );
+
+		/* Test error cases
+		 */
+		result = libolecf_io_uring_open(
+		          io_uring,
+		          8,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		OLECF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libolecf_io_uring_close(
+		          io_uring,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libolecf_io_uring_open(
+	          NULL,
+	          8,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_io_uring_open(
+	          io_uring,
+	          0,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_io_uring_free(
+	          &io_uring,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "io_uring",
+	 io_uring );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_uring != NULL )
+	{
+		libolecf_io_uring_free(
+		 &io_uring,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_io_uring_close function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_io_uring_close(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libolecf_io_uring_close(
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_io_uring_prepare_read function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_io_uring_prepare_read(
+     void )
+{
+	uint8_t buffer[ 64 ];
+
+	libcerror_error_t *error      = NULL;
+	libolecf_io_uring_t *io_uring = NULL;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_io_uring_initialize(
+	          &io_uring,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_uring",
+	 io_uring );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_io_uring_prepare_read(
+	          NULL,
+	          0,
+	          buffer,
+	          64,
+	          0,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libolecf_io_uring_prepare_read with the queues not set up
+	 */
+	result = libolecf_io_uring_prepare_read(
+	          io_uring,
+	          0,
+	          buffer,
+	          64,
+	          0,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_io_uring_open(
+	          io_uring,
+	          8,
+	          &error );
+
+	OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result != 0 )
+	{
+		result = libolecf_io_uring_prepare_read(
+		          io_uring,
+		          -1,
+		          buffer,
+		          64,
+		          0,
+		          NULL,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		OLECF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libolecf_io_uring_prepare_read(
+		          io_uring,
+		          0,
+		          NULL,
+		          64,
+		          0,
+		          NULL,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		OLECF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libolecf_io_uring_prepare_read(
+		          io_uring,
+		          0,
+		          buffer,
+		          0,
+		          0,
+		          NULL,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		OLECF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libolecf_io_uring_prepare_read(
+		          io_uring,
+		          0,
+		          buffer,
+		          64,
+		          -1,
+		          NULL,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		OLECF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libolecf_io_uring_free(
+	          &io_uring,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "io_uring",
+	 io_uring );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_uring != NULL )
+	{
+		libolecf_io_uring_free(
+		 &io_uring,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_io_uring_get_completion function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_io_uring_get_completion(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libolecf_io_uring_t *io_uring = NULL;
+	intptr_t *user_data           = NULL;
+	int32_t read_result           = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_io_uring_initialize(
+	          &io_uring,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_uring",
+	 io_uring );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_io_uring_get_completion(
+	          NULL,
+	          &user_data,
+	          &read_result,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libolecf_io_uring_get_completion with the queues not set up
+	 */
+	result = libolecf_io_uring_get_completion(
+	          io_uring,
+	          &user_data,
+	          &read_result,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_io_uring_open(
+	          io_uring,
+	          8,
+	          &error );
+
+	OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result != 0 )
+	{
+		/* Test regular cases
+		 */
+		result = libolecf_io_uring_get_completion(
+		          io_uring,
+		          &user_data,
+		          &read_result,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test error cases
+		 */
+		result = libolecf_io_uring_get_completion(
+		          io_uring,
+		          NULL,
+		          &read_result,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		OLECF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libolecf_io_uring_get_completion(
+		          io_uring,
+		          &user_data,
+		          NULL,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		OLECF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libolecf_io_uring_free(
+	          &io_uring,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "io_uring",
+	 io_uring );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_uring != NULL )
+	{
+		libolecf_io_uring_free(
+		 &io_uring,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc OLECF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] OLECF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc OLECF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] OLECF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	OLECF_TEST_UNREFERENCED_PARAMETER( argc )
+	OLECF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+	OLECF_TEST_RUN(
+	 "libolecf_io_uring_initialize",
+	 olecf_test_io_uring_initialize );
+
+	OLECF_TEST_RUN(
+	 "libolecf_io_uring_free",
+	 olecf_test_io_uring_free );
+
+	OLECF_TEST_RUN(
+	 "libolecf_io_uring_open",
+	 olecf_test_io_uring_open );
+
+	OLECF_TEST_RUN(
+	 "libolecf_io_uring_close",
+	 olecf_test_io_uring_close );
+
+	OLECF_TEST_RUN(
+	 "libolecf_io_uring_prepare_read",
+	 olecf_test_io_uring_prepare_read );
+
+	OLECF_TEST_RUN(
+	 "libolecf_io_uring_get_completion",
+	 olecf_test_io_uring_get_completion );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+}
+
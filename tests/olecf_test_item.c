@@ -21,20 +21,165 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "olecf_test_getopt.h"
+#include "olecf_test_libbfio.h"
 #include "olecf_test_libcerror.h"
 #include "olecf_test_libolecf.h"
 #include "olecf_test_macros.h"
 #include "olecf_test_memory.h"
-#include "olecf_test_unused.h"
 
+#include "../libolecf/libolecf_extent_map.h"
 #include "../libolecf/libolecf_item.h"
 
+#if !defined( LIBOLECF_HAVE_BFIO )
+
+LIBOLECF_EXTERN \
+int libolecf_check_file_signature_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBOLECF_EXTERN \
+int libolecf_file_open_file_io_handle(
+     libolecf_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libolecf_error_t **error );
+
+#endif /* !defined( LIBOLECF_HAVE_BFIO ) */
+
+/* Creates and opens a source file
+ * Returns 1 if successful or -1 on error
+ */
+int olecf_test_item_open_source(
+     libolecf_file_t **file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "olecf_test_item_open_source";
+	int result            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libolecf_file_initialize(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+	result = libolecf_file_open_file_io_handle(
+	          *file,
+	          file_io_handle,
+	          LIBOLECF_OPEN_READ,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file != NULL )
+	{
+		libolecf_file_free(
+		 file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes and frees a source file
+ * Returns 1 if successful or -1 on error
+ */
+int olecf_test_item_close_source(
+     libolecf_file_t **file,
+     libcerror_error_t **error )
+{
+	static char *function = "olecf_test_item_close_source";
+	int result            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libolecf_file_close(
+	     *file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		result = -1;
+	}
+	if( libolecf_file_free(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
 /* Tests the libolecf_item_free function
  * Returns 1 if successful or 0 if not
  */
@@ -75,23 +220,559 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
 
+/* Compares the extents of an item and its sub items with the stream data
+ * Returns 1 if the extents match the stream data, 0 if not or -1 on error
+ */
+int olecf_test_item_compare_extents(
+     libolecf_item_t *item,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t extent_data[ 512 ];
+	uint8_t stream_data[ 512 ];
+
+	libolecf_extent_map_t *extent_map = NULL;
+	libolecf_item_t *sub_item         = NULL;
+	static char *function             = "olecf_test_item_compare_extents";
+	off64_t extent_file_offset        = 0;
+	off64_t map_extent_file_offset    = 0;
+	off64_t map_extent_offset         = 0;
+	off64_t stream_offset             = 0;
+	size64_t data_offset              = 0;
+	size64_t extent_size              = 0;
+	size64_t map_extent_size          = 0;
+	size_t read_size                  = 0;
+	ssize_t read_count                = 0;
+	uint32_t item_size                = 0;
+	uint8_t item_type                 = 0;
+	int extent_index                  = 0;
+	int map_number_of_extents         = 0;
+	int number_of_extents             = 0;
+	int number_of_sub_items           = 0;
+	int result                        = 0;
+	int sub_item_index                = 0;
+
+	if( libolecf_item_get_type(
+	     item,
+	     &item_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve type.",
+		 function );
+
+		goto on_error;
+	}
+	if( libolecf_item_get_size(
+	     item,
+	     &item_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libolecf_item_get_number_of_extents(
+	     item,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents.",
+		 function );
+
+		goto on_error;
+	}
+	if( item_type != LIBOLECF_ITEM_TYPE_STREAM )
+	{
+		if( number_of_extents != 0 )
+		{
+			return( 0 );
+		}
+	}
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( libolecf_item_get_extent_by_index(
+		     item,
+		     extent_index,
+		     &extent_file_offset,
+		     &extent_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		if( extent_size == 0 )
+		{
+			return( 0 );
+		}
+		/* The public API does not expose the offset of the extent in the stream
+		 * hence it is retrieved from the extent map to check that the extents are contiguous
+		 */
+		if( libolecf_internal_item_get_extent_map(
+		     (libolecf_internal_item_t *) item,
+		     &extent_map,
+		     &map_number_of_extents,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent map.",
+			 function );
+
+			goto on_error;
+		}
+		if( libolecf_extent_map_get_extent_by_index(
+		     extent_map,
+		     extent_index,
+		     &map_extent_offset,
+		     &map_extent_file_offset,
+		     &map_extent_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d from extent map.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		if( ( map_number_of_extents != number_of_extents )
+		 || ( map_extent_offset != stream_offset )
+		 || ( map_extent_file_offset != extent_file_offset ) )
+		{
+			return( 0 );
+		}
+		for( data_offset = 0;
+		     data_offset < extent_size;
+		     data_offset += read_size )
+		{
+			read_size = 512;
+
+			if( (size64_t) read_size > ( extent_size - data_offset ) )
+			{
+				read_size = (size_t) ( extent_size - data_offset );
+			}
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              extent_data,
+			              read_size,
+			              extent_file_offset + (off64_t) data_offset,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data of extent: %d.",
+				 function,
+				 extent_index );
+
+				goto on_error;
+			}
+			read_count = libolecf_stream_read_buffer_at_offset_without_seek(
+			              item,
+			              stream_data,
+			              read_size,
+			              stream_offset + (off64_t) data_offset,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read stream data of extent: %d.",
+				 function,
+				 extent_index );
+
+				goto on_error;
+			}
+			if( memory_compare(
+			     extent_data,
+			     stream_data,
+			     read_size ) != 0 )
+			{
+				return( 0 );
+			}
+		}
+		stream_offset += (off64_t) extent_size;
+	}
+	if( ( item_type == LIBOLECF_ITEM_TYPE_STREAM )
+	 && ( stream_offset != (off64_t) item_size ) )
+	{
+		return( 0 );
+	}
+	if( libolecf_item_get_number_of_sub_items(
+	     item,
+	     &number_of_sub_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub items.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_item_index = 0;
+	     sub_item_index < number_of_sub_items;
+	     sub_item_index++ )
+	{
+		if( libolecf_item_get_sub_item(
+		     item,
+		     sub_item_index,
+		     &sub_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		result = olecf_test_item_compare_extents(
+		          sub_item,
+		          file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare extents of sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		if( libolecf_item_free(
+		     &sub_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( sub_item != NULL )
+	{
+		libolecf_item_free(
+		 &sub_item,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libolecf_item_get_number_of_extents function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_item_get_number_of_extents(
+     libolecf_item_t *root_item )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_extents    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libolecf_item_get_number_of_extents(
+	          root_item,
+	          &number_of_extents,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_item_get_number_of_extents(
+	          NULL,
+	          &number_of_extents,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_item_get_number_of_extents(
+	          root_item,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_item_get_extent_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_item_get_extent_by_index(
+     libolecf_item_t *root_item,
+     libbfio_handle_t *file_io_handle )
+{
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	off64_t offset           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = olecf_test_item_compare_extents(
+	          root_item,
+	          file_io_handle,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_item_get_extent_by_index(
+	          NULL,
+	          0,
+	          &offset,
+	          &size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The root item has no extents
+	 */
+	result = libolecf_item_get_extent_by_index(
+	          root_item,
+	          -1,
+	          &offset,
+	          &size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_item_get_extent_by_index(
+	          root_item,
+	          0,
+	          &offset,
+	          &size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_item_get_extent_by_index(
+	          root_item,
+	          0,
+	          NULL,
+	          &size,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_item_get_extent_by_index(
+	          root_item,
+	          0,
+	          &offset,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
 
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 int wmain(
-     int argc OLECF_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] OLECF_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     wchar_t * const argv[] )
 #else
 int main(
-     int argc OLECF_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] OLECF_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     char * const argv[] )
 #endif
 {
-	OLECF_TEST_UNREFERENCED_PARAMETER( argc )
-	OLECF_TEST_UNREFERENCED_PARAMETER( argv )
-
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libolecf_file_t *file            = NULL;
+	libolecf_item_t *root_item       = NULL;
+	system_character_t *source       = NULL;
+	system_integer_t option          = 0;
+	size_t string_length             = 0;
+	int result                       = 0;
+
+	while( ( option = olecf_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
 #if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
 
 	/* TODO: add tests for libolecf_item_initialize */
@@ -102,41 +783,227 @@ int main(
 	 "libolecf_item_free",
 	 olecf_test_item_free );
 
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		result = libbfio_file_initialize(
+		          &file_io_handle,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NOT_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		string_length = system_string_length(
+		                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libbfio_file_set_name_wide(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#else
+		result = libbfio_file_set_name(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#endif
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libolecf_check_file_signature_file_io_handle(
+		          file_io_handle,
+		          &error );
+
+		OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( result != 0 )
+	{
+		/* Initialize file for tests
+		 */
+		result = olecf_test_item_open_source(
+		          &file,
+		          file_io_handle,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NOT_NULL(
+		 "file",
+		 file );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libolecf_file_get_root_item(
+		          file,
+		          &root_item,
+		          &error );
+
+		OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( root_item != NULL )
+	{
 #if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
 
-	/* TODO: add tests for libolecf_item_get_type */
+		/* TODO: add tests for libolecf_item_get_type */
+
+		/* TODO: add tests for libolecf_item_get_utf8_name_size */
+
+		/* TODO: add tests for libolecf_item_get_utf8_name */
+
+		/* TODO: add tests for libolecf_item_get_utf8_name_pointer */
 
-	/* TODO: add tests for libolecf_item_get_utf8_name_size */
+		/* TODO: add tests for libolecf_item_get_utf16_name_size */
 
-	/* TODO: add tests for libolecf_item_get_utf8_name */
+		/* TODO: add tests for libolecf_item_get_utf16_name */
 
-	/* TODO: add tests for libolecf_item_get_utf16_name_size */
+		/* TODO: add tests for libolecf_item_get_size */
 
-	/* TODO: add tests for libolecf_item_get_utf16_name */
+		OLECF_TEST_RUN_WITH_ARGS(
+		 "libolecf_item_get_number_of_extents",
+		 olecf_test_item_get_number_of_extents,
+		 root_item );
 
-	/* TODO: add tests for libolecf_item_get_size */
+		OLECF_TEST_RUN_WITH_ARGS(
+		 "libolecf_item_get_extent_by_index",
+		 olecf_test_item_get_extent_by_index,
+		 root_item,
+		 file_io_handle );
 
-	/* TODO: add tests for libolecf_item_get_creation_time */
+		/* TODO: add tests for libolecf_item_get_creation_time */
 
-	/* TODO: add tests for libolecf_item_get_modification_time */
+		/* TODO: add tests for libolecf_item_get_modification_time */
 
-	/* TODO: add tests for libolecf_item_get_number_of_sub_items */
+		/* TODO: add tests for libolecf_item_get_number_of_sub_items */
 
-	/* TODO: add tests for libolecf_item_get_sub_item */
+		/* TODO: add tests for libolecf_item_get_sub_item */
 
-	/* TODO: add tests for libolecf_item_get_sub_item_by_utf8_name */
+		/* TODO: add tests for libolecf_item_get_sub_item_by_utf8_name */
 
-	/* TODO: add tests for libolecf_item_get_sub_item_by_utf16_name */
+		/* TODO: add tests for libolecf_item_get_sub_item_by_utf16_name */
 
-	/* TODO: add tests for libolecf_item_get_sub_item_by_utf8_path */
+		/* TODO: add tests for libolecf_item_get_sub_item_by_utf8_path */
 
-	/* TODO: add tests for libolecf_item_get_sub_item_by_utf16_path */
+		/* TODO: add tests for libolecf_item_get_sub_item_by_utf16_path */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
 
+		/* Clean up
+		 */
+		result = libolecf_item_free(
+		          &root_item,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( file != NULL )
+	{
+		result = olecf_test_item_close_source(
+		          &file,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "file",
+		 file );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( file_io_handle != NULL )
+	{
+		result = libbfio_handle_free(
+		          &file_io_handle,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
 	return( EXIT_SUCCESS );
 
 on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( root_item != NULL )
+	{
+		libolecf_item_free(
+		 &root_item,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libolecf_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
 	return( EXIT_FAILURE );
 }
-
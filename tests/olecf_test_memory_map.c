@@ -0,0 +1,900 @@
+/*
+ * Library memory_map type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "olecf_test_functions.h"
+#include "olecf_test_libbfio.h"
+#include "olecf_test_libcerror.h"
+#include "olecf_test_libolecf.h"
+#include "olecf_test_macros.h"
+#include "olecf_test_memory.h"
+#include "olecf_test_unused.h"
+
+#include "../libolecf/libolecf_memory_map.h"
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+/* Tests the libolecf_memory_map_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_memory_map_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libolecf_memory_map_t *memory_map = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_OLECF_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 1;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libolecf_memory_map_initialize(
+	          &memory_map,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_map",
+	 memory_map );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_memory_map_free(
+	          &memory_map,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "memory_map",
+	 memory_map );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_memory_map_initialize(
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_map = (libolecf_memory_map_t *) 0x12345678UL;
+
+	result = libolecf_memory_map_initialize(
+	          &memory_map,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_map = NULL;
+
+#if defined( HAVE_OLECF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libolecf_memory_map_initialize with malloc failing
+		 */
+		olecf_test_malloc_attempts_before_fail = test_number;
+
+		result = libolecf_memory_map_initialize(
+		          &memory_map,
+		          &error );
+
+		if( olecf_test_malloc_attempts_before_fail != -1 )
+		{
+			olecf_test_malloc_attempts_before_fail = -1;
+
+			if( memory_map != NULL )
+			{
+				libolecf_memory_map_free(
+				 &memory_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			OLECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "memory_map",
+			 memory_map );
+
+			OLECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libolecf_memory_map_initialize with memset failing
+		 */
+		olecf_test_memset_attempts_before_fail = test_number;
+
+		result = libolecf_memory_map_initialize(
+		          &memory_map,
+		          &error );
+
+		if( olecf_test_memset_attempts_before_fail != -1 )
+		{
+			olecf_test_memset_attempts_before_fail = -1;
+
+			if( memory_map != NULL )
+			{
+				libolecf_memory_map_free(
+				 &memory_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			OLECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "memory_map",
+			 memory_map );
+
+			OLECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_OLECF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_map != NULL )
+	{
+		libolecf_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_memory_map_free function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_memory_map_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libolecf_memory_map_free(
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_memory_map_open function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_memory_map_open(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libolecf_memory_map_t *memory_map = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_memory_map_initialize(
+	          &memory_map,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_map",
+	 memory_map );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libolecf_memory_map_open(
+	          memory_map,
+	          "olecf_test_memory_map.nonexistent",
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "memory_map->data",
+	 memory_map->data );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_memory_map_open(
+	          NULL,
+	          "olecf_test_memory_map.nonexistent",
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_memory_map_open(
+	          memory_map,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_memory_map_free(
+	          &memory_map,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "memory_map",
+	 memory_map );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_map != NULL )
+	{
+		libolecf_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libolecf_memory_map_open_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_memory_map_open_wide(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libolecf_memory_map_t *memory_map = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_memory_map_initialize(
+	          &memory_map,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_map",
+	 memory_map );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libolecf_memory_map_open_wide(
+	          memory_map,
+	          L"olecf_test_memory_map.nonexistent",
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "memory_map->data",
+	 memory_map->data );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_memory_map_open_wide(
+	          NULL,
+	          L"olecf_test_memory_map.nonexistent",
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_memory_map_open_wide(
+	          memory_map,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_memory_map_free(
+	          &memory_map,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "memory_map",
+	 memory_map );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_map != NULL )
+	{
+		libolecf_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Tests the libolecf_memory_map_verify_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_memory_map_verify_file_io_handle(
+     void )
+{
+	uint8_t data[ 1024 ];
+	uint8_t mapped_data[ 1024 ];
+
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *error          = NULL;
+	libolecf_memory_map_t *memory_map = NULL;
+	size_t data_index                 = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < 1024;
+	     data_index++ )
+	{
+		data[ data_index ]        = (uint8_t) data_index;
+		mapped_data[ data_index ] = (uint8_t) data_index;
+	}
+	result = olecf_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          1024,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_memory_map_initialize(
+	          &memory_map,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_map",
+	 memory_map );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The memory map references test data instead of a mapped file
+	 */
+	memory_map->data      = mapped_data;
+	memory_map->data_size = 1024;
+
+	/* Test regular cases
+	 */
+	result = libolecf_memory_map_verify_file_io_handle(
+	          memory_map,
+	          file_io_handle,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a mapped file with a different size
+	 */
+	memory_map->data_size = 512;
+
+	result = libolecf_memory_map_verify_file_io_handle(
+	          memory_map,
+	          file_io_handle,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_map->data_size = 1024;
+
+	/* Test a mapped file with a different header
+	 */
+	mapped_data[ 0 ] = 0xff;
+
+	result = libolecf_memory_map_verify_file_io_handle(
+	          memory_map,
+	          file_io_handle,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	mapped_data[ 0 ] = 0;
+
+	/* Test error cases
+	 */
+	result = libolecf_memory_map_verify_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_map->data = NULL;
+
+	result = libolecf_memory_map_verify_file_io_handle(
+	          memory_map,
+	          file_io_handle,
+	          &error );
+
+	memory_map->data = mapped_data;
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_map->data      = NULL;
+	memory_map->data_size = 0;
+
+	result = libolecf_memory_map_free(
+	          &memory_map,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "memory_map",
+	 memory_map );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = olecf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_map != NULL )
+	{
+		memory_map->data      = NULL;
+		memory_map->data_size = 0;
+
+		libolecf_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_memory_map_close function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_memory_map_close(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libolecf_memory_map_t *memory_map = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_memory_map_initialize(
+	          &memory_map,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_map",
+	 memory_map );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libolecf_memory_map_close(
+	          memory_map,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_memory_map_close(
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_memory_map_free(
+	          &memory_map,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "memory_map",
+	 memory_map );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_map != NULL )
+	{
+		libolecf_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc OLECF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] OLECF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc OLECF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] OLECF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	OLECF_TEST_UNREFERENCED_PARAMETER( argc )
+	OLECF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+	OLECF_TEST_RUN(
+	 "libolecf_memory_map_initialize",
+	 olecf_test_memory_map_initialize );
+
+	OLECF_TEST_RUN(
+	 "libolecf_memory_map_free",
+	 olecf_test_memory_map_free );
+
+	OLECF_TEST_RUN(
+	 "libolecf_memory_map_open",
+	 olecf_test_memory_map_open );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+	OLECF_TEST_RUN(
+	 "libolecf_memory_map_open_wide",
+	 olecf_test_memory_map_open_wide );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+	OLECF_TEST_RUN(
+	 "libolecf_memory_map_verify_file_io_handle",
+	 olecf_test_memory_map_verify_file_io_handle );
+
+	OLECF_TEST_RUN(
+	 "libolecf_memory_map_close",
+	 olecf_test_memory_map_close );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,1162 @@
+/*
+ * Library name_index type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "olecf_test_libcerror.h"
+#include "olecf_test_libolecf.h"
+#include "olecf_test_macros.h"
+#include "olecf_test_memory.h"
+#include "olecf_test_unused.h"
+
+#include "../libolecf/libolecf_name_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+/* Tests the libolecf_name_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_name_index_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libolecf_name_index_t *name_index = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_OLECF_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 3;
+	int number_of_memset_fail_tests   = 3;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libolecf_name_index_initialize(
+	          &name_index,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "name_index",
+	 name_index );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_name_index_free(
+	          &name_index,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "name_index",
+	 name_index );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_name_index_initialize(
+	          NULL,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	name_index = (libolecf_name_index_t *) 0x12345678UL;
+
+	result = libolecf_name_index_initialize(
+	          &name_index,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	name_index = NULL;
+
+	result = libolecf_name_index_initialize(
+	          &name_index,
+	          -1,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_OLECF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libolecf_name_index_initialize with malloc failing
+		 */
+		olecf_test_malloc_attempts_before_fail = test_number;
+
+		result = libolecf_name_index_initialize(
+		          &name_index,
+		          16,
+		          &error );
+
+		if( olecf_test_malloc_attempts_before_fail != -1 )
+		{
+			olecf_test_malloc_attempts_before_fail = -1;
+
+			if( name_index != NULL )
+			{
+				libolecf_name_index_free(
+				 &name_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			OLECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "name_index",
+			 name_index );
+
+			OLECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libolecf_name_index_initialize with memset failing
+		 */
+		olecf_test_memset_attempts_before_fail = test_number;
+
+		result = libolecf_name_index_initialize(
+		          &name_index,
+		          16,
+		          &error );
+
+		if( olecf_test_memset_attempts_before_fail != -1 )
+		{
+			olecf_test_memset_attempts_before_fail = -1;
+
+			if( name_index != NULL )
+			{
+				libolecf_name_index_free(
+				 &name_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			OLECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "name_index",
+			 name_index );
+
+			OLECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_OLECF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_index != NULL )
+	{
+		libolecf_name_index_free(
+		 &name_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_name_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_name_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libolecf_name_index_free(
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_name_index_insert_value function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_name_index_insert_value(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libolecf_name_index_t *name_index = NULL;
+	int result                        = 0;
+	int value_index                   = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_name_index_initialize(
+	          &name_index,
+	          2,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "name_index",
+	 name_index );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 4;
+	     value_index++ )
+	{
+		result = libolecf_name_index_insert_value(
+		          name_index,
+		          0x12345678UL,
+		          (intptr_t *) 0x12345678UL,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "name_index->number_of_values",
+	 name_index->number_of_values,
+	 4 );
+
+	/* Test error cases
+	 */
+	result = libolecf_name_index_insert_value(
+	          NULL,
+	          0x12345678UL,
+	          (intptr_t *) 0x12345678UL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_name_index_insert_value(
+	          name_index,
+	          0x12345678UL,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libolecf_name_index_insert_value with the name index full
+	 */
+	result = libolecf_name_index_insert_value(
+	          name_index,
+	          0x12345678UL,
+	          (intptr_t *) 0x12345678UL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_name_index_free(
+	          &name_index,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "name_index",
+	 name_index );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_index != NULL )
+	{
+		libolecf_name_index_free(
+		 &name_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_name_index_get_value_by_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_name_index_get_value_by_hash(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libolecf_name_index_t *name_index = NULL;
+	intptr_t *value                   = NULL;
+	int result                        = 0;
+	int slot_index                    = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_name_index_initialize(
+	          &name_index,
+	          4,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "name_index",
+	 name_index );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_name_index_insert_value(
+	          name_index,
+	          0x00000001UL,
+	          (intptr_t *) 0x00001000UL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_name_index_insert_value(
+	          name_index,
+	          0x00000009UL,
+	          (intptr_t *) 0x00002000UL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_name_index_insert_value(
+	          name_index,
+	          0x00000001UL,
+	          (intptr_t *) 0x00003000UL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	slot_index = -1;
+
+	result = libolecf_name_index_get_value_by_hash(
+	          name_index,
+	          0x00000001UL,
+	          &slot_index,
+	          &value,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "slot_index",
+	 slot_index,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "value",
+	 (int) (intptr_t) value,
+	 0x00001000 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_name_index_get_value_by_hash(
+	          name_index,
+	          0x00000001UL,
+	          &slot_index,
+	          &value,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "value",
+	 (int) (intptr_t) value,
+	 0x00003000 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_name_index_get_value_by_hash(
+	          name_index,
+	          0x00000001UL,
+	          &slot_index,
+	          &value,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	slot_index = -1;
+
+	result = libolecf_name_index_get_value_by_hash(
+	          name_index,
+	          0x00000002UL,
+	          &slot_index,
+	          &value,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	slot_index = -1;
+
+	result = libolecf_name_index_get_value_by_hash(
+	          NULL,
+	          0x00000001UL,
+	          &slot_index,
+	          &value,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_name_index_get_value_by_hash(
+	          name_index,
+	          0x00000001UL,
+	          NULL,
+	          &value,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	slot_index = -2;
+
+	result = libolecf_name_index_get_value_by_hash(
+	          name_index,
+	          0x00000001UL,
+	          &slot_index,
+	          &value,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	slot_index = -1;
+
+	result = libolecf_name_index_get_value_by_hash(
+	          name_index,
+	          0x00000001UL,
+	          &slot_index,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_name_index_free(
+	          &name_index,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "name_index",
+	 name_index );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_index != NULL )
+	{
+		libolecf_name_index_free(
+		 &name_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_name_index_calculate_hash_from_utf16_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_name_index_calculate_hash_from_utf16_stream(
+     void )
+{
+	uint8_t utf16_stream[ 10 ] = {
+		'R', 0, 'o', 0, 'o', 0, 't', 0, 0, 0 };
+
+	libcerror_error_t *error   = NULL;
+	uint32_t expected_hash     = 0;
+	uint32_t name_hash         = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libolecf_name_index_calculate_hash_from_utf8_string(
+	          (uint8_t *) "ROOT",
+	          4,
+	          &expected_hash,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_name_index_calculate_hash_from_utf16_stream(
+	          utf16_stream,
+	          10,
+	          LIBOLECF_ENDIAN_LITTLE,
+	          &name_hash,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 name_hash,
+	 expected_hash );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_name_index_calculate_hash_from_utf16_stream(
+	          NULL,
+	          10,
+	          LIBOLECF_ENDIAN_LITTLE,
+	          &name_hash,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_name_index_calculate_hash_from_utf16_stream(
+	          utf16_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBOLECF_ENDIAN_LITTLE,
+	          &name_hash,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_name_index_calculate_hash_from_utf16_stream(
+	          utf16_stream,
+	          10,
+	          0xff,
+	          &name_hash,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_name_index_calculate_hash_from_utf16_stream(
+	          utf16_stream,
+	          10,
+	          LIBOLECF_ENDIAN_LITTLE,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_name_index_calculate_hash_from_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_name_index_calculate_hash_from_utf8_string(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t expected_hash   = 0;
+	uint32_t name_hash       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libolecf_name_index_calculate_hash_from_utf8_string(
+	          (uint8_t *) "Workbook",
+	          8,
+	          &expected_hash,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_name_index_calculate_hash_from_utf8_string(
+	          (uint8_t *) "WORKBOOK",
+	          8,
+	          &name_hash,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 name_hash,
+	 expected_hash );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_name_index_calculate_hash_from_utf8_string(
+	          NULL,
+	          8,
+	          &name_hash,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_name_index_calculate_hash_from_utf8_string(
+	          (uint8_t *) "Workbook",
+	          (size_t) SSIZE_MAX + 1,
+	          &name_hash,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_name_index_calculate_hash_from_utf8_string(
+	          (uint8_t *) "Workbook",
+	          8,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_name_index_calculate_hash_from_utf16_string function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_name_index_calculate_hash_from_utf16_string(
+     void )
+{
+	uint16_t utf16_string[ 8 ] = {
+		'W', 'o', 'r', 'k', 'b', 'o', 'o', 'k' };
+
+	libcerror_error_t *error   = NULL;
+	uint32_t expected_hash     = 0;
+	uint32_t name_hash         = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libolecf_name_index_calculate_hash_from_utf8_string(
+	          (uint8_t *) "workbook",
+	          8,
+	          &expected_hash,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_name_index_calculate_hash_from_utf16_string(
+	          utf16_string,
+	          8,
+	          &name_hash,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 name_hash,
+	 expected_hash );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_name_index_calculate_hash_from_utf16_string(
+	          NULL,
+	          8,
+	          &name_hash,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_name_index_calculate_hash_from_utf16_string(
+	          utf16_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &name_hash,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_name_index_calculate_hash_from_utf16_string(
+	          utf16_string,
+	          8,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc OLECF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] OLECF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc OLECF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] OLECF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	OLECF_TEST_UNREFERENCED_PARAMETER( argc )
+	OLECF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+	OLECF_TEST_RUN(
+	 "libolecf_name_index_initialize",
+	 olecf_test_name_index_initialize );
+
+	OLECF_TEST_RUN(
+	 "libolecf_name_index_free",
+	 olecf_test_name_index_free );
+
+	OLECF_TEST_RUN(
+	 "libolecf_name_index_insert_value",
+	 olecf_test_name_index_insert_value );
+
+	OLECF_TEST_RUN(
+	 "libolecf_name_index_get_value_by_hash",
+	 olecf_test_name_index_get_value_by_hash );
+
+	/* TODO: add tests for libolecf_name_index_update_hash */
+
+	OLECF_TEST_RUN(
+	 "libolecf_name_index_calculate_hash_from_utf16_stream",
+	 olecf_test_name_index_calculate_hash_from_utf16_stream );
+
+	OLECF_TEST_RUN(
+	 "libolecf_name_index_calculate_hash_from_utf8_string",
+	 olecf_test_name_index_calculate_hash_from_utf8_string );
+
+	OLECF_TEST_RUN(
+	 "libolecf_name_index_calculate_hash_from_utf16_string",
+	 olecf_test_name_index_calculate_hash_from_utf16_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+}
+
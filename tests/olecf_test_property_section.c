@@ -797,13 +797,11 @@ int main(
 
 #if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
 
-	/* TODO: add tests for libolecf_property_section_read_list_entry */
-
 	OLECF_TEST_RUN(
 	 "libolecf_property_section_read_list_entry_data",
 	 olecf_test_property_section_read_list_entry_data );
 
-	/* TODO: add tests for libolecf_property_section_read */
+	/* TODO: add tests for libolecf_property_section_read_data */
 
 #if defined( TODO )
 
@@ -33,12 +33,21 @@
 #include "olecf_test_memory.h"
 #include "olecf_test_unused.h"
 
+#include "../libolecf/libolecf_io_handle.h"
 #include "../libolecf/libolecf_property_set.h"
+#include "../libolecf/libolecf_property_value.h"
 
 uint8_t olecf_test_property_set_data1[ 28 ] = {
 	0xfe, 0xff, 0x00, 0x00, 0x05, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 };
 
+uint8_t olecf_test_property_set_data2[ 72 ] = {
+	0xfe, 0xff, 0x00, 0x00, 0x05, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x85, 0x9f, 0xf2,
+	0xf9, 0x4f, 0x68, 0x10, 0xab, 0x91, 0x08, 0x00, 0x2b, 0x27, 0xb3, 0xd9, 0x30, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00 };
+
 uint8_t olecf_test_property_set_error_data1[ 28 ] = {
 	0xff, 0xff, 0x00, 0x00, 0x05, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 };
@@ -458,6 +467,343 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libolecf_property_set_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_property_set_read_data(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libolecf_io_handle_t *io_handle               = NULL;
+	libolecf_property_section_t *property_section = NULL;
+	libolecf_property_set_t *property_set         = NULL;
+	libolecf_property_value_t *property_value     = NULL;
+	uint32_t value_type                           = 0;
+	int number_of_sections                        = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_property_set_initialize(
+	          &property_set,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "property_set",
+	 property_set );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libolecf_property_set_read_data(
+	          (libolecf_internal_property_set_t *) property_set,
+	          io_handle,
+	          olecf_test_property_set_data2,
+	          72,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_property_set_get_number_of_sections(
+	          property_set,
+	          &number_of_sections,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sections",
+	 number_of_sections,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_property_set_get_section_by_index(
+	          property_set,
+	          0,
+	          &property_section,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "property_section",
+	 property_section );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_property_section_get_property_by_index(
+	          property_section,
+	          0,
+	          &property_value,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "property_value",
+	 property_value );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT8(
+	 "data_is_read",
+	 ( (libolecf_internal_property_value_t *) property_value )->data_is_read,
+	 0 );
+
+	result = libolecf_property_value_get_value_type(
+	          property_value,
+	          &value_type,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT32(
+	 "value_type",
+	 value_type,
+	 (uint32_t) 0x00000003UL );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT8(
+	 "data_is_read",
+	 ( (libolecf_internal_property_value_t *) property_value )->data_is_read,
+	 1 );
+
+	property_value   = NULL;
+	property_section = NULL;
+
+	/* Test error cases
+	 */
+	result = libolecf_property_set_read_data(
+	          NULL,
+	          io_handle,
+	          olecf_test_property_set_data2,
+	          72,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_property_set_read_data(
+	          (libolecf_internal_property_set_t *) property_set,
+	          io_handle,
+	          NULL,
+	          72,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_property_set_read_data(
+	          (libolecf_internal_property_set_t *) property_set,
+	          io_handle,
+	          olecf_test_property_set_data2,
+	          0,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_property_set_read_data(
+	          (libolecf_internal_property_set_t *) property_set,
+	          io_handle,
+	          olecf_test_property_set_data2,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the section list entry is out of bounds
+	 */
+	result = libolecf_property_set_read_data(
+	          (libolecf_internal_property_set_t *) property_set,
+	          io_handle,
+	          olecf_test_property_set_data2,
+	          40,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the property value data is out of bounds
+	 */
+	result = libolecf_property_set_read_data(
+	          (libolecf_internal_property_set_t *) property_set,
+	          io_handle,
+	          olecf_test_property_set_data2,
+	          64,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_property_set_free(
+	          &property_set,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "property_set",
+	 property_set );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( property_set != NULL )
+	{
+		libolecf_property_set_free(
+		 &property_set,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libolecf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libolecf_property_set_get_class_identifier function
  * Returns 1 if successful or 0 if not
  */
@@ -774,6 +1120,10 @@ int main(
 	 "libolecf_property_set_read_header_data",
 	 olecf_test_property_set_read_header_data );
 
+	OLECF_TEST_RUN(
+	 "libolecf_property_set_read_data",
+	 olecf_test_property_set_read_data );
+
 #if defined( TODO )
 
 	/* TODO: add tests for libolecf_property_set_read */
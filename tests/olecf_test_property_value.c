@@ -403,11 +403,17 @@ on_error:
 int olecf_test_property_value_get_value_type(
      void )
 {
-	libcerror_error_t *error                  = NULL;
-	libolecf_property_value_t *property_value = NULL;
-	uint32_t value_type                       = 0;
-	int result                                = 0;
-	int value_type_is_set                     = 0;
+	/* A string value with a data size that exceeds the property value data
+	 */
+	uint8_t value_data[ 8 ] = {
+		0x1f, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff };
+
+	libcerror_error_t *error                                    = NULL;
+	libolecf_internal_property_value_t *internal_property_value = NULL;
+	libolecf_property_value_t *property_value                   = NULL;
+	uint32_t value_type                                         = 0;
+	int result                                                  = 0;
+	int value_type_is_set                                       = 0;
 
 	/* Initialize test
 	 */
@@ -446,6 +452,60 @@ int olecf_test_property_value_get_value_type(
 
 	value_type_is_set = result;
 
+	/* Test that the value type is read from the property value data header
+	 * without reading the rest of the property value data
+	 */
+	internal_property_value = (libolecf_internal_property_value_t *) property_value;
+
+	internal_property_value->data       = value_data;
+	internal_property_value->data_size  = 8;
+	internal_property_value->byte_order = LIBOLECF_ENDIAN_LITTLE;
+
+	result = libolecf_property_value_get_value_type(
+	          property_value,
+	          &value_type,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT32(
+	 "value_type",
+	 value_type,
+	 (uint32_t) 0x0000001fUL );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_property_value->data_is_read",
+	 internal_property_value->data_is_read,
+	 0 );
+
+	internal_property_value->byte_order = LIBOLECF_ENDIAN_BIG;
+
+	result = libolecf_property_value_get_value_type(
+	          property_value,
+	          &value_type,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_EQUAL_UINT32(
+	 "value_type",
+	 value_type,
+	 (uint32_t) 0x1f000000UL );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
 	result = libolecf_property_value_get_value_type(
@@ -484,6 +544,25 @@ int olecf_test_property_value_get_value_type(
 		libcerror_error_free(
 		 &error );
 	}
+	internal_property_value->data_size = 2;
+
+	result = libolecf_property_value_get_value_type(
+	          property_value,
+	          &value_type,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	/* Clean up
 	 */
 	result = libolecf_internal_property_value_free(
@@ -2511,6 +2590,10 @@ int main(
 	 "libolecf_property_value_initialize",
 	 olecf_test_property_value_initialize );
 
+	OLECF_TEST_RUN(
+	 "libolecf_property_value_get_value_type",
+	 olecf_test_property_value_get_value_type );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
 
 	OLECF_TEST_RUN(
@@ -2521,16 +2604,12 @@ int main(
 
 	/* TODO: add tests for libolecf_property_value_read_data */
 
-	/* TODO: add tests for libolecf_property_value_read_list_entry */
+	/* TODO: add tests for libolecf_property_value_read_list_entry_data */
 
 	OLECF_TEST_RUN(
 	 "libolecf_property_value_get_identifier",
 	 olecf_test_property_value_get_identifier );
 
-	OLECF_TEST_RUN(
-	 "libolecf_property_value_get_value_type",
-	 olecf_test_property_value_get_value_type );
-
 	OLECF_TEST_RUN(
 	 "libolecf_property_value_get_data_size",
 	 olecf_test_property_value_get_data_size );
@@ -0,0 +1,980 @@
+/*
+ * Library read_ahead type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if !defined( WINAPI ) && defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if !defined( WINAPI ) && defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "olecf_test_functions.h"
+#include "olecf_test_libbfio.h"
+#include "olecf_test_libcerror.h"
+#include "olecf_test_libolecf.h"
+#include "olecf_test_macros.h"
+#include "olecf_test_memory.h"
+#include "olecf_test_unused.h"
+
+#include "../libolecf/libolecf_read_ahead.h"
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+/* Tests the libolecf_read_ahead_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_read_ahead_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libolecf_read_ahead_t *read_ahead = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_OLECF_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 1;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libolecf_read_ahead_initialize(
+	          &read_ahead,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_read_ahead_free(
+	          &read_ahead,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_read_ahead_initialize(
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_ahead = (libolecf_read_ahead_t *) 0x12345678UL;
+
+	result = libolecf_read_ahead_initialize(
+	          &read_ahead,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_ahead = NULL;
+
+#if defined( HAVE_OLECF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libolecf_read_ahead_initialize with malloc failing
+		 */
+		olecf_test_malloc_attempts_before_fail = test_number;
+
+		result = libolecf_read_ahead_initialize(
+		          &read_ahead,
+		          &error );
+
+		if( olecf_test_malloc_attempts_before_fail != -1 )
+		{
+			olecf_test_malloc_attempts_before_fail = -1;
+
+			if( read_ahead != NULL )
+			{
+				libolecf_read_ahead_free(
+				 &read_ahead,
+				 NULL );
+			}
+		}
+		else
+		{
+			OLECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "read_ahead",
+			 read_ahead );
+
+			OLECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libolecf_read_ahead_initialize with memset failing
+		 */
+		olecf_test_memset_attempts_before_fail = test_number;
+
+		result = libolecf_read_ahead_initialize(
+		          &read_ahead,
+		          &error );
+
+		if( olecf_test_memset_attempts_before_fail != -1 )
+		{
+			olecf_test_memset_attempts_before_fail = -1;
+
+			if( read_ahead != NULL )
+			{
+				libolecf_read_ahead_free(
+				 &read_ahead,
+				 NULL );
+			}
+		}
+		else
+		{
+			OLECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "read_ahead",
+			 read_ahead );
+
+			OLECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_OLECF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_ahead != NULL )
+	{
+		libolecf_read_ahead_free(
+		 &read_ahead,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_read_ahead_free function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_read_ahead_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libolecf_read_ahead_free(
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if !defined( WINAPI ) && defined( HAVE_POSIX_FADVISE )
+
+/* Tests the libolecf_read_ahead_verify_file_descriptor function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_read_ahead_verify_file_descriptor(
+     void )
+{
+	uint8_t data[ 64 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	int file_descriptor              = -1;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 data,
+	 0,
+	 64 );
+
+	result = olecf_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          64,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	file_descriptor = open(
+	                   "/dev/null",
+	                   O_RDONLY );
+
+	if( file_descriptor != -1 )
+	{
+		/* A descriptor that does not refer to a regular file of the same size is rejected
+		 */
+		result = libolecf_read_ahead_verify_file_descriptor(
+		          file_descriptor,
+		          file_io_handle,
+		          &error );
+
+		close(
+		 file_descriptor );
+
+		file_descriptor = -1;
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libolecf_read_ahead_verify_file_descriptor(
+	          -1,
+	          file_io_handle,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = olecf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* !defined( WINAPI ) && defined( HAVE_POSIX_FADVISE ) */
+
+/* Tests the libolecf_read_ahead_open function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_read_ahead_open(
+     void )
+{
+	uint8_t data[ 64 ];
+
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *error          = NULL;
+	libolecf_read_ahead_t *read_ahead = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 data,
+	 0,
+	 64 );
+
+	result = olecf_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          64,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_read_ahead_initialize(
+	          &read_ahead,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libolecf_read_ahead_open(
+	          read_ahead,
+	          "olecf_test_read_ahead.nonexistent",
+	          file_io_handle,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "read_ahead->file_descriptor",
+	 read_ahead->file_descriptor,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if !defined( WINAPI )
+	/* A file that differs from the file IO handle is not used
+	 */
+	result = libolecf_read_ahead_open(
+	          read_ahead,
+	          "/dev/null",
+	          file_io_handle,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "read_ahead->file_descriptor",
+	 read_ahead->file_descriptor,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( WINAPI ) */
+
+	/* Test error cases
+	 */
+	result = libolecf_read_ahead_open(
+	          NULL,
+	          "olecf_test_read_ahead.nonexistent",
+	          file_io_handle,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_read_ahead_open(
+	          read_ahead,
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_read_ahead_open(
+	          read_ahead,
+	          "olecf_test_read_ahead.nonexistent",
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_read_ahead_free(
+	          &read_ahead,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = olecf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_ahead != NULL )
+	{
+		libolecf_read_ahead_free(
+		 &read_ahead,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_read_ahead_close function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_read_ahead_close(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libolecf_read_ahead_t *read_ahead = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_read_ahead_initialize(
+	          &read_ahead,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libolecf_read_ahead_close(
+	          read_ahead,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_read_ahead_close(
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_read_ahead_free(
+	          &read_ahead,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_ahead != NULL )
+	{
+		libolecf_read_ahead_free(
+		 &read_ahead,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_read_ahead_advise_file function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_read_ahead_advise_file(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libolecf_read_ahead_t *read_ahead = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_read_ahead_initialize(
+	          &read_ahead,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libolecf_read_ahead_advise_file(
+	          read_ahead,
+	          0,
+	          4096,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_read_ahead_advise_file(
+	          NULL,
+	          0,
+	          4096,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_read_ahead_advise_file(
+	          read_ahead,
+	          -1,
+	          4096,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_read_ahead_free(
+	          &read_ahead,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_ahead != NULL )
+	{
+		libolecf_read_ahead_free(
+		 &read_ahead,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_read_ahead_advise_memory function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_read_ahead_advise_memory(
+     void )
+{
+	uint8_t data[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libolecf_read_ahead_advise_memory(
+	          data,
+	          0,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_read_ahead_advise_memory(
+	          NULL,
+	          64,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_read_ahead_advise_memory(
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc OLECF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] OLECF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc OLECF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] OLECF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	OLECF_TEST_UNREFERENCED_PARAMETER( argc )
+	OLECF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+	OLECF_TEST_RUN(
+	 "libolecf_read_ahead_initialize",
+	 olecf_test_read_ahead_initialize );
+
+	OLECF_TEST_RUN(
+	 "libolecf_read_ahead_free",
+	 olecf_test_read_ahead_free );
+
+#if !defined( WINAPI ) && defined( HAVE_POSIX_FADVISE )
+
+	OLECF_TEST_RUN(
+	 "libolecf_read_ahead_verify_file_descriptor",
+	 olecf_test_read_ahead_verify_file_descriptor );
+
+#endif /* !defined( WINAPI ) && defined( HAVE_POSIX_FADVISE ) */
+
+	OLECF_TEST_RUN(
+	 "libolecf_read_ahead_open",
+	 olecf_test_read_ahead_open );
+
+	OLECF_TEST_RUN(
+	 "libolecf_read_ahead_close",
+	 olecf_test_read_ahead_close );
+
+	OLECF_TEST_RUN(
+	 "libolecf_read_ahead_advise_file",
+	 olecf_test_read_ahead_advise_file );
+
+	OLECF_TEST_RUN(
+	 "libolecf_read_ahead_advise_memory",
+	 olecf_test_read_ahead_advise_memory );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+}
+
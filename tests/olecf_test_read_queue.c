@@ -0,0 +1,1527 @@
+/*
+ * Library read_queue type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "olecf_test_getopt.h"
+#include "olecf_test_libbfio.h"
+#include "olecf_test_libcerror.h"
+#include "olecf_test_libolecf.h"
+#include "olecf_test_macros.h"
+#include "olecf_test_memory.h"
+
+#include "../libolecf/libolecf_read_queue.h"
+
+#if !defined( LIBOLECF_HAVE_BFIO )
+
+LIBOLECF_EXTERN \
+int libolecf_check_file_signature_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBOLECF_EXTERN \
+int libolecf_file_open_file_io_handle(
+     libolecf_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libolecf_error_t **error );
+
+#endif /* !defined( LIBOLECF_HAVE_BFIO ) */
+
+/* Creates and opens a source file
+ * The file is opened by name with read-ahead if no file IO handle is provided,
+ * which allows the read queue to read asynchronously
+ * Returns 1 if successful or -1 on error
+ */
+int olecf_test_read_queue_open_source(
+     libolecf_file_t **file,
+     const system_character_t *source,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "olecf_test_read_queue_open_source";
+	int result            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( libolecf_file_initialize(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_io_handle != NULL )
+	{
+		result = libolecf_file_open_file_io_handle(
+		          *file,
+		          file_io_handle,
+		          LIBOLECF_OPEN_READ,
+		          error );
+	}
+	else
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libolecf_file_open_wide(
+		          *file,
+		          source,
+		          LIBOLECF_OPEN_READ_AHEAD,
+		          error );
+#else
+		result = libolecf_file_open(
+		          *file,
+		          source,
+		          LIBOLECF_OPEN_READ_AHEAD,
+		          error );
+#endif
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file != NULL )
+	{
+		libolecf_file_free(
+		 file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes and frees a source file
+ * Returns 1 if successful or -1 on error
+ */
+int olecf_test_read_queue_close_source(
+     libolecf_file_t **file,
+     libcerror_error_t **error )
+{
+	static char *function = "olecf_test_read_queue_close_source";
+	int result            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libolecf_file_close(
+	     *file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		result = -1;
+	}
+	if( libolecf_file_free(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+/* Tests the libolecf_read_queue_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_read_queue_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libolecf_read_queue_t *read_queue = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_OLECF_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 3;
+	int number_of_memset_fail_tests   = 3;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libolecf_read_queue_initialize(
+	          &read_queue,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "read_queue",
+	 read_queue );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_read_queue_initialize(
+	          NULL,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_queue = (libolecf_read_queue_t *) 0x12345678UL;
+
+	result = libolecf_read_queue_initialize(
+	          &read_queue,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_queue = NULL;
+
+	result = libolecf_read_queue_initialize(
+	          &read_queue,
+	          0,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_OLECF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libolecf_read_queue_initialize with malloc failing
+		 */
+		olecf_test_malloc_attempts_before_fail = test_number;
+
+		result = libolecf_read_queue_initialize(
+		          &read_queue,
+		          16,
+		          &error );
+
+		if( olecf_test_malloc_attempts_before_fail != -1 )
+		{
+			olecf_test_malloc_attempts_before_fail = -1;
+
+			if( read_queue != NULL )
+			{
+				libolecf_read_queue_free(
+				 &read_queue,
+				 NULL );
+			}
+		}
+		else
+		{
+			OLECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "read_queue",
+			 read_queue );
+
+			OLECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libolecf_read_queue_initialize with memset failing
+		 */
+		olecf_test_memset_attempts_before_fail = test_number;
+
+		result = libolecf_read_queue_initialize(
+		          &read_queue,
+		          16,
+		          &error );
+
+		if( olecf_test_memset_attempts_before_fail != -1 )
+		{
+			olecf_test_memset_attempts_before_fail = -1;
+
+			if( read_queue != NULL )
+			{
+				libolecf_read_queue_free(
+				 &read_queue,
+				 NULL );
+			}
+		}
+		else
+		{
+			OLECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "read_queue",
+			 read_queue );
+
+			OLECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_OLECF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libolecf_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_read_queue_free function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_read_queue_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libolecf_read_queue_free(
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_read_queue_submit_read function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_read_queue_submit_read(
+     void )
+{
+	uint8_t buffer[ 64 ];
+
+	libcerror_error_t *error          = NULL;
+	libolecf_read_queue_t *read_queue = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_read_queue_initialize(
+	          &read_queue,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "read_queue",
+	 read_queue );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_read_queue_submit_read(
+	          NULL,
+	          NULL,
+	          buffer,
+	          64,
+	          0,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_read_queue_submit_read(
+	          read_queue,
+	          NULL,
+	          buffer,
+	          64,
+	          0,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libolecf_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_read_queue_get_completion function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_read_queue_get_completion(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libolecf_read_queue_t *read_queue = NULL;
+	intptr_t *user_data               = NULL;
+	ssize_t read_count                = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_read_queue_initialize(
+	          &read_queue,
+	          16,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "read_queue",
+	 read_queue );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libolecf_read_queue_get_completion(
+	          read_queue,
+	          &user_data,
+	          &read_count,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_read_queue_get_completion(
+	          NULL,
+	          &user_data,
+	          &read_count,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_read_queue_get_completion(
+	          read_queue,
+	          NULL,
+	          &read_count,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_read_queue_get_completion(
+	          read_queue,
+	          &user_data,
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libolecf_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+
+/* Reads the data of a stream with a read queue and compares it with the data
+ * read from the stream, more requests are submitted than the read queue holds
+ * Returns 1 if the data matches, 0 if not or -1 on error
+ */
+int olecf_test_read_queue_compare_stream(
+     libolecf_read_queue_t *read_queue,
+     libolecf_item_t *stream,
+     int maximum_number_of_requests,
+     size_t maximum_request_size,
+     libcerror_error_t **error )
+{
+	intptr_t *user_data            = NULL;
+	off64_t *request_offsets       = NULL;
+	uint8_t *compare_buffer        = NULL;
+	uint8_t *request_buffers       = NULL;
+	static char *function          = "olecf_test_read_queue_compare_stream";
+	off64_t stream_offset          = 0;
+	size_t read_size               = 0;
+	size_t request_size            = 0;
+	ssize_t read_count             = 0;
+	uint32_t stream_size           = 0;
+	int number_of_pending_requests = 0;
+	int number_of_slots            = 0;
+	int result                     = 0;
+	int slot_index                 = 0;
+	int stream_data_matches        = 1;
+
+	if( libolecf_item_get_size(
+	     stream,
+	     &stream_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		goto on_error;
+	}
+	if( stream_size == 0 )
+	{
+		return( 1 );
+	}
+	request_size = maximum_request_size;
+
+	if( request_size > (size_t) stream_size )
+	{
+		request_size = (size_t) stream_size;
+	}
+	/* One more request buffer than the read queue holds so that
+	 * a request is submitted when the read queue is full
+	 */
+	number_of_slots = maximum_number_of_requests + 1;
+
+	request_buffers = (uint8_t *) memory_allocate(
+	                               request_size * number_of_slots );
+
+	if( request_buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create request buffers.",
+		 function );
+
+		goto on_error;
+	}
+	request_offsets = (off64_t *) memory_allocate(
+	                               sizeof( off64_t ) * number_of_slots );
+
+	if( request_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create request offsets.",
+		 function );
+
+		goto on_error;
+	}
+	compare_buffer = (uint8_t *) memory_allocate(
+	                              request_size );
+
+	if( compare_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compare buffer.",
+		 function );
+
+		goto on_error;
+	}
+	for( slot_index = 0;
+	     slot_index < number_of_slots;
+	     slot_index++ )
+	{
+		request_offsets[ slot_index ] = -1;
+	}
+	while( ( (size64_t) stream_offset < (size64_t) stream_size )
+	    || ( number_of_pending_requests > 0 ) )
+	{
+		result = 0;
+
+		if( (size64_t) stream_offset < (size64_t) stream_size )
+		{
+			for( slot_index = 0;
+			     slot_index < number_of_slots;
+			     slot_index++ )
+			{
+				if( request_offsets[ slot_index ] == -1 )
+				{
+					break;
+				}
+			}
+			result = libolecf_read_queue_submit_read(
+			          read_queue,
+			          stream,
+			          &( request_buffers[ slot_index * request_size ] ),
+			          request_size,
+			          stream_offset,
+			          (intptr_t *) &( request_offsets[ slot_index ] ),
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to submit read at offset: %" PRIi64 ".",
+				 function,
+				 stream_offset );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				request_offsets[ slot_index ] = stream_offset;
+
+				number_of_pending_requests += 1;
+
+				stream_offset += (off64_t) request_size;
+
+				continue;
+			}
+			/* The read queue is only full when it holds the maximum number of requests
+			 */
+			if( number_of_pending_requests != maximum_number_of_requests )
+			{
+				stream_data_matches = 0;
+			}
+		}
+		result = libolecf_read_queue_get_completion(
+		          read_queue,
+		          &user_data,
+		          &read_count,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve completion.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_pending_requests -= 1;
+
+		slot_index = (int) ( (off64_t *) user_data - request_offsets );
+
+		if( ( slot_index < 0 )
+		 || ( slot_index >= number_of_slots )
+		 || ( request_offsets[ slot_index ] == -1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid user data value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		read_size = request_size;
+
+		if( read_size > (size_t) ( (off64_t) stream_size - request_offsets[ slot_index ] ) )
+		{
+			read_size = (size_t) ( (off64_t) stream_size - request_offsets[ slot_index ] );
+		}
+		if( read_count != (ssize_t) read_size )
+		{
+			stream_data_matches = 0;
+		}
+		else
+		{
+			read_count = libolecf_stream_read_buffer_at_offset(
+			              stream,
+			              compare_buffer,
+			              read_size,
+			              request_offsets[ slot_index ],
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read stream data at offset: %" PRIi64 ".",
+				 function,
+				 request_offsets[ slot_index ] );
+
+				goto on_error;
+			}
+			if( memory_compare(
+			     &( request_buffers[ slot_index * request_size ] ),
+			     compare_buffer,
+			     read_size ) != 0 )
+			{
+				stream_data_matches = 0;
+			}
+		}
+		request_offsets[ slot_index ] = -1;
+	}
+	memory_free(
+	 compare_buffer );
+
+	memory_free(
+	 request_offsets );
+
+	memory_free(
+	 request_buffers );
+
+	return( stream_data_matches );
+
+on_error:
+	/* The request buffers cannot be freed while the system can still write into them
+	 */
+	while( number_of_pending_requests > 0 )
+	{
+		if( libolecf_read_queue_get_completion(
+		     read_queue,
+		     &user_data,
+		     &read_count,
+		     NULL ) == 0 )
+		{
+			break;
+		}
+		number_of_pending_requests -= 1;
+	}
+	if( compare_buffer != NULL )
+	{
+		memory_free(
+		 compare_buffer );
+	}
+	if( request_offsets != NULL )
+	{
+		memory_free(
+		 request_offsets );
+	}
+	if( request_buffers != NULL )
+	{
+		memory_free(
+		 request_buffers );
+	}
+	return( -1 );
+}
+
+/* Reads the streams of an item and its sub items with a read queue
+ * and compares the data with the data read from the streams
+ * Returns 1 if the data matches, 0 if not or -1 on error
+ */
+int olecf_test_read_queue_compare_item(
+     libolecf_read_queue_t *read_queue,
+     libolecf_item_t *item,
+     int maximum_number_of_requests,
+     size_t maximum_request_size,
+     libcerror_error_t **error )
+{
+	libolecf_item_t *sub_item = NULL;
+	static char *function     = "olecf_test_read_queue_compare_item";
+	uint8_t item_type         = 0;
+	int number_of_sub_items   = 0;
+	int result                = 0;
+	int sub_item_index        = 0;
+
+	if( libolecf_item_get_type(
+	     item,
+	     &item_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve type.",
+		 function );
+
+		goto on_error;
+	}
+	if( item_type == LIBOLECF_ITEM_TYPE_STREAM )
+	{
+		result = olecf_test_read_queue_compare_stream(
+		          read_queue,
+		          item,
+		          maximum_number_of_requests,
+		          maximum_request_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare stream data.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( libolecf_item_get_number_of_sub_items(
+	     item,
+	     &number_of_sub_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub items.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_item_index = 0;
+	     sub_item_index < number_of_sub_items;
+	     sub_item_index++ )
+	{
+		if( libolecf_item_get_sub_item(
+		     item,
+		     sub_item_index,
+		     &sub_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		result = olecf_test_read_queue_compare_item(
+		          read_queue,
+		          sub_item,
+		          maximum_number_of_requests,
+		          maximum_request_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		if( libolecf_item_free(
+		     &sub_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( sub_item != NULL )
+	{
+		libolecf_item_free(
+		 &sub_item,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests reading the streams of a file with the libolecf_read_queue_submit_read
+ * and libolecf_read_queue_get_completion functions
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_read_queue_read_streams(
+     libolecf_file_t *file )
+{
+	int maximum_number_of_requests[ 2 ] = { 1, 4 };
+	size_t maximum_request_sizes[ 2 ]   = { 1000, 1024 * 1024 };
+
+	libcerror_error_t *error            = NULL;
+	libolecf_item_t *root_item          = NULL;
+	libolecf_read_queue_t *read_queue   = NULL;
+	int queue_size_index                = 0;
+	int request_size_index              = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_file_get_root_item(
+	          file,
+	          &root_item,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "root_item",
+	 root_item );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * A read queue of 1 request has a ring of 1 entry, which fills up when
+	 * the stream data of a request is stored in multiple extents
+	 */
+	for( queue_size_index = 0;
+	     queue_size_index < 2;
+	     queue_size_index++ )
+	{
+		result = libolecf_read_queue_initialize(
+		          &read_queue,
+		          maximum_number_of_requests[ queue_size_index ],
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NOT_NULL(
+		 "read_queue",
+		 read_queue );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( request_size_index = 0;
+		     request_size_index < 2;
+		     request_size_index++ )
+		{
+			result = olecf_test_read_queue_compare_item(
+			          read_queue,
+			          root_item,
+			          maximum_number_of_requests[ queue_size_index ],
+			          maximum_request_sizes[ request_size_index ],
+			          &error );
+
+			OLECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libolecf_read_queue_free(
+		          &read_queue,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "read_queue",
+		 read_queue );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libolecf_item_free(
+	          &root_item,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "root_item",
+	 root_item );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libolecf_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	if( root_item != NULL )
+	{
+		libolecf_item_free(
+		 &root_item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libolecf_file_t *file            = NULL;
+	system_character_t *source       = NULL;
+	system_integer_t option          = 0;
+	size_t string_length             = 0;
+	int result                       = 0;
+
+	while( ( option = olecf_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+	OLECF_TEST_RUN(
+	 "libolecf_read_queue_initialize",
+	 olecf_test_read_queue_initialize );
+
+	OLECF_TEST_RUN(
+	 "libolecf_read_queue_free",
+	 olecf_test_read_queue_free );
+
+	OLECF_TEST_RUN(
+	 "libolecf_read_queue_submit_read",
+	 olecf_test_read_queue_submit_read );
+
+	OLECF_TEST_RUN(
+	 "libolecf_read_queue_get_completion",
+	 olecf_test_read_queue_get_completion );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		result = libbfio_file_initialize(
+		          &file_io_handle,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NOT_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		string_length = system_string_length(
+		                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libbfio_file_set_name_wide(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#else
+		result = libbfio_file_set_name(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#endif
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libolecf_check_file_signature_file_io_handle(
+		          file_io_handle,
+		          &error );
+
+		OLECF_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( result != 0 )
+	{
+		/* Test with the file opened by name with read-ahead, the read queue
+		 * reads asynchronously if the system supports io_uring
+		 */
+		result = olecf_test_read_queue_open_source(
+		          &file,
+		          source,
+		          NULL,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NOT_NULL(
+		 "file",
+		 file );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		OLECF_TEST_RUN_WITH_ARGS(
+		 "libolecf_read_queue_submit_read",
+		 olecf_test_read_queue_read_streams,
+		 file );
+
+		result = olecf_test_read_queue_close_source(
+		          &file,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "file",
+		 file );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test with the file opened with a file IO handle, the read queue
+		 * falls back to reading synchronously
+		 */
+		result = olecf_test_read_queue_open_source(
+		          &file,
+		          source,
+		          file_io_handle,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NOT_NULL(
+		 "file",
+		 file );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		OLECF_TEST_RUN_WITH_ARGS(
+		 "libolecf_read_queue_submit_read",
+		 olecf_test_read_queue_read_streams,
+		 file );
+
+		result = olecf_test_read_queue_close_source(
+		          &file,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "file",
+		 file );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( file_io_handle != NULL )
+	{
+		result = libbfio_handle_free(
+		          &file_io_handle,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libolecf_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,644 @@
+/*
+ * Library read_ranges type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "olecf_test_libcerror.h"
+#include "olecf_test_libolecf.h"
+#include "olecf_test_macros.h"
+#include "olecf_test_memory.h"
+#include "olecf_test_unused.h"
+
+#include "../libolecf/libolecf_read_ranges.h"
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+/* Tests the libolecf_read_ranges_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_read_ranges_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libolecf_read_ranges_t *read_ranges = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_OLECF_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 1;
+	int number_of_memset_fail_tests     = 1;
+	int test_number                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libolecf_read_ranges_initialize(
+	          &read_ranges,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "read_ranges",
+	 read_ranges );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libolecf_read_ranges_free(
+	          &read_ranges,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "read_ranges",
+	 read_ranges );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libolecf_read_ranges_initialize(
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_ranges = (libolecf_read_ranges_t *) 0x12345678UL;
+
+	result = libolecf_read_ranges_initialize(
+	          &read_ranges,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_ranges = NULL;
+
+#if defined( HAVE_OLECF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libolecf_read_ranges_initialize with malloc failing
+		 */
+		olecf_test_malloc_attempts_before_fail = test_number;
+
+		result = libolecf_read_ranges_initialize(
+		          &read_ranges,
+		          &error );
+
+		if( olecf_test_malloc_attempts_before_fail != -1 )
+		{
+			olecf_test_malloc_attempts_before_fail = -1;
+
+			if( read_ranges != NULL )
+			{
+				libolecf_read_ranges_free(
+				 &read_ranges,
+				 NULL );
+			}
+		}
+		else
+		{
+			OLECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "read_ranges",
+			 read_ranges );
+
+			OLECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libolecf_read_ranges_initialize with memset failing
+		 */
+		olecf_test_memset_attempts_before_fail = test_number;
+
+		result = libolecf_read_ranges_initialize(
+		          &read_ranges,
+		          &error );
+
+		if( olecf_test_memset_attempts_before_fail != -1 )
+		{
+			olecf_test_memset_attempts_before_fail = -1;
+
+			if( read_ranges != NULL )
+			{
+				libolecf_read_ranges_free(
+				 &read_ranges,
+				 NULL );
+			}
+		}
+		else
+		{
+			OLECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			OLECF_TEST_ASSERT_IS_NULL(
+			 "read_ranges",
+			 read_ranges );
+
+			OLECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_OLECF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_ranges != NULL )
+	{
+		libolecf_read_ranges_free(
+		 &read_ranges,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_read_ranges_free function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_read_ranges_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libolecf_read_ranges_free(
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_read_ranges_append_extent function
+ * Returns 1 if successful or 0 if not
+ */
+/* Tests the libolecf_read_ranges_append_range function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_read_ranges_append_range(
+     void )
+{
+	uint8_t buffer[ 32 ];
+
+	libcerror_error_t *error            = NULL;
+	libolecf_read_ranges_t *read_ranges = NULL;
+	int range_index                     = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_read_ranges_initialize(
+	          &read_ranges,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "read_ranges",
+	 read_ranges );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( range_index = 0;
+	     range_index < 32;
+	     range_index++ )
+	{
+		result = libolecf_read_ranges_append_range(
+		          read_ranges,
+		          (off64_t) ( 512 * range_index ),
+		          &( buffer[ range_index ] ),
+		          1,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "read_ranges->number_of_ranges",
+	 read_ranges->number_of_ranges,
+	 32 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT64(
+	 "read_ranges->ranges[ 31 ].file_offset",
+	 (int64_t) read_ranges->ranges[ 31 ].file_offset,
+	 (int64_t) 15872 );
+
+	/* Test error cases
+	 */
+	result = libolecf_read_ranges_append_range(
+	          NULL,
+	          512,
+	          buffer,
+	          1,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_read_ranges_append_range(
+	          read_ranges,
+	          -1,
+	          buffer,
+	          1,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_read_ranges_append_range(
+	          read_ranges,
+	          512,
+	          NULL,
+	          1,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libolecf_read_ranges_append_range(
+	          read_ranges,
+	          512,
+	          buffer,
+	          0,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_read_ranges_free(
+	          &read_ranges,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "read_ranges",
+	 read_ranges );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_ranges != NULL )
+	{
+		libolecf_read_ranges_free(
+		 &read_ranges,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libolecf_read_ranges_sort function
+ * Returns 1 if successful or 0 if not
+ */
+int olecf_test_read_ranges_sort(
+     void )
+{
+	uint8_t buffer[ 4 ];
+
+	off64_t file_offsets[ 4 ]           = { 4096, 512, 8192, 0 };
+	libcerror_error_t *error            = NULL;
+	libolecf_read_ranges_t *read_ranges = NULL;
+	int range_index                     = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libolecf_read_ranges_initialize(
+	          &read_ranges,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "read_ranges",
+	 read_ranges );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( range_index = 0;
+	     range_index < 4;
+	     range_index++ )
+	{
+		result = libolecf_read_ranges_append_range(
+		          read_ranges,
+		          file_offsets[ range_index ],
+		          &( buffer[ range_index ] ),
+		          1,
+		          &error );
+
+		OLECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		OLECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libolecf_read_ranges_sort(
+	          read_ranges,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT64(
+	 "read_ranges->ranges[ 0 ].file_offset",
+	 (int64_t) read_ranges->ranges[ 0 ].file_offset,
+	 (int64_t) 0 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT64(
+	 "read_ranges->ranges[ 1 ].file_offset",
+	 (int64_t) read_ranges->ranges[ 1 ].file_offset,
+	 (int64_t) 512 );
+
+	OLECF_TEST_ASSERT_EQUAL_INT64(
+	 "read_ranges->ranges[ 3 ].file_offset",
+	 (int64_t) read_ranges->ranges[ 3 ].file_offset,
+	 (int64_t) 8192 );
+
+	/* Test if the buffers are moved with their range
+	 */
+	OLECF_TEST_ASSERT_EQUAL_INTPTR(
+	 "read_ranges->ranges[ 0 ].buffer",
+	 (intptr_t) read_ranges->ranges[ 0 ].buffer,
+	 (intptr_t) &( buffer[ 3 ] ) );
+
+	/* Test error cases
+	 */
+	result = libolecf_read_ranges_sort(
+	          NULL,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	OLECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libolecf_read_ranges_free(
+	          &read_ranges,
+	          &error );
+
+	OLECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "read_ranges",
+	 read_ranges );
+
+	OLECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_ranges != NULL )
+	{
+		libolecf_read_ranges_free(
+		 &read_ranges,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc OLECF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] OLECF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc OLECF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] OLECF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	OLECF_TEST_UNREFERENCED_PARAMETER( argc )
+	OLECF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+	OLECF_TEST_RUN(
+	 "libolecf_read_ranges_initialize",
+	 olecf_test_read_ranges_initialize );
+
+	OLECF_TEST_RUN(
+	 "libolecf_read_ranges_free",
+	 olecf_test_read_ranges_free );
+
+	OLECF_TEST_RUN(
+	 "libolecf_read_ranges_append_range",
+	 olecf_test_read_ranges_append_range );
+
+	OLECF_TEST_RUN(
+	 "libolecf_read_ranges_sort",
+	 olecf_test_read_ranges_sort );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBOLECF_DLL_IMPORT ) */
+}
+
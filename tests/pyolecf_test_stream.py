@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+#
+# Python-bindings stream type test script
+#
+# Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+#
+# Refer to AUTHORS for acknowledgements.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+import argparse
+import os
+import sys
+import unittest
+
+import pyolecf
+
+
+class StreamTypeTests(unittest.TestCase):
+  """Tests the stream type."""
+
+  def _GetStream(self, item):
+    """Retrieves the first stream that contains data.
+
+    Args:
+      item (pyolecf.item): item to start searching from.
+
+    Returns:
+      pyolecf.stream: stream or None if not available.
+    """
+    if isinstance(item, pyolecf.stream) and item.size > 0:
+      return item
+
+    for sub_item in item.sub_items:
+      stream = self._GetStream(sub_item)
+      if stream:
+        return stream
+
+    return None
+
+  def test_read_buffer_at_offset(self):
+    """Tests the read_buffer_at_offset function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    olecf_file = pyolecf.file()
+
+    olecf_file.open(test_source)
+
+    try:
+      olecf_stream = self._GetStream(olecf_file.root_item)
+      if not olecf_stream:
+        raise unittest.SkipTest("missing stream")
+
+      size = olecf_stream.size
+      read_size = min(size, 4096)
+
+      expected_data = olecf_stream.read_buffer(read_size)
+
+      olecf_stream.seek_offset(size // 2, os.SEEK_SET)
+
+      data = olecf_stream.read_buffer_at_offset(read_size, 0)
+      self.assertEqual(data, expected_data)
+
+      # Test that the current offset is not changed.
+      self.assertEqual(olecf_stream.get_offset(), size // 2)
+
+      data = olecf_stream.read_buffer_at_offset(read_size, size)
+      self.assertEqual(data, b"")
+
+      self.assertEqual(olecf_stream.get_offset(), size // 2)
+
+      with self.assertRaises(IOError):
+        olecf_stream.read_buffer_at_offset(-1, 0)
+
+      with self.assertRaises(IOError):
+        olecf_stream.read_buffer_at_offset(read_size, -1)
+
+      self.assertEqual(olecf_stream.get_offset(), size // 2)
+
+    finally:
+      olecf_file.close()
+
+
+if __name__ == "__main__":
+  argument_parser = argparse.ArgumentParser()
+
+  argument_parser.add_argument(
+      "source", nargs="?", action="store", metavar="PATH",
+      default=None, help="path of the source file.")
+
+  options, unknown_options = argument_parser.parse_known_args()
+  unknown_options.insert(0, sys.argv[0])
+
+  setattr(unittest, "source", options.source)
+
+  unittest.main(argv=unknown_options, verbosity=2)
@@ -1,7 +1,7 @@
 # Tests library functions and types.
 
-$LibraryTests = "allocation_table directory_entry error file_header io_handle item notify property_section property_set property_value"
-$LibraryTestsWithInput = "file support"
+$LibraryTests = "allocation_table block_cache directory_entry directory_table directory_tree error extent_map file_header io_handle io_uring item memory_map name_index notify property_section property_set property_value read_ahead read_queue read_ranges"
+$LibraryTestsWithInput = "file item read_queue support"
 $OptionSets = "" -split " "
 
 . .\test_functions.ps1